@@ -8,7 +8,10 @@
  *  \author Martin Nolte
  */
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <limits>
 
 #include <dune/common/fmatrix.hh>
 #include <dune/common/fvector.hh>
@@ -454,6 +457,88 @@ namespace Dune
       }
     };
 
+
+
+    // affineLocal
+    // -----------
+
+    /** \brief apply the inverse of an affine mapping to a range of points
+     *
+     *  \param[in]   origin   image of the local origin
+     *  \param[in]   jit      transposed (pseudo-)inverse of the Jacobian
+     *  \param[in]   globals  random access range of global coordinates
+     *  \param[out]  x        random access iterator to the local coordinates
+     *
+     *  The mapping is passed by value, so writing to x cannot alias it.
+     */
+    template< class ct, int mydim, int cdim, class GlobalPoints, class LocalIterator >
+    inline void affineLocal ( const FieldVector< ct, cdim > origin, const FieldMatrix< ct, cdim, mydim > jit,
+                              const GlobalPoints &globals, LocalIterator x )
+    {
+      const std::size_t size = globals.size();
+      for( std::size_t q = 0; q < size; ++q )
+      {
+        const FieldVector< ct, cdim > &yq = globals[ q ];
+        FieldVector< ct, mydim > xq( 0 );
+        for( int i = 0; i < cdim; ++i )
+        {
+          const ct d = yq[ i ] - origin[ i ];
+          for( int k = 0; k < mydim; ++k )
+            xq[ k ] += jit[ i ][ k ] * d;
+        }
+        x[ q ] = xq;
+      }
+    }
+
+
+
+    // containsTolerance / onManifold
+    // ------------------------------
+
+    /** \brief tolerance of the geometric tests in contains()
+     *
+     *  The tolerance is relative to the extent of the bounding box
+     *  [lower, upper] of the corners, so it does not depend on how the
+     *  geometry is stored.
+     */
+    template< class ct, int cdim >
+    inline ct containsTolerance ( const FieldVector< ct, cdim > &lower, const FieldVector< ct, cdim > &upper )
+    {
+      ct extent( 0 );
+      for( int j = 0; j < cdim; ++j )
+        extent = std::max( extent, upper[ j ] - lower[ j ] );
+      return ct( 256 ) * std::numeric_limits< ct >::epsilon() * extent;
+    }
+
+    /** \brief check whether a point lies on a geometry of lower dimension
+     *
+     *  For mydim < cdim, local() returns the local coordinate of the closest
+     *  point of the affine hull (or the manifold), whose image is passed as
+     *  \c image.  The point lies on the geometry if it coincides with this
+     *  image up to containsTolerance().
+     *
+     *  \param[in]  global      global coordinate to check
+     *  \param[in]  image       image of the local coordinate of global
+     *  \param[in]  numCorners  number of corners of the geometry
+     *  \param[in]  corner      function returning the i-th corner
+     */
+    template< class ct, int cdim, class Corner >
+    inline bool onManifold ( const FieldVector< ct, cdim > &global, const FieldVector< ct, cdim > &image,
+                             int numCorners, Corner corner )
+    {
+      FieldVector< ct, cdim > lower = corner( 0 ), upper = lower;
+      for( int i = 1; i < numCorners; ++i )
+      {
+        const FieldVector< ct, cdim > c = corner( i );
+        for( int j = 0; j < cdim; ++j )
+        {
+          lower[ j ] = std::min( lower[ j ], c[ j ] );
+          upper[ j ] = std::max( upper[ j ], c[ j ] );
+        }
+      }
+      return ((image - global).two_norm() <= containsTolerance( lower, upper ));
+    }
+
   } // namespace Impl
 
 
@@ -580,6 +665,48 @@ namespace Dune
       return local;
     }
 
+    /** \brief Evaluate the inverse mapping in a range of points
+     *
+     *  \param[in]   globals  random access range of global coordinates
+     *  \param[out]  x        random access iterator to the local coordinates
+     *
+     *  The result coincides with calling local( y ) for every point y.
+     */
+    template< class GlobalPoints, class LocalIterator >
+    void local ( const GlobalPoints &globals, LocalIterator x ) const
+    {
+      Impl::affineLocal( origin_, jacobianInverseTransposed_, globals, x );
+    }
+
+    /** \brief Check whether a global coordinate lies inside the geometry
+     *
+     *  \param[in]   global  global coordinate to check
+     *  \param[out]  local   corresponding local coordinate, only set if the
+     *                       point lies inside
+     *
+     *  The inverse mapping is a single matrix-vector product, so no geometric
+     *  rejection test is performed beforehand.
+     */
+    bool contains ( const GlobalCoordinate &global, LocalCoordinate &local ) const
+    {
+      const LocalCoordinate x = (*this).local( global );
+      if( !refElement_.checkInside( x ) )
+        return false;
+      // the point has to lie on the affine hull of the geometry
+      if( (mydimension < coorddimension)
+          && !Impl::onManifold( global, (*this).global( x ), corners(), [ this ] ( int i ) { return corner( i ); } ) )
+        return false;
+      local = x;
+      return true;
+    }
+
+    /** \brief Check whether a global coordinate lies inside the geometry */
+    bool contains ( const GlobalCoordinate &global ) const
+    {
+      LocalCoordinate local;
+      return contains( global, local );
+    }
+
     /** \brief Obtain the integration element
      *
      *  If the Jacobian of the mapping is denoted by $J(x)$, the integration
@@ -0,0 +1,536 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+
+/*!
+ * \file
+ * \brief Micro-benchmarks for the performance critical parts of dune-geometry
+ *
+ * The benchmarks cover
+ *  - global, local and jacobianInverseTransposed of the geometry classes,
+ *  - QuadratureRules::rule lookups from several threads at once,
+ *  - ReferenceElement::subEntity and ReferenceElement::size queries,
+ *  - iteration over StaticRefinement and VirtualRefinement.
+ *
+ * Each benchmark is calibrated to run for at least the given minimum time
+ * and repeated several times; the median is reported in nanoseconds per
+ * operation together with the number of points processed per second (0 if
+ * a benchmark processes no points). The results are written to stdout as
+ * JSON (default) or CSV.
+ *
+ * Usage: benchmark-geometry [--format=json|csv] [--filter=<substring>]
+ *                           [--min-time=<seconds>] [--repetitions=<n>]
+ *                           [--threads=<n>]
+ */
+
+#include "config.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <dune/common/fmatrix.hh>
+#include <dune/common/fvector.hh>
+
+#include <dune/geometry/affinegeometry.hh>
+#include <dune/geometry/axisalignedcubegeometry.hh>
+#include <dune/geometry/multilineargeometry.hh>
+#include <dune/geometry/quadraturerules.hh>
+#include <dune/geometry/referenceelements.hh>
+#include <dune/geometry/refinement.hh>
+#include <dune/geometry/type.hh>
+#include <dune/geometry/virtualrefinement.hh>
+
+using namespace Dune;
+
+// keep the compiler from optimizing away the computation of value
+template<class T>
+inline void doNotOptimize(const T &value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "g"(&value) : "memory");
+#else
+  static volatile const void *sink;
+  sink = &value;
+#endif
+}
+
+struct Options
+{
+  std::string format = "json";
+  std::string filter;
+  double minTime = 0.05;
+  int repetitions = 5;
+  unsigned int threads = std::max(std::thread::hardware_concurrency(), 1u);
+};
+
+struct Result
+{
+  std::string name;
+  unsigned int threads;
+  std::size_t iterations;
+  double nsPerOp;
+  double pointsPerSecond;
+};
+
+class BenchmarkRunner
+{
+public:
+  explicit BenchmarkRunner(const Options &options) : options_(options) {}
+
+  bool selected(const std::string &name) const
+  {
+    return options_.filter.empty() || (name.find(options_.filter) != std::string::npos);
+  }
+
+  /** \brief run the benchmark name
+   *
+   *  \param  pointsPerOp  number of points processed by a single operation
+   *  \param  f            functor such that f(n) performs n operations and
+   *                       returns the elapsed wall clock time in seconds
+   *  \param  threads      number of threads used by f
+   */
+  template<class F>
+  void run(const std::string &name, double pointsPerOp, F &&f, unsigned int threads = 1)
+  {
+    if (!selected(name))
+      return;
+
+    // calibrate: double the number of operations until a run takes long enough
+    std::size_t n = 1;
+    double seconds = f(n);
+    while ((seconds < options_.minTime / 10) && (n < (std::size_t(1) << 40)))
+    {
+      n *= 2;
+      seconds = f(n);
+    }
+    n = std::max(std::size_t(1), std::size_t(double(n) * options_.minTime / std::max(seconds, 1e-9)));
+
+    std::vector<double> nsPerOp;
+    for (int r = 0; r < options_.repetitions; ++r)
+      nsPerOp.push_back(1e9 * f(n) / double(n));
+    std::sort(nsPerOp.begin(), nsPerOp.end());
+    const double median = nsPerOp[nsPerOp.size() / 2];
+
+    results_.push_back({ name, threads, n, median, (median > 0 ? 1e9 * pointsPerOp / median : 0.0) });
+  }
+
+  const Options &options() const { return options_; }
+
+  void write(std::ostream &out) const
+  {
+    out << std::setprecision(6);
+    if (options_.format == "csv")
+    {
+      out << "name,threads,iterations,ns_per_op,points_per_s\n";
+      for (const Result &r : results_)
+        out << r.name << "," << r.threads << "," << r.iterations << ","
+            << r.nsPerOp << "," << r.pointsPerSecond << "\n";
+      return;
+    }
+
+    out << "{\n  \"benchmarks\": [";
+    for (std::size_t i = 0; i < results_.size(); ++i)
+    {
+      const Result &r = results_[i];
+      out << (i > 0 ? "," : "") << "\n    { \"name\": \"" << r.name << "\""
+          << ", \"threads\": " << r.threads
+          << ", \"iterations\": " << r.iterations
+          << ", \"ns_per_op\": " << r.nsPerOp
+          << ", \"points_per_s\": " << r.pointsPerSecond << " }";
+    }
+    out << "\n  ]\n}\n";
+  }
+
+private:
+  Options options_;
+  std::vector<Result> results_;
+};
+
+// time n calls of op(k), k = 0, ..., n-1
+template<class Op>
+double timeLoop(std::size_t n, Op &&op)
+{
+  const auto start = std::chrono::steady_clock::now();
+  for (std::size_t k = 0; k < n; ++k)
+    op(k);
+  const auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(stop - start).count();
+}
+
+std::string typeName(const GeometryType &type)
+{
+  std::ostringstream s;
+  s << type;
+  std::string name = s.str();
+  name.erase(std::remove_if(name.begin(), name.end(), [] (char c) { return c == '(' || c == ')' || c == ' '; }), name.end());
+  std::replace(name.begin(), name.end(), ',', '_');
+  return name;
+}
+
+
+// Geometries
+// ----------
+
+// corners of the image of the reference element under an affine map, if
+// affine is false, perturbed to give a non-affine multilinear geometry
+template<class ct, int mydim, int cdim>
+std::vector<FieldVector<ct, cdim> > corners(const GeometryType &type, bool affine)
+{
+  const auto refElement = referenceElement<ct, mydim>(type);
+  std::vector<FieldVector<ct, cdim> > result(refElement.size(mydim));
+  for (int i = 0; i < refElement.size(mydim); ++i)
+  {
+    const auto x = refElement.position(i, mydim);
+    for (int j = 0; j < cdim; ++j)
+    {
+      result[i][j] = ct(0.5) + ct(0.1) * j;
+      for (int k = 0; k < mydim; ++k)
+        result[i][j] += (j == k ? ct(2) : ct(0.25)) * x[k];
+      if (!affine)
+        result[i][j] += ct(0.05) * ((3*i + 2*j) % 5);
+    }
+  }
+  return result;
+}
+
+template<class Geometry>
+void benchmarkGeometry(BenchmarkRunner &runner, const std::string &name, const Geometry &geometry)
+{
+  typedef typename Geometry::ctype ctype;
+  typedef typename Geometry::LocalCoordinate LocalCoordinate;
+  typedef typename Geometry::GlobalCoordinate GlobalCoordinate;
+  const int mydim = Geometry::mydimension;
+
+  const auto &quad = QuadratureRules<ctype, mydim>::rule(geometry.type(), 4);
+  std::vector<LocalCoordinate> x;
+  std::vector<GlobalCoordinate> y;
+  for (const auto &qp : quad)
+  {
+    x.push_back(qp.position());
+    y.push_back(geometry.global(qp.position()));
+  }
+  const std::size_t m = x.size();
+
+  runner.run(name + "/global", 1, [&] (std::size_t n) {
+      return timeLoop(n, [&] (std::size_t k) { doNotOptimize(geometry.global(x[k % m])); });
+    });
+  runner.run(name + "/local", 1, [&] (std::size_t n) {
+      return timeLoop(n, [&] (std::size_t k) { doNotOptimize(geometry.local(y[k % m])); });
+    });
+  runner.run(name + "/jacobianInverseTransposed", 1, [&] (std::size_t n) {
+      return timeLoop(n, [&] (std::size_t k) { doNotOptimize(geometry.jacobianInverseTransposed(x[k % m])); });
+    });
+}
+
+// batched inverse mapping, not available for AxisAlignedCubeGeometry
+template<class Geometry>
+void benchmarkBatchedLocal(BenchmarkRunner &runner, const std::string &name, const Geometry &geometry)
+{
+  typedef typename Geometry::ctype ctype;
+  typedef typename Geometry::LocalCoordinate LocalCoordinate;
+  typedef typename Geometry::GlobalCoordinate GlobalCoordinate;
+  const int mydim = Geometry::mydimension;
+
+  const auto &quad = QuadratureRules<ctype, mydim>::rule(geometry.type(), 4);
+  std::vector<GlobalCoordinate> y;
+  for (const auto &qp : quad)
+    y.push_back(geometry.global(qp.position()));
+  std::vector<LocalCoordinate> x(y.size());
+
+  runner.run(name + "/localBatch", y.size(), [&] (std::size_t n) {
+      return timeLoop(n, [&] (std::size_t) { geometry.local(y, x.begin()); doNotOptimize(x[0]); });
+    });
+}
+
+template<class ct, int mydim, int cdim>
+void benchmarkGeometries(BenchmarkRunner &runner)
+{
+  const std::string dims = "<" + std::to_string(mydim) + "," + std::to_string(cdim) + ">";
+
+  for (const GeometryType &type : { GeometryTypes::simplex(mydim), GeometryTypes::cube(mydim) })
+  {
+    // the vertex-vector constructor assumes simplex numbering, so pass the
+    // edges emanating from vertex 0 explicitly
+    const auto c = corners<ct, mydim, cdim>(type, true);
+    FieldMatrix<ct, mydim, cdim> jt;
+    for (int k = 0; k < mydim; ++k)
+      jt[k] = c[type.isCube() ? (1 << k) : k+1] - c[0];
+    const AffineGeometry<ct, mydim, cdim> geometry(type, c[0], jt);
+    benchmarkGeometry(runner, "geometry/AffineGeometry" + dims + "/" + typeName(type), geometry);
+    benchmarkBatchedLocal(runner, "geometry/AffineGeometry" + dims + "/" + typeName(type), geometry);
+  }
+
+  std::vector<GeometryType> types = { GeometryTypes::simplex(mydim), GeometryTypes::cube(mydim) };
+  if (mydim == 3)
+  {
+    types.push_back(GeometryTypes::prism);
+    types.push_back(GeometryTypes::pyramid);
+  }
+  for (const GeometryType &type : types)
+  {
+    const auto c = corners<ct, mydim, cdim>(type, false);
+    const MultiLinearGeometry<ct, mydim, cdim> geometry(type, c);
+    benchmarkGeometry(runner, "geometry/MultiLinearGeometry" + dims + "/" + typeName(type), geometry);
+    benchmarkBatchedLocal(runner, "geometry/MultiLinearGeometry" + dims + "/" + typeName(type), geometry);
+    const CachedMultiLinearGeometry<ct, mydim, cdim> cachedGeometry(type, c);
+    benchmarkGeometry(runner, "geometry/CachedMultiLinearGeometry" + dims + "/" + typeName(type), cachedGeometry);
+    benchmarkBatchedLocal(runner, "geometry/CachedMultiLinearGeometry" + dims + "/" + typeName(type), cachedGeometry);
+  }
+}
+
+template<class ct, int dim>
+void benchmarkAxisAlignedCubeGeometry(BenchmarkRunner &runner)
+{
+  FieldVector<ct, dim> lower(ct(0.5)), upper(ct(2));
+  const std::string dims = "<" + std::to_string(dim) + "," + std::to_string(dim) + ">";
+  benchmarkGeometry(runner, "geometry/AxisAlignedCubeGeometry" + dims + "/" + typeName(GeometryTypes::cube(dim)),
+                    AxisAlignedCubeGeometry<ct, dim, dim>(lower, upper));
+}
+
+
+// Quadrature rules
+// ----------------
+
+// each of the given number of threads looks up n rules
+template<int dim>
+double lookupQuadratureRules(std::size_t n, unsigned int threads, int maxOrder)
+{
+  typedef QuadratureRules<double, dim> Rules;
+  const std::vector<GeometryType> types = (dim == 3)
+    ? std::vector<GeometryType>{ GeometryTypes::tetrahedron, GeometryTypes::hexahedron,
+                                 GeometryTypes::prism, GeometryTypes::pyramid }
+    : std::vector<GeometryType>{ GeometryTypes::simplex(dim), GeometryTypes::cube(dim) };
+
+  std::atomic<bool> go(false);
+  std::atomic<unsigned int> ready(0);
+  std::vector<std::thread> pool;
+  for (unsigned int t = 0; t < threads; ++t)
+    pool.emplace_back([&, t] {
+        ++ready;
+        while (!go.load(std::memory_order_acquire))
+          std::this_thread::yield();
+        for (std::size_t k = 0; k < n; ++k)
+          doNotOptimize(Rules::rule(types[(k + t) % types.size()], int((k / types.size()) % (maxOrder+1))).size());
+      });
+
+  while (ready.load() < threads)
+    std::this_thread::yield();
+  const auto start = std::chrono::steady_clock::now();
+  go.store(true, std::memory_order_release);
+  for (std::thread &thread : pool)
+    thread.join();
+  const auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(stop - start).count();
+}
+
+template<int dim>
+void benchmarkQuadratureRules(BenchmarkRunner &runner)
+{
+  const int maxOrder = 10;
+
+  // the first lookups create the rules
+  lookupQuadratureRules<dim>(4*(maxOrder+1), 1, maxOrder);
+
+  std::vector<unsigned int> threads = { 1 };
+  for (unsigned int t = 2; t <= runner.options().threads; t *= 2)
+    threads.push_back(t);
+  if (threads.back() != runner.options().threads)
+    threads.push_back(runner.options().threads);
+
+  for (unsigned int t : threads)
+    runner.run("quadrature/rule/dim" + std::to_string(dim) + "/threads" + std::to_string(t), 0,
+               [&] (std::size_t n) { return lookupQuadratureRules<dim>(n, t, maxOrder); }, t);
+
+  // iterate over the points of the rules
+  for (const GeometryType &type : { GeometryTypes::simplex(dim), GeometryTypes::cube(dim) })
+  {
+    const auto &quad = QuadratureRules<double, dim>::rule(type, maxOrder);
+    runner.run("quadrature/iterate/" + typeName(type) + "/order" + std::to_string(maxOrder), double(quad.size()),
+               [&] (std::size_t n) {
+                 return timeLoop(n, [&] (std::size_t) {
+                     double sum = 0;
+                     for (const auto &qp : quad)
+                       sum += qp.weight() * qp.position()[0];
+                     doNotOptimize(sum);
+                   });
+               });
+  }
+}
+
+
+// Reference elements
+// ------------------
+
+template<int dim>
+void benchmarkReferenceElement(BenchmarkRunner &runner, const GeometryType &type)
+{
+  const auto refElement = referenceElement<double, dim>(type);
+
+  // all admissible arguments (i, c, ii, cc)
+  std::vector<std::tuple<int, int, int, int> > queries;
+  for (int c = 0; c <= dim; ++c)
+    for (int i = 0; i < refElement.size(c); ++i)
+      for (int cc = c; cc <= dim; ++cc)
+        for (int ii = 0; ii < refElement.size(i, c, cc); ++ii)
+          queries.emplace_back(i, c, ii, cc);
+  const std::size_t m = queries.size();
+
+  runner.run("referenceelement/subEntity/" + typeName(type), 0, [&] (std::size_t n) {
+      return timeLoop(n, [&] (std::size_t k) {
+          const auto &q = queries[k % m];
+          doNotOptimize(refElement.subEntity(std::get<0>(q), std::get<1>(q), std::get<2>(q), std::get<3>(q)));
+        });
+    });
+  runner.run("referenceelement/size/" + typeName(type), 0, [&] (std::size_t n) {
+      return timeLoop(n, [&] (std::size_t k) {
+          const auto &q = queries[k % m];
+          doNotOptimize(refElement.size(std::get<0>(q), std::get<1>(q), std::get<3>(q)));
+        });
+    });
+  runner.run("referenceelement/position/" + typeName(type), 1, [&] (std::size_t n) {
+      return timeLoop(n, [&] (std::size_t k) {
+          const auto &q = queries[k % m];
+          doNotOptimize(refElement.position(std::get<0>(q), std::get<1>(q)));
+        });
+    });
+}
+
+template<int dim>
+void benchmarkReferenceElements(BenchmarkRunner &runner)
+{
+  for (const GeometryType &type : { GeometryTypes::simplex(dim), GeometryTypes::cube(dim) })
+    benchmarkReferenceElement<dim>(runner, type);
+  if (dim == 3)
+  {
+    benchmarkReferenceElement<dim>(runner, GeometryTypes::prism);
+    benchmarkReferenceElement<dim>(runner, GeometryTypes::pyramid);
+  }
+}
+
+
+// Refinement
+// ----------
+
+// one operation is a sweep over all vertices and all elements of the refinement
+template<unsigned int topologyId, int dim>
+void benchmarkStaticRefinement(BenchmarkRunner &runner, int intervals)
+{
+  typedef StaticRefinement<topologyId, double, topologyId, dim> Refinement;
+  const RefinementIntervals tag = refinementIntervals(intervals);
+  const double points = Refinement::nVertices(tag) + Refinement::nElements(tag);
+
+  runner.run("refinement/StaticRefinement/" + typeName(GeometryType(topologyId, dim)) + "/intervals" + std::to_string(intervals),
+             points, [&] (std::size_t n) {
+               return timeLoop(n, [&] (std::size_t) {
+                   double sum = 0;
+                   for (auto it = Refinement::vBegin(tag), end = Refinement::vEnd(tag); it != end; ++it)
+                     sum += it.coords()[0];
+                   for (auto it = Refinement::eBegin(tag), end = Refinement::eEnd(tag); it != end; ++it)
+                     sum += it.vertexIndices()[0];
+                   doNotOptimize(sum);
+                 });
+             });
+}
+
+template<int dim>
+void benchmarkVirtualRefinement(BenchmarkRunner &runner, const GeometryType &type, const GeometryType &coerceTo, int intervals)
+{
+  VirtualRefinement<dim, double> &refinement = buildRefinement<dim, double>(type, coerceTo);
+  const RefinementIntervals tag = refinementIntervals(intervals);
+  const double points = refinement.nVertices(tag) + refinement.nElements(tag);
+
+  runner.run("refinement/VirtualRefinement/" + typeName(type) + "/" + typeName(coerceTo) + "/intervals" + std::to_string(intervals),
+             points, [&] (std::size_t n) {
+               return timeLoop(n, [&] (std::size_t) {
+                   double sum = 0;
+                   for (auto it = refinement.vBegin(tag), end = refinement.vEnd(tag); it != end; ++it)
+                     sum += it.coords()[0];
+                   for (auto it = refinement.eBegin(tag), end = refinement.eEnd(tag); it != end; ++it)
+                     sum += it.vertexIndices()[0];
+                   doNotOptimize(sum);
+                 });
+             });
+}
+
+void benchmarkRefinements(BenchmarkRunner &runner)
+{
+  const int intervals = 8;
+
+  benchmarkStaticRefinement<GeometryTypes::line.id(), 1>(runner, intervals);
+  benchmarkStaticRefinement<GeometryTypes::triangle.id(), 2>(runner, intervals);
+  benchmarkStaticRefinement<GeometryTypes::quadrilateral.id(), 2>(runner, intervals);
+  benchmarkStaticRefinement<GeometryTypes::tetrahedron.id(), 3>(runner, intervals);
+  benchmarkStaticRefinement<GeometryTypes::hexahedron.id(), 3>(runner, intervals);
+
+  benchmarkVirtualRefinement<1>(runner, GeometryTypes::line, GeometryTypes::line, intervals);
+  benchmarkVirtualRefinement<2>(runner, GeometryTypes::triangle, GeometryTypes::triangle, intervals);
+  benchmarkVirtualRefinement<2>(runner, GeometryTypes::quadrilateral, GeometryTypes::quadrilateral, intervals);
+  benchmarkVirtualRefinement<3>(runner, GeometryTypes::tetrahedron, GeometryTypes::tetrahedron, intervals);
+  benchmarkVirtualRefinement<3>(runner, GeometryTypes::hexahedron, GeometryTypes::hexahedron, intervals);
+  benchmarkVirtualRefinement<3>(runner, GeometryTypes::prism, GeometryTypes::tetrahedron, intervals);
+  benchmarkVirtualRefinement<3>(runner, GeometryTypes::pyramid, GeometryTypes::tetrahedron, intervals);
+}
+
+
+Options parseOptions(int argc, char **argv)
+{
+  Options options;
+  for (int i = 1; i < argc; ++i)
+  {
+    const std::string arg = argv[i];
+    const std::size_t eq = arg.find('=');
+    const std::string key = arg.substr(0, eq);
+    const std::string value = (eq == std::string::npos ? std::string() : arg.substr(eq+1));
+    if (key == "--format" && (value == "json" || value == "csv"))
+      options.format = value;
+    else if (key == "--filter")
+      options.filter = value;
+    else if (key == "--min-time")
+      options.minTime = std::atof(value.c_str());
+    else if (key == "--repetitions")
+      options.repetitions = std::max(std::atoi(value.c_str()), 1);
+    else if (key == "--threads")
+      options.threads = unsigned(std::max(std::atoi(value.c_str()), 1));
+    else
+    {
+      std::cerr << "Usage: " << argv[0] << " [--format=json|csv] [--filter=<substring>]"
+                << " [--min-time=<seconds>] [--repetitions=<n>] [--threads=<n>]" << std::endl;
+      std::exit(1);
+    }
+  }
+  return options;
+}
+
+int main(int argc, char **argv)
+{
+  BenchmarkRunner runner(parseOptions(argc, argv));
+
+  benchmarkGeometries<double, 1, 1>(runner);
+  benchmarkGeometries<double, 2, 2>(runner);
+  benchmarkGeometries<double, 3, 3>(runner);
+  benchmarkGeometries<double, 2, 3>(runner);
+  benchmarkAxisAlignedCubeGeometry<double, 1>(runner);
+  benchmarkAxisAlignedCubeGeometry<double, 2>(runner);
+  benchmarkAxisAlignedCubeGeometry<double, 3>(runner);
+
+  benchmarkQuadratureRules<2>(runner);
+  benchmarkQuadratureRules<3>(runner);
+
+  benchmarkReferenceElements<1>(runner);
+  benchmarkReferenceElements<2>(runner);
+  benchmarkReferenceElements<3>(runner);
+
+  benchmarkRefinements(runner);
+
+  runner.write(std::cout);
+  return 0;
+}
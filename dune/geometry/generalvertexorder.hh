@@ -5,9 +5,11 @@
 #define DUNE_GEOMETRY_GENERALVERTEXORDER_HH
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <cstddef>
 #include <iterator>
+#include <utility>
 #include <vector>
 
 #include <dune/common/iteratorfacades.hh>
@@ -17,6 +19,34 @@
 
 namespace Dune {
 
+  namespace Impl {
+
+    //! number of ids up to which reduceOrder() keeps its work arrays on the stack
+    constexpr std::size_t reduceOrderStackSize = 8;
+
+    // Sort the positions perm[0,n) by the ids at these positions and store the
+    // rank of each id in rank, equal ids getting equal ranks
+    template<class Value>
+    void reduceOrderRanks(const Value *values, std::size_t *perm,
+                          std::size_t *rank, std::size_t n)
+    {
+      auto less = [values](std::size_t a, std::size_t b) { return values[a] < values[b]; };
+      if(n <= reduceOrderStackSize)
+      {
+        // insertion sort, the compiler unrolls it for these few ids
+        for(std::size_t i = 1; i < n; ++i)
+          for(std::size_t j = i; j > 0 && less(perm[j], perm[j-1]); --j)
+            std::swap(perm[j], perm[j-1]);
+      }
+      else
+        std::sort(perm, perm+n, less);
+
+      for(std::size_t k = 0; k < n; ++k)
+        rank[perm[k]] = (k > 0 && !less(perm[k-1], perm[k])) ? rank[perm[k-1]] : k;
+    }
+
+  } // namespace Impl
+
   /**
    * \brief Algorithm to reduce vertex order information
    *
@@ -30,7 +60,16 @@ namespace Dune {
    *
    * \c inBegin and \c inEnd must be ForwardIterators; their \c value_type may
    * constant.  \c outIt must be an OutputIterator and must allow \c
-   * std::distance(inBegin,inEnd) increments.  Complexity is quadratic.
+   * std::distance(inBegin,inEnd) increments.  Each id is replaced by the
+   * number of ids less than it, so equal ids are reduced to the same value.
+   * The \c value_type must be copyable, default constructible and
+   * comparable by \c operator<.
+   *
+   * The positions of the ids are sorted by their ids, so the complexity is
+   * \f$O(n \log n)\f$.  Up to Impl::reduceOrderStackSize ids, which covers
+   * the vertices of all elements up to dimension 3, the ids are copied into
+   * a default constructed array on the stack, the positions are sorted by
+   * insertion and nothing is allocated.
    *
    * \sa GeneralVertexOrder, VertexOrderByIdFactory
    */
@@ -38,11 +77,28 @@ namespace Dune {
   void reduceOrder(const InIterator& inBegin, const InIterator& inEnd,
                    OutIterator outIt)
   {
-    for(InIterator inIt = inBegin; inIt != inEnd; ++inIt, ++outIt)
-      *outIt = std::count_if(inBegin, inEnd, [&](const auto& v)
-                             {
-                               return v < *inIt;
-                             });
+    typedef typename std::iterator_traits<InIterator>::value_type Value;
+    const std::size_t n = std::distance(inBegin, inEnd);
+
+    if(n <= Impl::reduceOrderStackSize)
+    {
+      std::array<Value, Impl::reduceOrderStackSize> values;
+      std::array<std::size_t, Impl::reduceOrderStackSize> perm, rank;
+      std::copy(inBegin, inEnd, values.begin());
+      for(std::size_t i = 0; i < n; ++i)
+        perm[i] = i;
+      Impl::reduceOrderRanks(values.data(), perm.data(), rank.data(), n);
+      std::copy(rank.begin(), rank.begin()+n, outIt);
+    }
+    else
+    {
+      std::vector<Value> values(inBegin, inEnd);
+      std::vector<std::size_t> perm(n), rank(n);
+      for(std::size_t i = 0; i < n; ++i)
+        perm[i] = i;
+      Impl::reduceOrderRanks(values.data(), perm.data(), rank.data(), n);
+      std::copy(rank.begin(), rank.end(), outIt);
+    }
   }
 
   //! Class providing information on the ordering of vertices
@@ -66,9 +122,12 @@ namespace Dune {
     typedef ReferenceElements<double, dim> RefElems;
     typedef typename RefElems::ReferenceElement RefElem;
 
+    //! maximal number of vertices of an entity of dimension dim
+    static const std::size_t maxVertices = std::size_t(1) << dim;
+
     RefElem refelem;
     GeometryType gt;
-    std::vector<Index_> vertexOrder;
+    std::array<Index_, maxVertices> vertexOrder;
 
   public:
     //! Type of indices
@@ -89,14 +148,18 @@ namespace Dune {
      * \param inEnd   End of the range of vertex ids.
      *
      * \c inBegin and \c inEnd denote the range of vertex ids to provide.
-     * This class stores a reduced copy of the ids, converted to type Index.
+     * This class stores a reduced copy of the ids, converted to type Index,
+     * in an array of fixed capacity, so construction does not allocate.
      */
     template<class InIterator>
     GeneralVertexOrder(const GeometryType& gt_, const InIterator &inBegin,
                        const InIterator &inEnd) :
-      refelem(RefElems::general(gt_)), gt(gt_),
-      vertexOrder(refelem.size(dim))
-    { reduceOrder(inBegin, inEnd, vertexOrder.begin()); }
+      refelem(RefElems::general(gt_)), gt(gt_)
+    {
+      assert(std::size_t(refelem.size(dim)) <= maxVertices);
+      assert(std::size_t(std::distance(inBegin, inEnd)) == std::size_t(refelem.size(dim)));
+      reduceOrder(inBegin, inEnd, vertexOrder.begin());
+    }
 
     //! get begin iterator for the vertex indices of some sub-entity
     /**
@@ -0,0 +1,174 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#ifndef DUNE_GEOMETRY_GEOMETRYTYPEMAP_HH
+#define DUNE_GEOMETRY_GEOMETRYTYPEMAP_HH
+
+/**
+ * \file
+ * \brief A flat map with GeometryType keys
+ */
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+
+#include <dune/common/exceptions.hh>
+
+#include <dune/geometry/type.hh>
+#include <dune/geometry/typeindex.hh>
+
+namespace Dune
+{
+
+  /**
+   * \brief A map from the geometry types up to some dimension to values
+   *
+   * The values are stored in a flat array indexed by
+   * GlobalGeometryTypeIndex, which is a perfect hash of the geometry types up
+   * to dimension maxdim.  Lookups are a single index computation and do not
+   * compare keys.  Contrary to GeometryType::operator==, types none of
+   * different dimensions are different keys.
+   *
+   * All values are default constructed together with the map; a key is
+   * present once it has been accessed by operator[].
+   *
+   * \tparam T      Type of the values, must be default constructible.
+   * \tparam maxdim Maximal dimension of the keys.
+   */
+  template<class T, int maxdim>
+  class GeometryTypeMap
+  {
+  public:
+    //! Type of the values
+    typedef T mapped_type;
+    //! Type of the keys
+    typedef GeometryType key_type;
+
+    //! Maximal number of entries, i.e., the number of geometry types up to dimension maxdim
+    static constexpr std::size_t capacity()
+    {
+      return GlobalGeometryTypeIndex::size(maxdim);
+    }
+
+    //! construct an empty map
+    GeometryTypeMap() : values_(), present_(), size_(0) {}
+
+    //! number of keys present
+    std::size_t size() const { return size_; }
+
+    //! whether no key is present
+    bool empty() const { return size_ == 0; }
+
+    //! get the value for gt, inserting a default constructed one if necessary
+    T& operator[](const GeometryType& gt)
+    {
+      const std::size_t i = index(gt);
+      size_ += !present_[i];
+      present_[i] = true;
+      return values_[i];
+    }
+
+    //! get the value for gt, throw a RangeError if it is not present
+    T& at(const GeometryType& gt)
+    {
+      const std::size_t i = index(gt);
+      if(!present_[i])
+        DUNE_THROW(RangeError, "GeometryType " << gt << " not present in GeometryTypeMap");
+      return values_[i];
+    }
+
+    //! get the value for gt, throw a RangeError if it is not present
+    const T& at(const GeometryType& gt) const
+    {
+      const std::size_t i = index(gt);
+      if(!present_[i])
+        DUNE_THROW(RangeError, "GeometryType " << gt << " not present in GeometryTypeMap");
+      return values_[i];
+    }
+
+    //! pointer to the value for gt, nullptr if it is not present
+    T* find(const GeometryType& gt)
+    {
+      const std::size_t i = index(gt);
+      return present_[i] ? &values_[i] : nullptr;
+    }
+
+    //! pointer to the value for gt, nullptr if it is not present
+    const T* find(const GeometryType& gt) const
+    {
+      const std::size_t i = index(gt);
+      return present_[i] ? &values_[i] : nullptr;
+    }
+
+    //! number of values for gt, i.e., 0 or 1
+    std::size_t count(const GeometryType& gt) const
+    {
+      return present_[index(gt)];
+    }
+
+    //! remove gt from the map and reset its value, returns the number of removed values
+    std::size_t erase(const GeometryType& gt)
+    {
+      const std::size_t i = index(gt);
+      if(!present_[i])
+        return 0;
+      present_[i] = false;
+      values_[i] = T();
+      --size_;
+      return 1;
+    }
+
+    //! remove all keys and reset all values
+    void clear()
+    {
+      present_.fill(false);
+      values_.fill(T());
+      size_ = 0;
+    }
+
+    /**
+     * \brief call f(gt, value) for all keys present, in the order of GlobalGeometryTypeIndex
+     */
+    template<class F>
+    void forEach(F&& f)
+    {
+      for(std::size_t i = 0; i < capacity(); ++i)
+        if(present_[i])
+          f(type(i), values_[i]);
+    }
+
+    /**
+     * \brief call f(gt, value) for all keys present, in the order of GlobalGeometryTypeIndex
+     */
+    template<class F>
+    void forEach(F&& f) const
+    {
+      for(std::size_t i = 0; i < capacity(); ++i)
+        if(present_[i])
+          f(type(i), values_[i]);
+    }
+
+  private:
+    static std::size_t index(const GeometryType& gt)
+    {
+      assert(int(gt.dim()) <= maxdim);
+      return GlobalGeometryTypeIndex::index(gt);
+    }
+
+    // invert GlobalGeometryTypeIndex::index()
+    static GeometryType type(std::size_t i)
+    {
+      std::size_t dim = 0;
+      while(GlobalGeometryTypeIndex::offset(dim+1) <= i)
+        ++dim;
+      return LocalGeometryTypeIndex::type(dim, i - GlobalGeometryTypeIndex::offset(dim));
+    }
+
+    std::array<T, GlobalGeometryTypeIndex::size(maxdim)> values_;
+    std::array<bool, GlobalGeometryTypeIndex::size(maxdim)> present_;
+    std::size_t size_;
+  };
+
+} // namespace Dune
+
+#endif // DUNE_GEOMETRY_GEOMETRYTYPEMAP_HH
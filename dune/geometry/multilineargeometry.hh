@@ -3,10 +3,16 @@
 #ifndef DUNE_GEOMETRY_MULTILINEARGEOMETRY_HH
 #define DUNE_GEOMETRY_MULTILINEARGEOMETRY_HH
 
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstddef>
 #include <functional>
 #include <iterator>
 #include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <dune/common/fmatrix.hh>
@@ -58,6 +64,34 @@ namespace Dune
     /** \brief tolerance to numerical algorithms */
     static ct tolerance () { return ct( 16 ) * std::numeric_limits< ct >::epsilon(); }
 
+    /** \brief maximal number of Newton iterations performed by local()
+     *
+     *  This member is optional, traits without it get this default.
+     */
+    static int newtonMaxIterations () { return 32; }
+
+    /** \brief smallest damping factor tried by the line search in local()
+     *
+     *  Each Newton step is halved until the residual decreases.  If it does not
+     *  decrease for any damping factor down to this value, the iteration stops.
+     *  This member is optional, traits without it get this default.
+     */
+    static ct newtonMinDamping () { return ct( 1 ) / ct( 1024 ); }
+
+    /** \brief compute the cached data of affine mappings at construction?
+     *
+     *  By default, CachedMultiLinearGeometry stores the corners and computes
+     *  the inverse of the Jacobian and the integration element of an affine
+     *  mapping on first use.  If this is set to true, a compact storage is used
+     *  instead: an affine mapping keeps only its origin, the Jacobian, its
+     *  inverse and the integration element, all computed in the constructor,
+     *  just like AffineGeometry, and the corners are dropped.  A non-affine
+     *  mapping keeps a MultiLinearGeometry inline, in the same memory.  The
+     *  checks whether anything has been computed vanish from all methods,
+     *  the check whether the mapping is affine remains.
+     */
+    static const bool eagerCaching = false;
+
     /** \brief template specifying the storage for the corners
      *
      *  Internally, the MultiLinearGeometry needs to store the corners of the
@@ -151,6 +185,42 @@ namespace Dune
 
 
 
+  namespace Impl
+  {
+
+    // NewtonMaxIterations / NewtonMinDamping
+    // --------------------------------------
+
+    // read the optional Newton parameters of the traits, falling back to the
+    // defaults of MultiLinearGeometryTraits
+    template< class ct, class Traits, class = void >
+    struct NewtonMaxIterations
+    {
+      static int get () { return MultiLinearGeometryTraits< ct >::newtonMaxIterations(); }
+    };
+
+    template< class ct, class Traits >
+    struct NewtonMaxIterations< ct, Traits, void_t< decltype( Traits::newtonMaxIterations() ) > >
+    {
+      static int get () { return Traits::newtonMaxIterations(); }
+    };
+
+    template< class ct, class Traits, class = void >
+    struct NewtonMinDamping
+    {
+      static ct get () { return MultiLinearGeometryTraits< ct >::newtonMinDamping(); }
+    };
+
+    template< class ct, class Traits >
+    struct NewtonMinDamping< ct, Traits, void_t< decltype( Traits::newtonMinDamping() ) > >
+    {
+      static ct get () { return Traits::newtonMinDamping(); }
+    };
+
+  } // namespace Impl
+
+
+
   // MultiLinearGeometry
   // -------------------
 
@@ -199,6 +269,19 @@ namespace Dune
     //! type of jacobian inverse transposed
     class JacobianInverseTransposed;
 
+    //! result of the inverse mapping, see tryLocal()
+    struct LocalResult
+    {
+      //! local coordinate of the last Newton iterate
+      LocalCoordinate local;
+      //! did the Newton method converge within the maximal number of iterations?
+      bool converged;
+      //! did it converge to a point inside the reference element?
+      bool inside;
+      //! number of Newton iterations performed
+      int iterations;
+    };
+
   protected:
 
     typedef Dune::ReferenceElements< ctype, mydimension > ReferenceElements;
@@ -300,18 +383,109 @@ namespace Dune
      *  \endcode
      */
     LocalCoordinate local ( const GlobalCoordinate &globalCoord ) const
+    {
+      return tryLocal( globalCoord ).local;
+    }
+
+    /** \brief evaluate the inverse mapping and report whether it succeeded
+     *
+     *  \param[in] globalCoord global coordinate to map
+     *
+     *  \return the local coordinate computed by local() together with a status
+     *
+     *  The inverse mapping is computed by a damped (Gauss-)Newton method.  The
+     *  initial guess is the preimage of \c globalCoord under the affine
+     *  approximation of the mapping in the barycenter of the reference element.
+     *  Each step is halved until the residual decreases, and at most
+     *  MultiLinearGeometryTraits::newtonMaxIterations() steps are performed, so the cost of locating
+     *  a point that lies far outside the element is bounded.
+     */
+    LocalResult tryLocal ( const GlobalCoordinate &globalCoord ) const
     {
       const ctype tolerance = Traits::tolerance();
-      LocalCoordinate x = refElement().position( 0, 0 );
+      const ctype minDamping = Impl::NewtonMinDamping< ctype, Traits >::get();
+      const int maxIterations = Impl::NewtonMaxIterations< ctype, Traits >::get();
+
+      LocalResult result;
+      result.local = refElement().position( 0, 0 );
+      result.converged = false;
+      result.iterations = 0;
+
+      LocalCoordinate &x = result.local;
       LocalCoordinate dx;
-      do
+      GlobalCoordinate residual = global( x ) - globalCoord;
+      ctype residualNorm2 = residual.two_norm2();
+      while( result.iterations < maxIterations )
       {
-        // Newton's method: DF^n dx^n = F^n, x^{n+1} -= dx^n
-        const GlobalCoordinate dglobal = (*this).global( x ) - globalCoord;
-        MatrixHelper::template xTRightInvA< mydimension, coorddimension >( jacobianTransposed( x ), dglobal, dx );
-        x -= dx;
-      } while( dx.two_norm2() > tolerance );
-      return x;
+        // Newton's method: DF^n dx^n = F^n, x^{n+1} = x^n - lambda^n dx^n
+        MatrixHelper::template xTRightInvA< mydimension, coorddimension >( jacobianTransposed( x ), residual, dx );
+        const ctype dxNorm2 = dx.two_norm2();
+        if( !(dxNorm2 < std::numeric_limits< ctype >::infinity()) )
+          break;
+        ++result.iterations;
+
+        // the first step from the barycenter is the affine guess, take it undamped
+        ctype lambda( 1 );
+        LocalCoordinate xNew = x - dx;
+        GlobalCoordinate residualNew = global( xNew ) - globalCoord;
+        bool accepted = (result.iterations == 1) || (residualNew.two_norm2() < residualNorm2);
+        while( !accepted && (lambda > minDamping) )
+        {
+          lambda *= ctype( 0.5 );
+          xNew = x;
+          xNew.axpy( -lambda, dx );
+          residualNew = global( xNew ) - globalCoord;
+          accepted = (residualNew.two_norm2() < residualNorm2);
+        }
+
+        if( accepted )
+        {
+          x = xNew;
+          residual = residualNew;
+          residualNorm2 = residual.two_norm2();
+        }
+
+        if( dxNorm2 <= tolerance )
+        {
+          result.converged = true;
+          break;
+        }
+        // no descent even for the smallest damping factor
+        if( !accepted )
+          break;
+      }
+      result.inside = result.converged && refElement().checkInside( x );
+      return result;
+    }
+
+    /** \brief check whether a global coordinate lies inside the geometry
+     *
+     *  \param[in]   globalCoord  global coordinate to check
+     *  \param[out]  local        corresponding local coordinate, only set if
+     *                            the point lies inside
+     *
+     *  Before solving for the local coordinate, the point is tested against
+     *  the bounding box of the corners and, if mydimension equals
+     *  coorddimension, against slabs perpendicular to the faces of the
+     *  geometry.  Since the geometry lies in the convex hull of its corners,
+     *  points outside are mostly rejected without a Newton iteration.
+     */
+    bool contains ( const GlobalCoordinate &globalCoord, LocalCoordinate &local ) const
+    {
+      if( excludes( globalCoord ) )
+        return false;
+      const LocalResult result = tryLocal( globalCoord );
+      if( !result.inside || !onManifold( globalCoord, result.local ) )
+        return false;
+      local = result.local;
+      return true;
+    }
+
+    /** \brief check whether a global coordinate lies inside the geometry */
+    bool contains ( const GlobalCoordinate &globalCoord ) const
+    {
+      LocalCoordinate local;
+      return contains( globalCoord, local );
     }
 
     /** \brief obtain the integration element
@@ -373,12 +547,126 @@ namespace Dune
      */
     JacobianInverseTransposed jacobianInverseTransposed ( const LocalCoordinate &local ) const;
 
+    /** \brief evaluate the mapping in a range of points
+     *
+     *  \param[in]   points  random access range (e.g., a QuadratureRule or a
+     *                       std::vector< LocalCoordinate >) of local
+     *                       coordinates or quadrature points
+     *  \param[out]  y       random access iterator to the global coordinates
+     *
+     *  The result coincides with calling global( x ) for every point x, but
+     *  the recursion over the reference element's construction is performed
+     *  once per batch of points only.
+     */
+    template< class Points, class GlobalIterator >
+    void global ( const Points &points, GlobalIterator y ) const
+    {
+      evaluate( points, y, NullOutputIterator(), NullOutputIterator() );
+    }
+
+    /** \brief evaluate the transposed of the Jacobian in a range of points
+     *
+     *  \param[in]   points  random access range of local coordinates or
+     *                       quadrature points
+     *  \param[out]  jt      random access iterator to the transposed Jacobians
+     */
+    template< class Points, class JacobianIterator >
+    void jacobianTransposed ( const Points &points, JacobianIterator jt ) const
+    {
+      evaluate( points, NullOutputIterator(), jt, NullOutputIterator() );
+    }
+
+    /** \brief obtain the integration element in a range of points
+     *
+     *  \param[in]   points  random access range of local coordinates or
+     *                       quadrature points
+     *  \param[out]  mu      random access iterator to the integration elements
+     */
+    template< class Points, class IntegrationElementIterator >
+    void integrationElement ( const Points &points, IntegrationElementIterator mu ) const
+    {
+      evaluate( points, NullOutputIterator(), NullOutputIterator(), mu );
+    }
+
+    /** \brief evaluate mapping, Jacobian and integration element in a range
+     *         of points in one pass
+     *
+     *  \param[in]   points  random access range of local coordinates or
+     *                       quadrature points
+     *  \param[out]  y       random access iterator to the global coordinates
+     *  \param[out]  jt      random access iterator to the transposed Jacobians
+     *  \param[out]  mu      random access iterator to the integration elements
+     */
+    template< class Points, class GlobalIterator, class JacobianIterator, class IntegrationElementIterator >
+    void evaluate ( const Points &points, GlobalIterator y, JacobianIterator jt, IntegrationElementIterator mu ) const;
+
+    /** \brief evaluate the inverse mapping in a range of points
+     *
+     *  \param[in]   globals  random access range of global coordinates
+     *  \param[out]  x        random access iterator to the local coordinates
+     *
+     *  The result coincides with calling local( y ) for every point y.  The
+     *  damped Newton iterations of a batch of points are run in lockstep, so
+     *  the mapping and its Jacobian are evaluated for all points of the batch
+     *  at once.
+     */
+    template< class GlobalPoints, class LocalIterator >
+    void local ( const GlobalPoints &globals, LocalIterator x ) const;
+
     friend ReferenceElement referenceElement ( const MultiLinearGeometry &geometry )
     {
       return geometry.refElement();
     }
 
   protected:
+    //! number of points evaluated simultaneously by the batched methods
+    static const std::size_t batchSize = 16;
+
+    typedef std::array< ctype, batchSize > BatchScalar;
+    typedef std::array< BatchScalar, mydimension > BatchLocal;
+    typedef std::array< BatchScalar, coorddimension > BatchGlobal;
+
+    //! output iterator discarding everything assigned to it
+    struct NullOutputIterator
+    {
+      struct Sink
+      {
+        template< class T >
+        const Sink &operator= ( const T & ) const { return *this; }
+      };
+
+      Sink operator[] ( std::size_t ) const { return Sink(); }
+    };
+
+    template< class T >
+    static std::false_type isNullOutputIterator ( const T & ) { return {}; }
+    static std::true_type isNullOutputIterator ( const NullOutputIterator & ) { return {}; }
+
+    static const LocalCoordinate &position ( const LocalCoordinate &x ) { return x; }
+
+    template< class QuadraturePoint >
+    static auto position ( const QuadraturePoint &qp ) -> decltype( qp.position() )
+    {
+      return qp.position();
+    }
+
+    template< bool add, int dim, class CornerIterator >
+    static void globalBatch ( TopologyId topologyId, std::integral_constant< int, dim >,
+                              CornerIterator &cit, std::size_t n, const BatchScalar &df, const BatchLocal &x,
+                              const BatchScalar &rf, BatchGlobal &y );
+    template< bool add, class CornerIterator >
+    static void globalBatch ( TopologyId topologyId, std::integral_constant< int, 0 >,
+                              CornerIterator &cit, std::size_t n, const BatchScalar &df, const BatchLocal &x,
+                              const BatchScalar &rf, BatchGlobal &y );
+
+    template< bool add, std::size_t rows, int dim, class CornerIterator >
+    static void jacobianTransposedBatch ( TopologyId topologyId, std::integral_constant< int, dim >,
+                                          CornerIterator &cit, std::size_t n, const BatchScalar &df, const BatchLocal &x,
+                                          const BatchScalar &rf, std::array< BatchGlobal, rows > &jt );
+    template< bool add, std::size_t rows, class CornerIterator >
+    static void jacobianTransposedBatch ( TopologyId topologyId, std::integral_constant< int, 0 >,
+                                          CornerIterator &cit, std::size_t n, const BatchScalar &df, const BatchLocal &x,
+                                          const BatchScalar &rf, std::array< BatchGlobal, rows > &jt );
 
     ReferenceElement refElement () const
     {
@@ -421,6 +709,93 @@ namespace Dune
       return affine( topologyId(), std::integral_constant< int, mydimension >(), cit, jacobianT );
     }
 
+    // cheap test whether a point is certainly outside the geometry
+    bool excludes ( const GlobalCoordinate &globalCoord ) const
+    {
+      const int numCorners = corners();
+      GlobalCoordinate c[ 1 << mydimension ];
+      for( int i = 0; i < numCorners; ++i )
+        c[ i ] = corner( i );
+
+      GlobalCoordinate lower = c[ 0 ], upper = c[ 0 ];
+      for( int i = 1; i < numCorners; ++i )
+      {
+        for( int j = 0; j < coorddimension; ++j )
+        {
+          lower[ j ] = std::min( lower[ j ], c[ i ][ j ] );
+          upper[ j ] = std::max( upper[ j ], c[ i ][ j ] );
+        }
+      }
+
+      const ctype tolerance = Impl::containsTolerance( lower, upper );
+      for( int j = 0; j < coorddimension; ++j )
+      {
+        if( (globalCoord[ j ] < lower[ j ] - tolerance) || (globalCoord[ j ] > upper[ j ] + tolerance) )
+          return true;
+      }
+
+      return excludesByFaces( globalCoord, c, numCorners, tolerance,
+                              std::integral_constant< bool, (mydimension == coorddimension) && (mydimension >= 2) && (mydimension <= 3) >() );
+    }
+
+    // the geometry lies in the slab { x : min_i n.c_i <= n.x <= max_i n.c_i } for any
+    // vector n, so the orientation of the face normals does not matter
+    bool excludesByFaces ( const GlobalCoordinate &globalCoord, const GlobalCoordinate *c, int numCorners,
+                           ctype tolerance, std::true_type ) const
+    {
+      const ReferenceElement &refElement = refElement_;
+      const int numFaces = refElement.size( 1 );
+      for( int f = 0; f < numFaces; ++f )
+      {
+        const GlobalCoordinate n = faceNormal( refElement, c, f, std::integral_constant< int, coorddimension >() );
+        ctype lower = n * c[ 0 ], upper = lower;
+        for( int i = 1; i < numCorners; ++i )
+        {
+          const ctype nc = n * c[ i ];
+          lower = std::min( lower, nc );
+          upper = std::max( upper, nc );
+        }
+        const ctype ny = n * globalCoord;
+        const ctype nTolerance = tolerance * n.two_norm();
+        if( (ny < lower - nTolerance) || (ny > upper + nTolerance) )
+          return true;
+      }
+      return false;
+    }
+
+    bool excludesByFaces ( const GlobalCoordinate &, const GlobalCoordinate *, int, ctype, std::false_type ) const
+    {
+      return false;
+    }
+
+    static GlobalCoordinate faceNormal ( const ReferenceElement &refElement, const GlobalCoordinate *c, int f,
+                                         std::integral_constant< int, 2 > )
+    {
+      const GlobalCoordinate t = c[ refElement.subEntity( f, 1, 1, 2 ) ] - c[ refElement.subEntity( f, 1, 0, 2 ) ];
+      return GlobalCoordinate{ -t[ 1 ], t[ 0 ] };
+    }
+
+    static GlobalCoordinate faceNormal ( const ReferenceElement &refElement, const GlobalCoordinate *c, int f,
+                                         std::integral_constant< int, 3 > )
+    {
+      // use the diagonals for quadrilateral faces
+      const int i0 = refElement.subEntity( f, 1, 0, 3 );
+      const int i1 = refElement.subEntity( f, 1, 1, 3 );
+      const int i2 = refElement.subEntity( f, 1, 2, 3 );
+      const bool quadrilateral = (refElement.size( f, 1, 3 ) == 4);
+      const GlobalCoordinate a = (quadrilateral ? c[ refElement.subEntity( f, 1, 3, 3 ) ] : c[ i1 ]) - c[ i0 ];
+      const GlobalCoordinate b = c[ i2 ] - (quadrilateral ? c[ i1 ] : c[ i0 ]);
+      return GlobalCoordinate{ a[ 1 ]*b[ 2 ] - a[ 2 ]*b[ 1 ], a[ 2 ]*b[ 0 ] - a[ 0 ]*b[ 2 ], a[ 0 ]*b[ 1 ] - a[ 1 ]*b[ 0 ] };
+    }
+
+    // for mydimension < coorddimension, the Newton method only finds the closest point
+    bool onManifold ( const GlobalCoordinate &globalCoord, const LocalCoordinate &local ) const
+    {
+      if( mydimension == coorddimension )
+        return true;
+      return Impl::onManifold( globalCoord, global( local ), corners(), [ this ] ( int i ) { return corner( i ); } );
+    }
+
   private:
     // The following methods are needed to convert the return type of topologyId to
     // unsigned int with g++-4.4. It has problems casting integral_constant to the
@@ -466,199 +841,710 @@ namespace Dune
 
 
 
-  /** \brief Implement a MultiLinearGeometry with additional caching
-   *
-   * This class implements the same interface and functionality as MultiLinearGeometry.
-   * However, it additionally implements caching for various results.
-   *
-   *  \tparam  ct      coordinate type
-   *  \tparam  mydim   geometry dimension
-   *  \tparam  cdim    coordinate dimension
-   *  \tparam  Traits  traits allowing to tweak some implementation details
-   *                   (optional)
-   *
-   */
-  template< class ct, int mydim, int cdim, class Traits = MultiLinearGeometryTraits< ct > >
-  class CachedMultiLinearGeometry
-    : public MultiLinearGeometry< ct, mydim, cdim, Traits >
+  namespace Impl
   {
-    typedef CachedMultiLinearGeometry< ct, mydim, cdim, Traits > This;
-    typedef MultiLinearGeometry< ct, mydim, cdim, Traits > Base;
 
-  protected:
-    typedef typename Base::MatrixHelper MatrixHelper;
+    // EagerCaching
+    // ------------
 
-  public:
-    typedef typename Base::ReferenceElement ReferenceElement;
+    // read the optional eagerCaching flag of the traits, defaulting to false
+    template< class Traits, class = void >
+    struct EagerCaching
+      : public std::false_type
+    {};
 
-    typedef typename Base::ctype ctype;
+    template< class Traits >
+    struct EagerCaching< Traits, void_t< decltype( Traits::eagerCaching ) > >
+      : public std::integral_constant< bool, Traits::eagerCaching >
+    {};
 
-    using Base::mydimension;
-    using Base::coorddimension;
 
-    typedef typename Base::LocalCoordinate LocalCoordinate;
-    typedef typename Base::GlobalCoordinate GlobalCoordinate;
 
-    typedef typename Base::JacobianTransposed JacobianTransposed;
-    typedef typename Base::JacobianInverseTransposed JacobianInverseTransposed;
+    /** \brief CachedMultiLinearGeometry computing the cached data on first use
+     *
+     *  \tparam  ct      coordinate type
+     *  \tparam  mydim   geometry dimension
+     *  \tparam  cdim    coordinate dimension
+     *  \tparam  Traits  traits allowing to tweak some implementation details
+     */
+    template< class ct, int mydim, int cdim, class Traits >
+    class LazyCachedMultiLinearGeometry
+      : public MultiLinearGeometry< ct, mydim, cdim, Traits >
+    {
+      typedef LazyCachedMultiLinearGeometry< ct, mydim, cdim, Traits > This;
+      typedef MultiLinearGeometry< ct, mydim, cdim, Traits > Base;
 
-    template< class CornerStorage >
-    CachedMultiLinearGeometry ( const ReferenceElement &referenceElement, const CornerStorage &cornerStorage )
-      : Base( referenceElement, cornerStorage ),
-        affine_( Base::affine( jacobianTransposed_ ) ),
-        jacobianInverseTransposedComputed_( false ),
-        integrationElementComputed_( false )
-    {}
+    protected:
+      typedef typename Base::MatrixHelper MatrixHelper;
 
-    template< class CornerStorage >
-    CachedMultiLinearGeometry ( Dune::GeometryType gt, const CornerStorage &cornerStorage )
-      : Base( gt, cornerStorage ),
-        affine_( Base::affine( jacobianTransposed_ ) ),
-        jacobianInverseTransposedComputed_( false ),
-        integrationElementComputed_( false )
-    {}
+    public:
+      typedef typename Base::ReferenceElement ReferenceElement;
 
-    /** \brief is this mapping affine? */
-    bool affine () const { return affine_; }
+      typedef typename Base::ctype ctype;
 
-    using Base::corner;
+      using Base::mydimension;
+      using Base::coorddimension;
 
-    /** \brief obtain the centroid of the mapping's image */
-    GlobalCoordinate center () const { return global( refElement().position( 0, 0 ) ); }
+      typedef typename Base::LocalCoordinate LocalCoordinate;
+      typedef typename Base::GlobalCoordinate GlobalCoordinate;
 
-    /** \brief evaluate the mapping
-     *
-     *  \param[in]  local  local coordinate to map
-     *
-     *  \returns corresponding global coordinate
-     */
-    GlobalCoordinate global ( const LocalCoordinate &local ) const
-    {
-      if( affine() )
+      typedef typename Base::JacobianTransposed JacobianTransposed;
+      typedef typename Base::JacobianInverseTransposed JacobianInverseTransposed;
+      typedef typename Base::LocalResult LocalResult;
+
+      template< class CornerStorage >
+      LazyCachedMultiLinearGeometry ( const ReferenceElement &referenceElement, const CornerStorage &cornerStorage )
+        : Base( referenceElement, cornerStorage ),
+          affine_( Base::affine( jacobianTransposed_ ) ),
+          jacobianInverseTransposedComputed_( false ),
+          integrationElementComputed_( false )
+      {}
+
+      template< class CornerStorage >
+      LazyCachedMultiLinearGeometry ( Dune::GeometryType gt, const CornerStorage &cornerStorage )
+        : Base( gt, cornerStorage ),
+          affine_( Base::affine( jacobianTransposed_ ) ),
+          jacobianInverseTransposedComputed_( false ),
+          integrationElementComputed_( false )
+      {}
+
+      /** \brief is this mapping affine? */
+      bool affine () const { return affine_; }
+
+      using Base::corner;
+
+      /** \brief obtain the centroid of the mapping's image */
+      GlobalCoordinate center () const { return global( refElement().position( 0, 0 ) ); }
+
+      /** \brief evaluate the mapping
+       *
+       *  \param[in]  local  local coordinate to map
+       *
+       *  \returns corresponding global coordinate
+       */
+      GlobalCoordinate global ( const LocalCoordinate &local ) const
       {
-        GlobalCoordinate global( corner( 0 ) );
-        jacobianTransposed_.umtv( local, global );
-        return global;
+        if( affine() )
+        {
+          GlobalCoordinate global( corner( 0 ) );
+          jacobianTransposed_.umtv( local, global );
+          return global;
+        }
+        else
+          return Base::global( local );
       }
-      else
-        return Base::global( local );
-    }
 
-    /** \brief evaluate the inverse mapping
-     *
-     *  \param[in]  global  global coordinate to map
-     *
-     *  \return corresponding local coordinate
-     *
-     *  \note For given global coordinate y the returned local coordinate x that minimizes
-     *  the following function over the local coordinate space spanned by the reference element.
-     *  \code
-     *  (global( x ) - y).two_norm()
-     *  \endcode
-     */
-    LocalCoordinate local ( const GlobalCoordinate &global ) const
-    {
-      if( affine() )
+      /** \brief evaluate the inverse mapping
+       *
+       *  \param[in]  global  global coordinate to map
+       *
+       *  \return corresponding local coordinate
+       *
+       *  \note For given global coordinate y the returned local coordinate x that minimizes
+       *  the following function over the local coordinate space spanned by the reference element.
+       *  \code
+       *  (global( x ) - y).two_norm()
+       *  \endcode
+       */
+      LocalCoordinate local ( const GlobalCoordinate &global ) const
       {
-        LocalCoordinate local;
-        if( jacobianInverseTransposedComputed_ )
-          jacobianInverseTransposed_.mtv( global - corner( 0 ), local );
+        if( affine() )
+        {
+          LocalCoordinate local;
+          if( jacobianInverseTransposedComputed_ )
+            jacobianInverseTransposed_.mtv( global - corner( 0 ), local );
+          else
+            MatrixHelper::template xTRightInvA< mydimension, coorddimension >( jacobianTransposed_, global - corner( 0 ), local );
+          return local;
+        }
         else
-          MatrixHelper::template xTRightInvA< mydimension, coorddimension >( jacobianTransposed_, global - corner( 0 ), local );
-        return local;
+          return Base::local( global );
       }
-      else
-        return Base::local( global );
-    }
 
-    /** \brief obtain the integration element
-     *
-     *  If the Jacobian of the mapping is denoted by $J(x)$, the integration
-     *  integration element \f$\mu(x)\f$ is given by
-     *  \f[ \mu(x) = \sqrt{|\det (J^T(x) J(x))|}.\f]
-     *
-     *  \param[in]  local  local coordinate to evaluate the integration element in
-     *
-     *  \returns the integration element \f$\mu(x)\f$.
-     *
-     *  \note For affine mappings, it is more efficient to call
-     *        jacobianInverseTransposed before integrationElement, if both
-     *        are required.
-     */
-    ctype integrationElement ( const LocalCoordinate &local ) const
-    {
-      if( affine() )
+      /** \brief evaluate the inverse mapping and report whether it succeeded
+       *
+       *  \param[in]  global  global coordinate to map
+       *
+       *  \return the local coordinate computed by local() together with a status
+       *
+       *  For affine mappings, no Newton iteration is required.
+       */
+      LocalResult tryLocal ( const GlobalCoordinate &global ) const
       {
-        if( !integrationElementComputed_ )
+        if( affine() )
         {
-          jacobianInverseTransposed_.setupDeterminant( jacobianTransposed_ );
-          integrationElementComputed_ = true;
+          LocalResult result;
+          result.local = local( global );
+          result.converged = true;
+          result.inside = refElement().checkInside( result.local );
+          result.iterations = 0;
+          return result;
         }
-        return jacobianInverseTransposed_.detInv();
+        else
+          return Base::tryLocal( global );
       }
-      else
-        return Base::integrationElement( local );
-    }
-
-    /** \brief obtain the volume of the mapping's image */
-    ctype volume () const
-    {
-      if( affine() )
-        return integrationElement( refElement().position( 0, 0 ) ) * refElement().volume();
-      else
-        return Base::volume();
-    }
-
-    /** \brief obtain the transposed of the Jacobian
-     *
-     *  \param[in]  local  local coordinate to evaluate Jacobian in
-     *
-     *  \returns a reference to the transposed of the Jacobian
-     *
-     *  \note The returned reference is reused on the next call to
-     *        JacobianTransposed, destroying the previous value.
-     */
-    JacobianTransposed jacobianTransposed ( const LocalCoordinate &local ) const
-    {
-      if( affine() )
-        return jacobianTransposed_;
-      else
-        return Base::jacobianTransposed( local );
-    }
 
-    /** \brief obtain the transposed of the Jacobian's inverse
-     *
-     *  The Jacobian's inverse is defined as a pseudo-inverse. If we denote
-     *  the Jacobian by \f$J(x)\f$, the following condition holds:
-     *  \f[J^{-1}(x) J(x) = I.\f]
-     */
-    JacobianInverseTransposed jacobianInverseTransposed ( const LocalCoordinate &local ) const
-    {
-      if( affine() )
+      /** \brief check whether a global coordinate lies inside the geometry
+       *
+       *  \param[in]   global  global coordinate to check
+       *  \param[out]  local   corresponding local coordinate, only set if the
+       *                       point lies inside
+       *
+       *  For affine mappings, computing the local coordinate is cheaper than the
+       *  geometric rejection tests, so it is computed directly.
+       */
+      bool contains ( const GlobalCoordinate &global, LocalCoordinate &local ) const
       {
-        if( !jacobianInverseTransposedComputed_ )
+        if( affine() )
         {
-          jacobianInverseTransposed_.setup( jacobianTransposed_ );
-          jacobianInverseTransposedComputed_ = true;
-          integrationElementComputed_ = true;
+          const LocalCoordinate x = (*this).local( global );
+          if( !refElement().checkInside( x ) || !Base::onManifold( global, x ) )
+            return false;
+          local = x;
+          return true;
         }
-        return jacobianInverseTransposed_;
+        else
+          return Base::contains( global, local );
       }
-      else
-        return Base::jacobianInverseTransposed( local );
-    }
-
-  protected:
-    using Base::refElement;
 
-  private:
-    mutable JacobianTransposed jacobianTransposed_;
-    mutable JacobianInverseTransposed jacobianInverseTransposed_;
+      /** \brief check whether a global coordinate lies inside the geometry */
+      bool contains ( const GlobalCoordinate &global ) const
+      {
+        LocalCoordinate local;
+        return contains( global, local );
+      }
+
+      /** \brief obtain the integration element
+       *
+       *  If the Jacobian of the mapping is denoted by $J(x)$, the integration
+       *  integration element \f$\mu(x)\f$ is given by
+       *  \f[ \mu(x) = \sqrt{|\det (J^T(x) J(x))|}.\f]
+       *
+       *  \param[in]  local  local coordinate to evaluate the integration element in
+       *
+       *  \returns the integration element \f$\mu(x)\f$.
+       *
+       *  \note For affine mappings, it is more efficient to call
+       *        jacobianInverseTransposed before integrationElement, if both
+       *        are required.
+       */
+      ctype integrationElement ( const LocalCoordinate &local ) const
+      {
+        if( affine() )
+        {
+          if( !integrationElementComputed_ )
+          {
+            jacobianInverseTransposed_.setupDeterminant( jacobianTransposed_ );
+            integrationElementComputed_ = true;
+          }
+          return jacobianInverseTransposed_.detInv();
+        }
+        else
+          return Base::integrationElement( local );
+      }
+
+      /** \brief obtain the volume of the mapping's image */
+      ctype volume () const
+      {
+        if( affine() )
+          return integrationElement( refElement().position( 0, 0 ) ) * refElement().volume();
+        else
+          return Base::volume();
+      }
+
+      /** \brief obtain the transposed of the Jacobian
+       *
+       *  \param[in]  local  local coordinate to evaluate Jacobian in
+       *
+       *  \returns a reference to the transposed of the Jacobian
+       *
+       *  \note The returned reference is reused on the next call to
+       *        JacobianTransposed, destroying the previous value.
+       */
+      JacobianTransposed jacobianTransposed ( const LocalCoordinate &local ) const
+      {
+        if( affine() )
+          return jacobianTransposed_;
+        else
+          return Base::jacobianTransposed( local );
+      }
+
+      /** \brief obtain the transposed of the Jacobian's inverse
+       *
+       *  The Jacobian's inverse is defined as a pseudo-inverse. If we denote
+       *  the Jacobian by \f$J(x)\f$, the following condition holds:
+       *  \f[J^{-1}(x) J(x) = I.\f]
+       */
+      JacobianInverseTransposed jacobianInverseTransposed ( const LocalCoordinate &local ) const
+      {
+        if( affine() )
+        {
+          if( !jacobianInverseTransposedComputed_ )
+          {
+            jacobianInverseTransposed_.setup( jacobianTransposed_ );
+            jacobianInverseTransposedComputed_ = true;
+            integrationElementComputed_ = true;
+          }
+          return jacobianInverseTransposed_;
+        }
+        else
+          return Base::jacobianInverseTransposed( local );
+      }
+
+      /** \brief evaluate the mapping in a range of points
+       *
+       *  \param[in]   points  random access range of local coordinates or
+       *                       quadrature points
+       *  \param[out]  y       random access iterator to the global coordinates
+       */
+      template< class Points, class GlobalIterator >
+      void global ( const Points &points, GlobalIterator y ) const
+      {
+        evaluate( points, y, NullOutputIterator(), NullOutputIterator() );
+      }
+
+      /** \brief evaluate the transposed of the Jacobian in a range of points
+       *
+       *  \param[in]   points  random access range of local coordinates or
+       *                       quadrature points
+       *  \param[out]  jt      random access iterator to the transposed Jacobians
+       */
+      template< class Points, class JacobianIterator >
+      void jacobianTransposed ( const Points &points, JacobianIterator jt ) const
+      {
+        evaluate( points, NullOutputIterator(), jt, NullOutputIterator() );
+      }
+
+      /** \brief obtain the integration element in a range of points
+       *
+       *  \param[in]   points  random access range of local coordinates or
+       *                       quadrature points
+       *  \param[out]  mu      random access iterator to the integration elements
+       */
+      template< class Points, class IntegrationElementIterator >
+      void integrationElement ( const Points &points, IntegrationElementIterator mu ) const
+      {
+        evaluate( points, NullOutputIterator(), NullOutputIterator(), mu );
+      }
+
+      /** \brief evaluate mapping, Jacobian and integration element in a range
+       *         of points in one pass
+       *
+       *  For affine geometries, the cached Jacobian is used for all points.
+       */
+      template< class Points, class GlobalIterator, class JacobianIterator, class IntegrationElementIterator >
+      void evaluate ( const Points &points, GlobalIterator y, JacobianIterator jt, IntegrationElementIterator mu ) const
+      {
+        if( !affine() )
+          return Base::evaluate( points, y, jt, mu );
+
+        const ctype detJ = integrationElement( refElement().position( 0, 0 ) );
+        const GlobalCoordinate origin = corner( 0 );
+        const std::size_t size = points.size();
+        for( std::size_t q = 0; q < size; ++q )
+        {
+          GlobalCoordinate yq( origin );
+          jacobianTransposed_.umtv( Base::position( points[ q ] ), yq );
+          y[ q ] = yq;
+          jt[ q ] = jacobianTransposed_;
+          mu[ q ] = detJ;
+        }
+      }
+
+      /** \brief evaluate the inverse mapping in a range of points
+       *
+       *  \param[in]   globals  random access range of global coordinates
+       *  \param[out]  x        random access iterator to the local coordinates
+       *
+       *  For affine mappings, the Jacobian is inverted once and applied to all
+       *  points.
+       */
+      template< class GlobalPoints, class LocalIterator >
+      void local ( const GlobalPoints &globals, LocalIterator x ) const
+      {
+        if( !affine() )
+          return Base::local( globals, x );
+
+        const FieldMatrix< ctype, coorddimension, mydimension > jit = jacobianInverseTransposed( refElement().position( 0, 0 ) );
+        Impl::affineLocal( corner( 0 ), jit, globals, x );
+      }
+
+    protected:
+      using Base::refElement;
+      using typename Base::NullOutputIterator;
+
+    private:
+      mutable JacobianTransposed jacobianTransposed_;
+      mutable JacobianInverseTransposed jacobianInverseTransposed_;
+
+      mutable bool affine_ : 1;
+
+      mutable bool jacobianInverseTransposedComputed_ : 1;
+      mutable bool integrationElementComputed_ : 1;
+    };
+
+
+
+    /** \brief CachedMultiLinearGeometry with compact eager storage
+     *
+     *  Selected by MultiLinearGeometryTraits::eagerCaching.  An affine mapping
+     *  is stored like an AffineGeometry: its origin, the Jacobian, its inverse
+     *  and the integration element are computed in the constructor and the
+     *  corners are not kept.  A non-affine mapping is delegated to a
+     *  MultiLinearGeometry stored inline, in the memory of the affine data,
+     *  so no allocation happens beyond the corner storage of the traits.
+     *
+     *  Whether a mapping is affine is only known at run time, so every method
+     *  still branches on affine().  The branch is well predicted on meshes of
+     *  mostly affine elements; meshes of affine elements only should use
+     *  AffineGeometry, which has no branch at all.
+     *
+     *  \tparam  ct      coordinate type
+     *  \tparam  mydim   geometry dimension
+     *  \tparam  cdim    coordinate dimension
+     *  \tparam  Traits  traits allowing to tweak some implementation details
+     */
+    template< class ct, int mydim, int cdim, class Traits >
+    class CompactCachedMultiLinearGeometry
+    {
+      typedef CompactCachedMultiLinearGeometry< ct, mydim, cdim, Traits > This;
+      typedef MultiLinearGeometry< ct, mydim, cdim, Traits > Base;
+
+    public:
+      typedef typename Base::ReferenceElement ReferenceElement;
+
+      typedef typename Base::ctype ctype;
+
+      static const int mydimension = Base::mydimension;
+      static const int coorddimension = Base::coorddimension;
+
+      typedef typename Base::LocalCoordinate LocalCoordinate;
+      typedef typename Base::GlobalCoordinate GlobalCoordinate;
+
+      typedef typename Base::JacobianTransposed JacobianTransposed;
+      typedef typename Base::JacobianInverseTransposed JacobianInverseTransposed;
+      typedef typename Base::LocalResult LocalResult;
+
+    private:
+      // gives access to the protected helpers of MultiLinearGeometry
+      struct Mapping
+        : public Base
+      {
+        template< class Element, class CornerStorage >
+        Mapping ( const Element &element, const CornerStorage &cornerStorage )
+          : Base( element, cornerStorage )
+        {}
+
+        using Base::affine;
+        using Base::position;
+        using typename Base::NullOutputIterator;
+      };
+
+      struct AffineData
+      {
+        GlobalCoordinate origin;
+        JacobianTransposed jacobianTransposed;
+        JacobianInverseTransposed jacobianInverseTransposed;
+      };
+
+    public:
+      template< class CornerStorage >
+      CompactCachedMultiLinearGeometry ( const ReferenceElement &referenceElement, const CornerStorage &cornerStorage )
+      {
+        setup( Mapping( referenceElement, cornerStorage ) );
+      }
+
+      template< class CornerStorage >
+      CompactCachedMultiLinearGeometry ( Dune::GeometryType gt, const CornerStorage &cornerStorage )
+      {
+        setup( Mapping( gt, cornerStorage ) );
+      }
+
+      CompactCachedMultiLinearGeometry ( const This &other )
+        : refElement_( other.refElement_ )
+      {
+        if( other.affine() )
+          new (&affine_) AffineData( other.affine_ );
+        else
+          new (&nonAffine_) Mapping( other.nonAffine_ );
+      }
+
+      //! a moved-from geometry may only be destroyed or assigned to
+      CompactCachedMultiLinearGeometry ( This &&other ) noexcept
+        : refElement_( other.refElement_ )
+      {
+        if( other.affine() )
+          new (&affine_) AffineData( other.affine_ );
+        else
+          new (&nonAffine_) Mapping( std::move( other.nonAffine_ ) );
+      }
+
+      ~CompactCachedMultiLinearGeometry ()
+      {
+        if( !affine() )
+          nonAffine_.~Mapping();
+      }
+
+      This &operator= ( const This &other )
+      {
+        // copy first, so *this is unchanged if copying the corners throws
+        if( this != &other )
+          *this = This( other );
+        return *this;
+      }
+
+      This &operator= ( This &&other ) noexcept
+      {
+        if( this != &other )
+        {
+          if( !affine() )
+            nonAffine_.~Mapping();
+          refElement_ = other.refElement_;
+          if( other.affine() )
+            new (&affine_) AffineData( other.affine_ );
+          else
+            new (&nonAffine_) Mapping( std::move( other.nonAffine_ ) );
+        }
+        return *this;
+      }
+
+      /** \brief is this mapping affine? */
+      bool affine () const { return (refElement_ != ReferenceElement()); }
+
+      /** \brief obtain the name of the reference element */
+      Dune::GeometryType type () const { return refElement().type(); }
+
+      /** \brief obtain number of corners of the corresponding reference element */
+      int corners () const { return refElement().size( mydimension ); }
+
+      /** \brief obtain coordinates of the i-th corner */
+      GlobalCoordinate corner ( int i ) const
+      {
+        assert( (i >= 0) && (i < corners()) );
+        return (affine() ? global( refElement_.position( i, mydimension ) ) : nonAffine_.corner( i ));
+      }
+
+      /** \brief obtain the centroid of the mapping's image */
+      GlobalCoordinate center () const { return global( refElement().position( 0, 0 ) ); }
+
+      /** \brief evaluate the mapping */
+      GlobalCoordinate global ( const LocalCoordinate &local ) const
+      {
+        if( !affine() )
+          return nonAffine_.global( local );
+
+        GlobalCoordinate global( affine_.origin );
+        affine_.jacobianTransposed.umtv( local, global );
+        return global;
+      }
+
+      /** \brief evaluate the inverse mapping */
+      LocalCoordinate local ( const GlobalCoordinate &global ) const
+      {
+        if( !affine() )
+          return nonAffine_.local( global );
+
+        LocalCoordinate local;
+        affine_.jacobianInverseTransposed.mtv( global - affine_.origin, local );
+        return local;
+      }
+
+      /** \brief evaluate the inverse mapping and report whether it succeeded */
+      LocalResult tryLocal ( const GlobalCoordinate &global ) const
+      {
+        if( !affine() )
+          return nonAffine_.tryLocal( global );
+
+        LocalResult result;
+        result.local = local( global );
+        result.converged = true;
+        result.inside = refElement_.checkInside( result.local );
+        result.iterations = 0;
+        return result;
+      }
+
+      /** \brief check whether a global coordinate lies inside the geometry
+       *
+       *  \param[in]   global  global coordinate to check
+       *  \param[out]  local   corresponding local coordinate, only set if the
+       *                       point lies inside
+       */
+      bool contains ( const GlobalCoordinate &global, LocalCoordinate &local ) const
+      {
+        if( !affine() )
+          return nonAffine_.contains( global, local );
+
+        const LocalCoordinate x = (*this).local( global );
+        if( !refElement_.checkInside( x ) || !onManifold( global, x ) )
+          return false;
+        local = x;
+        return true;
+      }
+
+      /** \brief check whether a global coordinate lies inside the geometry */
+      bool contains ( const GlobalCoordinate &global ) const
+      {
+        LocalCoordinate local;
+        return contains( global, local );
+      }
+
+      /** \brief obtain the integration element */
+      ctype integrationElement ( const LocalCoordinate &local ) const
+      {
+        return (affine() ? affine_.jacobianInverseTransposed.detInv() : nonAffine_.integrationElement( local ));
+      }
+
+      /** \brief obtain the volume of the mapping's image */
+      ctype volume () const
+      {
+        return (affine() ? affine_.jacobianInverseTransposed.detInv() * refElement_.volume() : nonAffine_.volume());
+      }
+
+      /** \brief obtain the transposed of the Jacobian */
+      JacobianTransposed jacobianTransposed ( const LocalCoordinate &local ) const
+      {
+        return (affine() ? affine_.jacobianTransposed : nonAffine_.jacobianTransposed( local ));
+      }
+
+      /** \brief obtain the transposed of the Jacobian's inverse */
+      JacobianInverseTransposed jacobianInverseTransposed ( const LocalCoordinate &local ) const
+      {
+        return (affine() ? affine_.jacobianInverseTransposed : nonAffine_.jacobianInverseTransposed( local ));
+      }
+
+      /** \brief evaluate the mapping in a range of points */
+      template< class Points, class GlobalIterator >
+      void global ( const Points &points, GlobalIterator y ) const
+      {
+        evaluate( points, y, NullOutputIterator(), NullOutputIterator() );
+      }
+
+      /** \brief evaluate the transposed of the Jacobian in a range of points */
+      template< class Points, class JacobianIterator >
+      void jacobianTransposed ( const Points &points, JacobianIterator jt ) const
+      {
+        evaluate( points, NullOutputIterator(), jt, NullOutputIterator() );
+      }
+
+      /** \brief obtain the integration element in a range of points */
+      template< class Points, class IntegrationElementIterator >
+      void integrationElement ( const Points &points, IntegrationElementIterator mu ) const
+      {
+        evaluate( points, NullOutputIterator(), NullOutputIterator(), mu );
+      }
+
+      /** \brief evaluate mapping, Jacobian and integration element in a range
+       *         of points in one pass
+       */
+      template< class Points, class GlobalIterator, class JacobianIterator, class IntegrationElementIterator >
+      void evaluate ( const Points &points, GlobalIterator y, JacobianIterator jt, IntegrationElementIterator mu ) const
+      {
+        if( !affine() )
+          return nonAffine_.evaluate( points, y, jt, mu );
+
+        const ctype detJ = affine_.jacobianInverseTransposed.detInv();
+        const std::size_t size = points.size();
+        for( std::size_t q = 0; q < size; ++q )
+        {
+          GlobalCoordinate yq( affine_.origin );
+          affine_.jacobianTransposed.umtv( Mapping::position( points[ q ] ), yq );
+          y[ q ] = yq;
+          jt[ q ] = affine_.jacobianTransposed;
+          mu[ q ] = detJ;
+        }
+      }
+
+      /** \brief evaluate the inverse mapping in a range of points */
+      template< class GlobalPoints, class LocalIterator >
+      void local ( const GlobalPoints &globals, LocalIterator x ) const
+      {
+        if( !affine() )
+          return nonAffine_.local( globals, x );
+
+        Impl::affineLocal( affine_.origin, affine_.jacobianInverseTransposed, globals, x );
+      }
 
-    mutable bool affine_ : 1;
+      friend ReferenceElement referenceElement ( const CompactCachedMultiLinearGeometry &geometry )
+      {
+        return geometry.refElement();
+      }
+
+    protected:
+      typedef typename Mapping::NullOutputIterator NullOutputIterator;
+
+      ReferenceElement refElement () const
+      {
+        return (affine() ? refElement_ : referenceElement( nonAffine_ ));
+      }
+
+    private:
+      void setup ( Mapping &&mapping )
+      {
+        JacobianTransposed jt;
+        if( mapping.affine( jt ) )
+        {
+          refElement_ = referenceElement( mapping );
+          new (&affine_) AffineData();
+          affine_.origin = mapping.corner( 0 );
+          affine_.jacobianTransposed = jt;
+          affine_.jacobianInverseTransposed.setup( jt );
+        }
+        else
+          new (&nonAffine_) Mapping( std::move( mapping ) );
+      }
+
+      // for mydimension < coorddimension, local() only finds the closest point
+      bool onManifold ( const GlobalCoordinate &globalCoord, const LocalCoordinate &local ) const
+      {
+        if( mydimension == coorddimension )
+          return true;
+        return Impl::onManifold( globalCoord, global( local ), corners(), [ this ] ( int i ) { return corner( i ); } );
+      }
+
+      // only valid for affine mappings, the reference element of other
+      // mappings is held by nonAffine_
+      ReferenceElement refElement_;
+      union
+      {
+        AffineData affine_;
+        Mapping nonAffine_;
+      };
+    };
+
+  } // namespace Impl
+
+
+
+  // CachedMultiLinearGeometry
+  // -------------------------
+
+  /** \brief Implement a MultiLinearGeometry with additional caching
+   *
+   * This class implements the same interface and functionality as MultiLinearGeometry.
+   * However, it additionally implements caching for various results.
+   *
+   *  \tparam  ct      coordinate type
+   *  \tparam  mydim   geometry dimension
+   *  \tparam  cdim    coordinate dimension
+   *  \tparam  Traits  traits allowing to tweak some implementation details
+   *                   (optional)
+   *
+   *  By default, the cached data is computed on first use.  If the traits
+   *  set eagerCaching to true, a compact storage computing everything in the
+   *  constructor is used instead, see MultiLinearGeometryTraits::eagerCaching.
+   */
+  template< class ct, int mydim, int cdim, class Traits = MultiLinearGeometryTraits< ct > >
+  class CachedMultiLinearGeometry
+    : public std::conditional< Impl::EagerCaching< Traits >::value,
+                               Impl::CompactCachedMultiLinearGeometry< ct, mydim, cdim, Traits >,
+                               Impl::LazyCachedMultiLinearGeometry< ct, mydim, cdim, Traits > >::type
+  {
+    typedef typename std::conditional< Impl::EagerCaching< Traits >::value,
+                                       Impl::CompactCachedMultiLinearGeometry< ct, mydim, cdim, Traits >,
+                                       Impl::LazyCachedMultiLinearGeometry< ct, mydim, cdim, Traits > >::type Base;
 
-    mutable bool jacobianInverseTransposedComputed_ : 1;
-    mutable bool integrationElementComputed_ : 1;
+  public:
+    using Base::Base;
   };
 
 
@@ -835,6 +1721,381 @@ namespace Dune
 
 
 
+  template< class ct, int mydim, int cdim, class Traits >
+  template< class Points, class GlobalIterator, class JacobianIterator, class IntegrationElementIterator >
+  inline void MultiLinearGeometry< ct, mydim, cdim, Traits >
+  ::evaluate ( const Points &points, GlobalIterator y, JacobianIterator jt, IntegrationElementIterator mu ) const
+  {
+    using std::begin;
+
+    const bool needGlobal = !decltype( isNullOutputIterator( y ) )::value;
+    const bool needJacobian = !(decltype( isNullOutputIterator( jt ) )::value && decltype( isNullOutputIterator( mu ) )::value);
+
+    BatchScalar one;
+    std::fill( one.begin(), one.end(), ctype( 1 ) );
+
+    const std::size_t size = points.size();
+    for( std::size_t first = 0; first < size; first += batchSize )
+    {
+      const std::size_t n = std::min( batchSize, size - first );
+
+      // transpose the local coordinates of this batch
+      BatchLocal x;
+      for( std::size_t q = 0; q < n; ++q )
+      {
+        const LocalCoordinate &xq = position( points[ first+q ] );
+        for( int k = 0; k < mydimension; ++k )
+          x[ k ][ q ] = xq[ k ];
+      }
+
+      if( needGlobal )
+      {
+        BatchGlobal yBatch;
+        auto cit = begin(std::cref(corners_).get());
+        globalBatch< false >( topologyId(), std::integral_constant< int, mydimension >(), cit, n, one, x, one, yBatch );
+        for( std::size_t q = 0; q < n; ++q )
+        {
+          GlobalCoordinate yq;
+          for( int i = 0; i < coorddimension; ++i )
+            yq[ i ] = yBatch[ i ][ q ];
+          y[ first+q ] = yq;
+        }
+      }
+
+      if( needJacobian )
+      {
+        std::array< BatchGlobal, mydimension > jtBatch;
+        auto cit = begin(std::cref(corners_).get());
+        jacobianTransposedBatch< false >( topologyId(), std::integral_constant< int, mydimension >(), cit, n, one, x, one, jtBatch );
+        for( std::size_t q = 0; q < n; ++q )
+        {
+          JacobianTransposed jtq;
+          for( int j = 0; j < mydimension; ++j )
+            for( int i = 0; i < coorddimension; ++i )
+              jtq[ j ][ i ] = jtBatch[ j ][ i ][ q ];
+          if( !decltype( isNullOutputIterator( mu ) )::value )
+            mu[ first+q ] = MatrixHelper::template sqrtDetAAT< mydimension, coorddimension >( jtq );
+          jt[ first+q ] = jtq;
+        }
+      }
+    }
+  }
+
+
+  template< class ct, int mydim, int cdim, class Traits >
+  template< class GlobalPoints, class LocalIterator >
+  inline void MultiLinearGeometry< ct, mydim, cdim, Traits >
+  ::local ( const GlobalPoints &globals, LocalIterator x ) const
+  {
+    using std::begin;
+
+    const ctype tolerance = Traits::tolerance();
+    const ctype minDamping = Impl::NewtonMinDamping< ctype, Traits >::get();
+    const int maxIterations = Impl::NewtonMaxIterations< ctype, Traits >::get();
+    const LocalCoordinate &center = refElement().position( 0, 0 );
+
+    BatchScalar one;
+    std::fill( one.begin(), one.end(), ctype( 1 ) );
+
+    const std::size_t size = globals.size();
+    for( std::size_t first = 0; first < size; first += batchSize )
+    {
+      const std::size_t n = std::min( batchSize, size - first );
+
+      // transpose the global coordinates of this batch
+      BatchGlobal target;
+      for( std::size_t q = 0; q < n; ++q )
+      {
+        const GlobalCoordinate &yq = globals[ first+q ];
+        for( int i = 0; i < coorddimension; ++i )
+          target[ i ][ q ] = yq[ i ];
+      }
+
+      BatchLocal xb, xNew, dx;
+      for( int k = 0; k < mydimension; ++k )
+        std::fill( xb[ k ].begin(), xb[ k ].end(), center[ k ] );
+
+      BatchGlobal residual;
+      BatchScalar residualNorm2;
+      auto evaluateResidual = [ this, &one, &target, n ] ( const BatchLocal &xr, BatchGlobal &r, BatchScalar &r2 ) {
+        auto cit = begin(std::cref(corners_).get());
+        globalBatch< false >( topologyId(), std::integral_constant< int, mydimension >(), cit, n, one, xr, one, r );
+        std::fill( r2.begin(), r2.end(), ctype( 0 ) );
+        for( int i = 0; i < coorddimension; ++i )
+          for( std::size_t q = 0; q < n; ++q )
+          {
+            r[ i ][ q ] -= target[ i ][ q ];
+            r2[ q ] += r[ i ][ q ] * r[ i ][ q ];
+          }
+      };
+      evaluateResidual( xb, residual, residualNorm2 );
+
+      // points drop out of the lockstep iteration once they converged or stalled
+      std::array< bool, batchSize > active;
+      std::fill( active.begin(), active.end(), false );
+      std::fill( active.begin(), active.begin() + n, true );
+      std::size_t numActive = n;
+      for( int iteration = 0; (iteration < maxIterations) && (numActive > 0); ++iteration )
+      {
+        // Newton's method: DF^n dx^n = F^n, x^{n+1} = x^n - lambda^n dx^n
+        std::array< BatchGlobal, mydimension > jtBatch;
+        auto cit = begin(std::cref(corners_).get());
+        jacobianTransposedBatch< false >( topologyId(), std::integral_constant< int, mydimension >(), cit, n, one, xb, one, jtBatch );
+
+        std::array< bool, batchSize > converged;
+        BatchScalar lambda;
+        for( std::size_t q = 0; q < n; ++q )
+        {
+          converged[ q ] = false;
+          lambda[ q ] = ctype( 0 );
+          LocalCoordinate dxq( 0 );
+          if( active[ q ] )
+          {
+            JacobianTransposed jtq;
+            GlobalCoordinate rq;
+            for( int i = 0; i < coorddimension; ++i )
+            {
+              for( int j = 0; j < mydimension; ++j )
+                jtq[ j ][ i ] = jtBatch[ j ][ i ][ q ];
+              rq[ i ] = residual[ i ][ q ];
+            }
+            MatrixHelper::template xTRightInvA< mydimension, coorddimension >( jtq, rq, dxq );
+            const ctype dxNorm2 = dxq.two_norm2();
+            if( dxNorm2 < std::numeric_limits< ctype >::infinity() )
+            {
+              lambda[ q ] = ctype( 1 );
+              converged[ q ] = (dxNorm2 <= tolerance);
+            }
+            else
+            {
+              dxq = ctype( 0 );
+              active[ q ] = false;
+              --numActive;
+            }
+          }
+          for( int k = 0; k < mydimension; ++k )
+            dx[ k ][ q ] = dxq[ k ];
+        }
+
+        // line search, run in lockstep for all points that did not accept a step yet
+        BatchGlobal residualNew;
+        BatchScalar residualNewNorm2;
+        std::array< bool, batchSize > searching = active;
+        std::size_t numSearching = numActive;
+        while( numSearching > 0 )
+        {
+          for( int k = 0; k < mydimension; ++k )
+            for( std::size_t q = 0; q < n; ++q )
+              xNew[ k ][ q ] = xb[ k ][ q ] - lambda[ q ] * dx[ k ][ q ];
+          evaluateResidual( xNew, residualNew, residualNewNorm2 );
+
+          for( std::size_t q = 0; q < n; ++q )
+          {
+            if( !searching[ q ] )
+              continue;
+            // the first step from the barycenter is the affine guess, take it undamped
+            if( (iteration == 0) || (residualNewNorm2[ q ] < residualNorm2[ q ]) )
+            {
+              for( int k = 0; k < mydimension; ++k )
+                xb[ k ][ q ] = xNew[ k ][ q ];
+              for( int i = 0; i < coorddimension; ++i )
+                residual[ i ][ q ] = residualNew[ i ][ q ];
+              residualNorm2[ q ] = residualNewNorm2[ q ];
+              searching[ q ] = false;
+              --numSearching;
+            }
+            else if( lambda[ q ] > minDamping )
+              lambda[ q ] *= ctype( 0.5 );
+            else
+            {
+              // no descent even for the smallest damping factor, stop iterating this point
+              searching[ q ] = false;
+              --numSearching;
+              active[ q ] = false;
+              --numActive;
+              lambda[ q ] = ctype( 0 );
+            }
+          }
+        }
+
+        for( std::size_t q = 0; q < n; ++q )
+        {
+          if( converged[ q ] && active[ q ] )
+          {
+            active[ q ] = false;
+            --numActive;
+          }
+        }
+      }
+
+      for( std::size_t q = 0; q < n; ++q )
+      {
+        LocalCoordinate xq;
+        for( int k = 0; k < mydimension; ++k )
+          xq[ k ] = xb[ k ][ q ];
+        x[ first+q ] = xq;
+      }
+    }
+  }
+
+
+  template< class ct, int mydim, int cdim, class Traits >
+  template< bool add, int dim, class CornerIterator >
+  inline void MultiLinearGeometry< ct, mydim, cdim, Traits >
+  ::globalBatch ( TopologyId topologyId, std::integral_constant< int, dim >,
+                  CornerIterator &cit, std::size_t n, const BatchScalar &df, const BatchLocal &x,
+                  const BatchScalar &rf, BatchGlobal &y )
+  {
+    BatchScalar xn, cxn;
+    for( std::size_t q = 0; q < n; ++q )
+    {
+      xn[ q ] = df[ q ]*x[ dim-1 ][ q ];
+      cxn[ q ] = ctype( 1 ) - xn[ q ];
+    }
+
+    BatchScalar rfb;
+    if( Impl::isPrism( toUnsignedInt(topologyId), mydimension, mydimension-dim ) )
+    {
+      // apply (1-xn) times mapping for bottom
+      for( std::size_t q = 0; q < n; ++q )
+        rfb[ q ] = rf[ q ]*cxn[ q ];
+      globalBatch< add >( topologyId, std::integral_constant< int, dim-1 >(), cit, n, df, x, rfb, y );
+      // apply xn times mapping for top
+      for( std::size_t q = 0; q < n; ++q )
+        rfb[ q ] = rf[ q ]*xn[ q ];
+      globalBatch< true >( topologyId, std::integral_constant< int, dim-1 >(), cit, n, df, x, rfb, y );
+    }
+    else
+    {
+      assert( Impl::isPyramid( toUnsignedInt(topologyId), mydimension, mydimension-dim ) );
+      // apply (1-xn) times mapping for bottom (with argument x/(1-xn))
+      BatchScalar dfb;
+      for( std::size_t q = 0; q < n; ++q )
+      {
+        const bool regular = (cxn[ q ] > Traits::tolerance() || cxn[ q ] < -Traits::tolerance());
+        dfb[ q ] = (regular ? df[ q ] / cxn[ q ] : df[ q ]);
+        rfb[ q ] = (regular ? rf[ q ]*cxn[ q ] : ctype( 0 ));
+      }
+      globalBatch< add >( topologyId, std::integral_constant< int, dim-1 >(), cit, n, dfb, x, rfb, y );
+      // apply xn times the tip
+      const GlobalCoordinate &tip = *cit;
+      for( int i = 0; i < coorddimension; ++i )
+        for( std::size_t q = 0; q < n; ++q )
+          y[ i ][ q ] += rf[ q ]*xn[ q ]*tip[ i ];
+      ++cit;
+    }
+  }
+
+  template< class ct, int mydim, int cdim, class Traits >
+  template< bool add, class CornerIterator >
+  inline void MultiLinearGeometry< ct, mydim, cdim, Traits >
+  ::globalBatch ( TopologyId topologyId, std::integral_constant< int, 0 >,
+                  CornerIterator &cit, std::size_t n, const BatchScalar &df, const BatchLocal &x,
+                  const BatchScalar &rf, BatchGlobal &y )
+  {
+    const GlobalCoordinate &origin = *cit;
+    ++cit;
+    for( int i = 0; i < coorddimension; ++i )
+      for( std::size_t q = 0; q < n; ++q )
+        y[ i ][ q ] = (add ? y[ i ][ q ] + rf[ q ]*origin[ i ] : rf[ q ]*origin[ i ]);
+  }
+
+
+  template< class ct, int mydim, int cdim, class Traits >
+  template< bool add, std::size_t rows, int dim, class CornerIterator >
+  inline void MultiLinearGeometry< ct, mydim, cdim, Traits >
+  ::jacobianTransposedBatch ( TopologyId topologyId, std::integral_constant< int, dim >,
+                              CornerIterator &cit, std::size_t n, const BatchScalar &df, const BatchLocal &x,
+                              const BatchScalar &rf, std::array< BatchGlobal, rows > &jt )
+  {
+    assert( rows >= std::size_t( dim ) );
+
+    BatchScalar xn, cxn;
+    for( std::size_t q = 0; q < n; ++q )
+    {
+      xn[ q ] = df[ q ]*x[ dim-1 ][ q ];
+      cxn[ q ] = ctype( 1 ) - xn[ q ];
+    }
+
+    BatchScalar rfb;
+    auto cit2( cit );
+    if( Impl::isPrism( toUnsignedInt(topologyId), mydimension, mydimension-dim ) )
+    {
+      // apply (1-xn) times Jacobian for bottom
+      for( std::size_t q = 0; q < n; ++q )
+        rfb[ q ] = rf[ q ]*cxn[ q ];
+      jacobianTransposedBatch< add >( topologyId, std::integral_constant< int, dim-1 >(), cit2, n, df, x, rfb, jt );
+      // apply xn times Jacobian for top
+      for( std::size_t q = 0; q < n; ++q )
+        rfb[ q ] = rf[ q ]*xn[ q ];
+      jacobianTransposedBatch< true >( topologyId, std::integral_constant< int, dim-1 >(), cit2, n, df, x, rfb, jt );
+      // compute last row as difference between top value and bottom value
+      for( std::size_t q = 0; q < n; ++q )
+        rfb[ q ] = -rf[ q ];
+      globalBatch< add >( topologyId, std::integral_constant< int, dim-1 >(), cit, n, df, x, rfb, jt[ dim-1 ] );
+      globalBatch< true >( topologyId, std::integral_constant< int, dim-1 >(), cit, n, df, x, rf, jt[ dim-1 ] );
+    }
+    else
+    {
+      assert( Impl::isPyramid( toUnsignedInt(topologyId), mydimension, mydimension-dim ) );
+      // see jacobianTransposed for the treatment of the pyramid tip
+      BatchScalar dfcxn;
+      for( std::size_t q = 0; q < n; ++q )
+      {
+        dfcxn[ q ] = (cxn[ q ] > Traits::tolerance() || cxn[ q ] < -Traits::tolerance()) ? ctype(df[ q ] / cxn[ q ]) : ctype(0);
+        rfb[ q ] = -rf[ q ];
+      }
+
+      // initialize last row
+      // b =  -Tb(x*)
+      globalBatch< add >( topologyId, std::integral_constant< int, dim-1 >(), cit, n, dfcxn, x, rfb, jt[ dim-1 ] );
+      // b += t
+      const GlobalCoordinate &tip = *cit;
+      for( int i = 0; i < coorddimension; ++i )
+        for( std::size_t q = 0; q < n; ++q )
+          jt[ dim-1 ][ i ][ q ] += rf[ q ]*tip[ i ];
+      ++cit;
+      // apply Jacobian for bottom (with argument x/(1-xn)) and correct last row
+      if( add )
+      {
+        std::array< BatchGlobal, dim-1 > jt2;
+        // jt2 = dTb/dx_i(x*)
+        jacobianTransposedBatch< false >( topologyId, std::integral_constant< int, dim-1 >(), cit2, n, dfcxn, x, rf, jt2 );
+        // A = dTb/dx_i(x*)                      (jt[j], j=0..dim-1)
+        // b += \sum_i dTb/dx_i(x*) x_i/(1-xn)   (jt[dim-1])
+        for( int j = 0; j < dim-1; ++j )
+          for( int i = 0; i < coorddimension; ++i )
+            for( std::size_t q = 0; q < n; ++q )
+            {
+              jt[ j ][ i ][ q ] += jt2[ j ][ i ][ q ];
+              jt[ dim-1 ][ i ][ q ] += dfcxn[ q ]*x[ j ][ q ]*jt2[ j ][ i ][ q ];
+            }
+      }
+      else
+      {
+        // jt = dTb/dx_i(x*)
+        jacobianTransposedBatch< false >( topologyId, std::integral_constant< int, dim-1 >(), cit2, n, dfcxn, x, rf, jt );
+        // b += \sum_i dTb/dx_i(x*) x_i/(1-xn)
+        for( int j = 0; j < dim-1; ++j )
+          for( int i = 0; i < coorddimension; ++i )
+            for( std::size_t q = 0; q < n; ++q )
+              jt[ dim-1 ][ i ][ q ] += dfcxn[ q ]*x[ j ][ q ]*jt[ j ][ i ][ q ];
+      }
+    }
+  }
+
+  template< class ct, int mydim, int cdim, class Traits >
+  template< bool add, std::size_t rows, class CornerIterator >
+  inline void MultiLinearGeometry< ct, mydim, cdim, Traits >
+  ::jacobianTransposedBatch ( TopologyId topologyId, std::integral_constant< int, 0 >,
+                              CornerIterator &cit, std::size_t n, const BatchScalar &df, const BatchLocal &x,
+                              const BatchScalar &rf, std::array< BatchGlobal, rows > &jt )
+  {
+    ++cit;
+  }
+
+
+
   template< class ct, int mydim, int cdim, class Traits >
   template< int dim, class CornerIterator >
   inline bool MultiLinearGeometry< ct, mydim, cdim, Traits >
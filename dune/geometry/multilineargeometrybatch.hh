@@ -0,0 +1,377 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#ifndef DUNE_GEOMETRY_MULTILINEARGEOMETRYBATCH_HH
+#define DUNE_GEOMETRY_MULTILINEARGEOMETRYBATCH_HH
+
+/** \file
+ *  \brief Evaluation of multilinear geometries of several elements at once
+ */
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+#include <dune/common/fmatrix.hh>
+#include <dune/common/fvector.hh>
+
+#include <dune/geometry/multilineargeometry.hh>
+#include <dune/geometry/referenceelements.hh>
+#include <dune/geometry/type.hh>
+
+namespace Dune
+{
+
+  // MultiLinearGeometryBatch
+  // ------------------------
+
+  /** \brief multilinear mappings of several elements of the same type
+   *
+   *  This class evaluates the mappings of \c lanes elements sharing the same
+   *  reference element simultaneously. The corners of all elements are
+   *  stored lane-interleaved, i.e., the same coordinate of the same corner
+   *  of all elements is contiguous in memory. All results are returned in
+   *  the same layout, so each arithmetic operation acts on \c lanes
+   *  independent values and can be vectorized by the compiler. This is
+   *  most useful in 2D and 3D, where the matrices of a single element are
+   *  too small to fill a SIMD register.
+   *
+   *  The multilinear shape functions are evaluated only once per local
+   *  coordinate, using a scalar MultiLinearGeometry whose corners are the
+   *  unit vectors. Hence, the results coincide with those of
+   *  MultiLinearGeometry (and AffineGeometry for affine elements).
+   *
+   *  \tparam  ct     coordinate type
+   *  \tparam  mydim  geometry dimension
+   *  \tparam  cdim   coordinate dimension
+   *  \tparam  lanes  number of elements evaluated simultaneously
+   */
+  template< class ct, int mydim, int cdim, int lanes >
+  class MultiLinearGeometryBatch
+  {
+  public:
+    //! coordinate type
+    typedef ct ctype;
+
+    //! geometry dimension
+    static const int mydimension = mydim;
+    //! coordinate dimension
+    static const int coorddimension = cdim;
+    //! number of elements evaluated simultaneously
+    static const int numLanes = lanes;
+
+    //! maximal number of corners of a reference element of dimension mydim
+    static const int maxCorners = (1 << mydim);
+
+    //! type of local coordinates (shared by all lanes)
+    typedef FieldVector< ctype, mydimension > LocalCoordinate;
+
+    //! a scalar per lane
+    typedef std::array< ctype, lanes > LaneScalar;
+
+    //! global coordinates of all lanes, indexed by [i][lane]
+    typedef std::array< LaneScalar, coorddimension > GlobalCoordinate;
+
+    //! transposed Jacobians of all lanes, indexed by [j][i][lane]
+    typedef std::array< GlobalCoordinate, mydimension > JacobianTransposed;
+
+    //! transposed of the Jacobian's inverses of all lanes, indexed by [i][j][lane]
+    typedef std::array< std::array< LaneScalar, mydimension >, coorddimension > JacobianInverseTransposed;
+
+  protected:
+    typedef MultiLinearGeometry< ctype, mydimension, maxCorners > ShapeFunctions;
+
+  public:
+    //! type of reference element
+    typedef typename ShapeFunctions::ReferenceElement ReferenceElement;
+
+    /** \brief constructor
+     *
+     *  \param[in]  refElement  reference element shared by all lanes
+     *
+     *  All corners are initialized to zero; use setCorners to fill in the
+     *  elements.
+     */
+    explicit MultiLinearGeometryBatch ( const ReferenceElement &refElement )
+      : shapeFunctions_( refElement, unitVectors( refElement.size( mydimension ) ) ),
+        numCorners_( refElement.size( mydimension ) )
+    {
+      for( auto &corner : corners_ )
+        for( auto &coordinate : corner )
+          coordinate.fill( ctype( 0 ) );
+    }
+
+    /** \brief constructor
+     *
+     *  \param[in]  gt  geometry type shared by all lanes
+     */
+    explicit MultiLinearGeometryBatch ( Dune::GeometryType gt )
+      : MultiLinearGeometryBatch( ReferenceElements< ctype, mydimension >::general( gt ) )
+    {}
+
+    /** \brief store the corners of one element
+     *
+     *  \param[in]  lane     lane to assign the element to
+     *  \param[in]  corners  random access container of the element's corners
+     */
+    template< class Corners >
+    void setCorners ( int lane, const Corners &corners )
+    {
+      assert( (lane >= 0) && (lane < lanes) );
+      for( int c = 0; c < numCorners_; ++c )
+        for( int i = 0; i < coorddimension; ++i )
+          corners_[ c ][ i ][ lane ] = corners[ c ][ i ];
+    }
+
+    //! obtain the name of the reference element
+    Dune::GeometryType type () const { return shapeFunctions_.type(); }
+
+    //! obtain number of corners of the corresponding reference element
+    int corners () const { return numCorners_; }
+
+    //! obtain coordinates of the i-th corner of the element in lane
+    FieldVector< ctype, coorddimension > corner ( int lane, int i ) const
+    {
+      assert( (i >= 0) && (i < numCorners_) );
+      FieldVector< ctype, coorddimension > y;
+      for( int k = 0; k < coorddimension; ++k )
+        y[ k ] = corners_[ i ][ k ][ lane ];
+      return y;
+    }
+
+    //! evaluate the mappings of all lanes
+    GlobalCoordinate global ( const LocalCoordinate &local ) const
+    {
+      const FieldVector< ctype, maxCorners > phi = shapeFunctions_.global( local );
+
+      GlobalCoordinate y;
+      for( int i = 0; i < coorddimension; ++i )
+      {
+        y[ i ].fill( ctype( 0 ) );
+        for( int c = 0; c < numCorners_; ++c )
+          for( int l = 0; l < lanes; ++l )
+            y[ i ][ l ] += phi[ c ] * corners_[ c ][ i ][ l ];
+      }
+      return y;
+    }
+
+    //! obtain the transposed of the Jacobians of all lanes
+    JacobianTransposed jacobianTransposed ( const LocalCoordinate &local ) const
+    {
+      const FieldMatrix< ctype, mydimension, maxCorners > dphi = shapeFunctions_.jacobianTransposed( local );
+
+      JacobianTransposed jt;
+      for( int j = 0; j < mydimension; ++j )
+      {
+        for( int i = 0; i < coorddimension; ++i )
+        {
+          jt[ j ][ i ].fill( ctype( 0 ) );
+          for( int c = 0; c < numCorners_; ++c )
+            for( int l = 0; l < lanes; ++l )
+              jt[ j ][ i ][ l ] += dphi[ j ][ c ] * corners_[ c ][ i ][ l ];
+        }
+      }
+      return jt;
+    }
+
+    //! obtain the integration elements of all lanes
+    LaneScalar integrationElement ( const LocalCoordinate &local ) const
+    {
+      return sqrtDetAAT( jacobianTransposed( local ) );
+    }
+
+    /** \brief obtain the transposed of the Jacobian's inverses of all lanes
+     *
+     *  As in MultiLinearGeometry, the inverse is the right pseudo-inverse.
+     */
+    JacobianInverseTransposed jacobianInverseTransposed ( const LocalCoordinate &local ) const
+    {
+      JacobianInverseTransposed jit;
+      rightInvA( jacobianTransposed( local ), jit );
+      return jit;
+    }
+
+  protected:
+    typedef std::array< std::array< LaneScalar, mydimension >, mydimension > LaneSquareMatrix;
+
+    static std::vector< FieldVector< ctype, maxCorners > > unitVectors ( int numCorners )
+    {
+      std::vector< FieldVector< ctype, maxCorners > > e( numCorners, FieldVector< ctype, maxCorners >( ctype( 0 ) ) );
+      for( int c = 0; c < numCorners; ++c )
+        e[ c ][ c ] = ctype( 1 );
+      return e;
+    }
+
+    // The following methods perform the computations of
+    // Impl::FieldMatrixHelper in all lanes simultaneously.
+
+    static void AAT_L ( const JacobianTransposed &A, LaneSquareMatrix &ret )
+    {
+      for( int i = 0; i < mydimension; ++i )
+      {
+        for( int j = 0; j <= i; ++j )
+        {
+          ret[ i ][ j ].fill( ctype( 0 ) );
+          for( int k = 0; k < coorddimension; ++k )
+            for( int l = 0; l < lanes; ++l )
+              ret[ i ][ j ][ l ] += A[ i ][ k ][ l ] * A[ j ][ k ][ l ];
+        }
+      }
+    }
+
+    static void cholesky_L ( const LaneSquareMatrix &A, LaneSquareMatrix &ret )
+    {
+      using std::sqrt;
+      for( int i = 0; i < mydimension; ++i )
+      {
+        for( int l = 0; l < lanes; ++l )
+        {
+          ctype xDiag = A[ i ][ i ][ l ];
+          for( int j = 0; j < i; ++j )
+            xDiag -= ret[ i ][ j ][ l ] * ret[ i ][ j ][ l ];
+          assert( xDiag > ctype( 0 ) );
+          ret[ i ][ i ][ l ] = sqrt( xDiag );
+        }
+
+        for( int k = i+1; k < mydimension; ++k )
+        {
+          for( int l = 0; l < lanes; ++l )
+          {
+            ctype x = A[ k ][ i ][ l ];
+            for( int j = 0; j < i; ++j )
+              x -= ret[ i ][ j ][ l ] * ret[ k ][ j ][ l ];
+            ret[ k ][ i ][ l ] = x / ret[ i ][ i ][ l ];
+          }
+        }
+      }
+    }
+
+    static LaneScalar sqrtDetAAT ( const JacobianTransposed &A )
+    {
+      using std::abs;
+      using std::sqrt;
+
+      const int m = mydimension;
+      const int n = coorddimension;
+
+      LaneScalar det;
+      if( (n == 2) && (m == 2) )
+      {
+        for( int l = 0; l < lanes; ++l )
+          det[ l ] = abs( A[ 0 ][ 0 ][ l ]*A[ 1 ][ 1 ][ l ] - A[ 1 ][ 0 ][ l ]*A[ 0 ][ 1 ][ l ] );
+      }
+      else if( (n == 3) && (m == 3) )
+      {
+        for( int l = 0; l < lanes; ++l )
+        {
+          const ctype v0 = A[ 0 ][ 1 ][ l ] * A[ 1 ][ 2 ][ l ] - A[ 1 ][ 1 ][ l ] * A[ 0 ][ 2 ][ l ];
+          const ctype v1 = A[ 0 ][ 2 ][ l ] * A[ 1 ][ 0 ][ l ] - A[ 1 ][ 2 ][ l ] * A[ 0 ][ 0 ][ l ];
+          const ctype v2 = A[ 0 ][ 0 ][ l ] * A[ 1 ][ 1 ][ l ] - A[ 1 ][ 0 ][ l ] * A[ 0 ][ 1 ][ l ];
+          det[ l ] = abs( v0 * A[ 2 ][ 0 ][ l ] + v1 * A[ 2 ][ 1 ][ l ] + v2 * A[ 2 ][ 2 ][ l ] );
+        }
+      }
+      else if( (n == 3) && (m == 2) )
+      {
+        for( int l = 0; l < lanes; ++l )
+        {
+          const ctype v0 = A[ 0 ][ 0 ][ l ] * A[ 1 ][ 1 ][ l ] - A[ 0 ][ 1 ][ l ] * A[ 1 ][ 0 ][ l ];
+          const ctype v1 = A[ 0 ][ 0 ][ l ] * A[ 1 ][ 2 ][ l ] - A[ 1 ][ 0 ][ l ] * A[ 0 ][ 2 ][ l ];
+          const ctype v2 = A[ 0 ][ 1 ][ l ] * A[ 1 ][ 2 ][ l ] - A[ 0 ][ 2 ][ l ] * A[ 1 ][ 1 ][ l ];
+          det[ l ] = sqrt( v0*v0 + v1*v1 + v2*v2 );
+        }
+      }
+      else if( n >= m )
+      {
+        LaneSquareMatrix aat, L;
+        AAT_L( A, aat );
+        cholesky_L( aat, L );
+        det.fill( ctype( 1 ) );
+        for( int i = 0; i < m; ++i )
+          for( int l = 0; l < lanes; ++l )
+            det[ l ] *= L[ i ][ i ][ l ];
+      }
+      else
+        det.fill( ctype( 0 ) );
+      return det;
+    }
+
+    static void rightInvA ( const JacobianTransposed &A, JacobianInverseTransposed &ret )
+    {
+      static_assert( (coorddimension >= mydimension), "Matrix has no right inverse." );
+
+      const int m = mydimension;
+      const int n = coorddimension;
+
+      if( (n == 2) && (m == 2) )
+      {
+        for( int l = 0; l < lanes; ++l )
+        {
+          const ctype detInv = ctype( 1 ) / (A[ 0 ][ 0 ][ l ]*A[ 1 ][ 1 ][ l ] - A[ 1 ][ 0 ][ l ]*A[ 0 ][ 1 ][ l ]);
+          ret[ 0 ][ 0 ][ l ] = A[ 1 ][ 1 ][ l ] * detInv;
+          ret[ 1 ][ 1 ][ l ] = A[ 0 ][ 0 ][ l ] * detInv;
+          ret[ 1 ][ 0 ][ l ] = -A[ 1 ][ 0 ][ l ] * detInv;
+          ret[ 0 ][ 1 ][ l ] = -A[ 0 ][ 1 ][ l ] * detInv;
+        }
+      }
+      else
+      {
+        // (A A^T)^{-1} = L^{-T} L^{-1} with A A^T = L L^T
+        LaneSquareMatrix aat, L;
+        AAT_L( A, aat );
+        cholesky_L( aat, L );
+
+        // invert L in place (cf. Impl::FieldMatrixHelper::invL)
+        for( int i = 0; i < m; ++i )
+        {
+          for( int l = 0; l < lanes; ++l )
+            L[ i ][ i ][ l ] = ctype( 1 ) / L[ i ][ i ][ l ];
+          for( int j = 0; j < i; ++j )
+          {
+            for( int l = 0; l < lanes; ++l )
+            {
+              ctype x = L[ i ][ j ][ l ] * L[ j ][ j ][ l ];
+              for( int k = j+1; k < i; ++k )
+                x += L[ i ][ k ][ l ] * L[ k ][ j ][ l ];
+              L[ i ][ j ][ l ] = -L[ i ][ i ][ l ] * x;
+            }
+          }
+        }
+
+        // aat = L^{-T} L^{-1} (lower half, cf. Impl::FieldMatrixHelper::LTL)
+        for( int i = 0; i < m; ++i )
+        {
+          for( int j = 0; j <= i; ++j )
+          {
+            aat[ i ][ j ].fill( ctype( 0 ) );
+            for( int k = i; k < m; ++k )
+              for( int l = 0; l < lanes; ++l )
+                aat[ i ][ j ][ l ] += L[ k ][ i ][ l ] * L[ k ][ j ][ l ];
+          }
+        }
+
+        // ret = A^T (A A^T)^{-1}
+        for( int i = 0; i < n; ++i )
+        {
+          for( int j = 0; j < m; ++j )
+          {
+            ret[ i ][ j ].fill( ctype( 0 ) );
+            for( int k = 0; k < m; ++k )
+            {
+              const LaneScalar &b = (k <= j ? aat[ j ][ k ] : aat[ k ][ j ]);
+              for( int l = 0; l < lanes; ++l )
+                ret[ i ][ j ][ l ] += A[ k ][ i ][ l ] * b[ l ];
+            }
+          }
+        }
+      }
+    }
+
+  private:
+    ShapeFunctions shapeFunctions_;
+    int numCorners_;
+    std::array< GlobalCoordinate, maxCorners > corners_;
+  };
+
+} // namespace Dune
+
+#endif // #ifndef DUNE_GEOMETRY_MULTILINEARGEOMETRYBATCH_HH
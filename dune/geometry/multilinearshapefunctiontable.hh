@@ -0,0 +1,245 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#ifndef DUNE_GEOMETRY_MULTILINEARSHAPEFUNCTIONTABLE_HH
+#define DUNE_GEOMETRY_MULTILINEARSHAPEFUNCTIONTABLE_HH
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include <dune/common/fmatrix.hh>
+#include <dune/common/fvector.hh>
+#include <dune/common/stdthread.hh>
+#include <dune/common/visibility.hh>
+
+#include <dune/geometry/multilineargeometry.hh>
+#include <dune/geometry/quadraturerules.hh>
+#include <dune/geometry/referenceelements.hh>
+#include <dune/geometry/type.hh>
+
+/**
+   \file
+   \brief Tabulated multilinear shape functions in the points of a quadrature rule
+ */
+
+namespace Dune
+{
+
+  // MultiLinearShapeFunctionTable
+  // -----------------------------
+
+  /** \brief values and derivatives of the multilinear shape functions in the
+   *         points of a quadrature rule
+   *
+   *  The multilinear mapping used by MultiLinearGeometry can be written as
+   *  \f[ y(x) = \sum_c \phi_c(x) y_c, \f]
+   *  where \f$y_c\f$ denote the corners of the element and \f$\phi_c\f$ the
+   *  multilinear shape function associated with corner \f$c\f$ of the
+   *  reference element. The shape functions depend only on the reference
+   *  element, so their values and derivatives in the points of a quadrature
+   *  rule can be tabulated once and reused for every element.
+   *
+   *  With such a table, evaluating the mapping and its Jacobian in all
+   *  quadrature points is a small dense matrix product with the matrix of
+   *  corners.
+   *
+   *  \tparam  ct   coordinate type
+   *  \tparam  dim  dimension of the reference element
+   *
+   *  \ingroup Quadrature
+   */
+  template< class ct, int dim >
+  class MultiLinearShapeFunctionTable
+  {
+  public:
+    //! coordinate type
+    typedef ct ctype;
+
+    //! dimension of the reference element
+    static const int mydimension = dim;
+
+    //! type of the quadrature rule
+    typedef Dune::QuadratureRule< ctype, mydimension > QuadratureRule;
+
+    //! type of local coordinates
+    typedef FieldVector< ctype, mydimension > LocalCoordinate;
+
+    //! default constructor yielding an empty table
+    MultiLinearShapeFunctionTable () : numPoints_( 0 ), numCorners_( 0 ) {}
+
+    /** \brief tabulate the shape functions of a reference element
+     *
+     *  \param[in]  type  geometry type of the reference element
+     *  \param[in]  rule  quadrature rule whose points are tabulated
+     */
+    MultiLinearShapeFunctionTable ( const GeometryType &type, const QuadratureRule &rule );
+
+    //! number of tabulated points
+    std::size_t size () const { return numPoints_; }
+
+    //! number of corners (i.e., shape functions)
+    int corners () const { return numCorners_; }
+
+    //! value of the shape function of corner c in point q
+    ctype value ( std::size_t q, int c ) const
+    {
+      assert( (q < numPoints_) && (c >= 0) && (c < numCorners_) );
+      return values_[ q*numCorners_ + c ];
+    }
+
+    //! derivative in direction j of the shape function of corner c in point q
+    ctype derivative ( std::size_t q, int j, int c ) const
+    {
+      assert( (q < numPoints_) && (j >= 0) && (j < mydimension) && (c >= 0) && (c < numCorners_) );
+      return derivatives_[ (q*mydimension + j)*numCorners_ + c ];
+    }
+
+    /** \brief evaluate the mapping in all tabulated points
+     *
+     *  \param[in]   corners  random access container of corners of the element
+     *  \param[out]  y        random access iterator to the global coordinates
+     */
+    template< class Corners, class GlobalIterator >
+    void global ( const Corners &corners, GlobalIterator y ) const
+    {
+      typedef typename std::decay< decltype( corners[ 0 ] ) >::type GlobalCoordinate;
+
+      const ctype *phi = values_.data();
+      for( std::size_t q = 0; q < numPoints_; ++q, phi += numCorners_ )
+      {
+        GlobalCoordinate yq( ctype( 0 ) );
+        for( int c = 0; c < numCorners_; ++c )
+          yq.axpy( phi[ c ], corners[ c ] );
+        y[ q ] = yq;
+      }
+    }
+
+    /** \brief evaluate the transposed of the Jacobian in all tabulated points
+     *
+     *  \param[in]   corners  random access container of corners of the element
+     *  \param[out]  jt       random access iterator to the transposed Jacobians
+     */
+    template< class Corners, class JacobianIterator >
+    void jacobianTransposed ( const Corners &corners, JacobianIterator jt ) const
+    {
+      typedef typename std::decay< decltype( corners[ 0 ] ) >::type GlobalCoordinate;
+      typedef FieldMatrix< ctype, mydimension, GlobalCoordinate::dimension > JacobianTransposed;
+
+      const ctype *dphi = derivatives_.data();
+      for( std::size_t q = 0; q < numPoints_; ++q )
+      {
+        JacobianTransposed jtq( ctype( 0 ) );
+        for( int j = 0; j < mydimension; ++j, dphi += numCorners_ )
+          for( int c = 0; c < numCorners_; ++c )
+            jtq[ j ].axpy( dphi[ c ], corners[ c ] );
+        jt[ q ] = jtq;
+      }
+    }
+
+  private:
+    std::size_t numPoints_;
+    int numCorners_;
+    std::vector< ctype > values_;       // indexed by [q][c]
+    std::vector< ctype > derivatives_;  // indexed by [q][j][c]
+  };
+
+
+
+  // MultiLinearShapeFunctionTables
+  // ------------------------------
+
+  /** \brief A container for all shape function tables
+   *
+   *  The tables are created on first use and kept for the lifetime of the
+   *  program, just like the quadrature rules themselves.  Orders for which
+   *  there is no quadrature rule throw a QuadratureOrderOutOfRange.
+   *
+   *  \ingroup Quadrature
+   */
+  template< class ctype, int dim >
+  class MultiLinearShapeFunctionTables
+  {
+    typedef Dune::MultiLinearShapeFunctionTable< ctype, dim > MultiLinearShapeFunctionTable;
+
+    static void initTable ( MultiLinearShapeFunctionTable *table, QuadratureType::Enum qt,
+                            const GeometryType &t, int p )
+    {
+      *table = MultiLinearShapeFunctionTable( t, QuadratureRules< ctype, dim >::rule( t, p, qt ) );
+    }
+
+    DUNE_EXPORT const MultiLinearShapeFunctionTable &_table ( const GeometryType &t, int p, QuadratureType::Enum qt )
+    {
+      DUNE_ASSERT_CALL_ONCE();
+
+      return cache_.entry( t, p, qt, initTable );
+    }
+
+    DUNE_EXPORT static MultiLinearShapeFunctionTables &instance ()
+    {
+      static MultiLinearShapeFunctionTables instance;
+      return instance;
+    }
+
+    MultiLinearShapeFunctionTables () {}
+
+    // indexed by quadrature type, geometry type and order like the rules
+    Impl::QuadratureCache< ctype, dim, MultiLinearShapeFunctionTable > cache_;
+
+  public:
+    /** \brief select the shape function table for GeometryType t in the
+     *         points of the QuadratureRule of order p
+     *
+     *  The points are tabulated in the same order as in
+     *  QuadratureRules< ctype, dim >::rule( t, p, qt ).
+     */
+    static const MultiLinearShapeFunctionTable &table ( const GeometryType &t, int p, QuadratureType::Enum qt = QuadratureType::GaussLegendre )
+    {
+      return instance()._table( t, p, qt );
+    }
+  };
+
+
+
+  // Implementation of MultiLinearShapeFunctionTable
+  // -----------------------------------------------
+
+  template< class ct, int dim >
+  inline MultiLinearShapeFunctionTable< ct, dim >
+  ::MultiLinearShapeFunctionTable ( const GeometryType &type, const QuadratureRule &rule )
+    : numPoints_( rule.size() )
+  {
+    // The shape function of corner c is the (scalar) multilinear mapping
+    // taking the value 1 in corner c and 0 in all other corners.
+    typedef MultiLinearGeometry< ctype, mydimension, 1 > ScalarGeometry;
+
+    const auto refElement = referenceElement< ctype, mydimension >( type );
+    numCorners_ = refElement.size( mydimension );
+
+    values_.resize( numPoints_*numCorners_ );
+    derivatives_.resize( numPoints_*mydimension*numCorners_ );
+
+    std::vector< typename ScalarGeometry::GlobalCoordinate > corners( numCorners_ );
+    std::vector< typename ScalarGeometry::GlobalCoordinate > phi( numPoints_ );
+    std::vector< typename ScalarGeometry::JacobianTransposed > dphi( numPoints_ );
+    for( int c = 0; c < numCorners_; ++c )
+    {
+      for( int i = 0; i < numCorners_; ++i )
+        corners[ i ] = ctype( i == c ? 1 : 0 );
+
+      const ScalarGeometry geometry( refElement, corners );
+      geometry.global( rule, phi.begin() );
+      geometry.jacobianTransposed( rule, dphi.begin() );
+
+      for( std::size_t q = 0; q < numPoints_; ++q )
+      {
+        values_[ q*numCorners_ + c ] = phi[ q ][ 0 ];
+        for( int j = 0; j < mydimension; ++j )
+          derivatives_[ (q*mydimension + j)*numCorners_ + c ] = dphi[ q ][ j ][ 0 ];
+      }
+    }
+  }
+
+} // namespace Dune
+
+#endif // #ifndef DUNE_GEOMETRY_MULTILINEARSHAPEFUNCTIONTABLE_HH
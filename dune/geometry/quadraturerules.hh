@@ -5,8 +5,13 @@
 #define DUNE_GEOMETRY_QUADRATURERULES_HH
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <limits>
+#include <memory>
 #include <mutex>
 #include <utility>
 #include <vector>
@@ -131,10 +136,256 @@ namespace Dune {
     int delivered_order;
   };
 
+  /** \brief Structure-of-arrays view of a quadrature rule
+      \ingroup Quadrature
+
+      A QuadratureRule stores its points as an array of QuadraturePoint
+      objects, i.e., coordinates and weights are interleaved.  This class
+      stores the same data as one contiguous array per coordinate direction
+      plus one array for the weights, so that loops over all points can
+      load them without gathers.
+
+      Each array starts at an address aligned to \ref alignment bytes and is
+      padded to paddedSize() entries, which is a multiple of the number of
+      values fitting into \ref alignment bytes.  The padding entries have
+      zero coordinates and zero weight, so they may safely be included in
+      vectorized loops.
+
+      \tparam ct Number type used for both coordinates and the weights
+      \tparam dim Dimension of the integration domain
+   */
+  template<typename ct, int dim>
+  class QuadratureRuleSoA
+  {
+  public:
+    /** \brief The space dimension */
+    enum { d=dim };
+
+    /** \brief The type used for coordinates */
+    typedef ct CoordType;
+
+    /** \brief Alignment of the arrays in bytes */
+    static const std::size_t alignment = 64;
+
+    /** \brief Number of entries the arrays are padded to a multiple of */
+    static const std::size_t blockSize = (sizeof(ct) < alignment ? alignment / sizeof(ct) : 1);
+
+    /** \brief Default constructor, creating an empty view */
+    QuadratureRuleSoA () : size_(0), paddedSize_(0), data_(nullptr) {}
+
+    /** \brief Construct the view from a quadrature rule */
+    explicit QuadratureRuleSoA ( const QuadratureRule<ct,dim> &rule )
+      : size_(rule.size()),
+        paddedSize_(((rule.size() + blockSize - 1) / blockSize) * blockSize)
+    {
+      allocate();
+      ct *x = data();
+      for (std::size_t i = 0; i < size_; ++i)
+      {
+        for (int k = 0; k < dim; ++k)
+          x[ k*paddedSize_ + i ] = rule[ i ].position()[ k ];
+        x[ dim*paddedSize_ + i ] = rule[ i ].weight();
+      }
+    }
+
+    QuadratureRuleSoA ( const QuadratureRuleSoA &other )
+      : size_(other.size_), paddedSize_(other.paddedSize_)
+    {
+      allocate();
+      std::copy(other.data(), other.data() + (dim+1)*paddedSize_, data());
+    }
+
+    QuadratureRuleSoA ( QuadratureRuleSoA &&other ) noexcept
+      : size_(other.size_), paddedSize_(other.paddedSize_),
+        data_(other.data_), storage_(std::move(other.storage_))
+    {
+      other.size_ = other.paddedSize_ = 0;
+      other.data_ = nullptr;
+    }
+
+    ~QuadratureRuleSoA () { release(); }
+
+    QuadratureRuleSoA &operator= ( const QuadratureRuleSoA &other )
+    {
+      if (this != &other)
+        *this = QuadratureRuleSoA(other);
+      return *this;
+    }
+
+    QuadratureRuleSoA &operator= ( QuadratureRuleSoA &&other ) noexcept
+    {
+      if (this != &other)
+      {
+        release();
+        size_ = other.size_;
+        paddedSize_ = other.paddedSize_;
+        data_ = other.data_;
+        storage_ = std::move(other.storage_);
+        other.size_ = other.paddedSize_ = 0;
+        other.data_ = nullptr;
+      }
+      return *this;
+    }
+
+    //! return the number of quadrature points
+    std::size_t size () const { return size_; }
+
+    //! return the length of the padded arrays
+    std::size_t paddedSize () const { return paddedSize_; }
+
+    //! return the k-th coordinates of all quadrature points
+    const ct *position ( int k ) const
+    {
+      assert((k >= 0) && (k < dim));
+      return data() + k*paddedSize_;
+    }
+
+    //! return the weights of all quadrature points
+    const ct *weight () const
+    {
+      return data() + dim*paddedSize_;
+    }
+
+  private:
+    static_assert(alignment % alignof(ct) == 0, "QuadratureRuleSoA::alignment is not a multiple of the alignment of ct");
+
+    // The raw storage is over-allocated by alignment bytes, the arrays
+    // start at the first byte aligned to alignment, whatever sizeof(ct) is.
+    void allocate ()
+    {
+      const std::size_t n = (dim+1)*paddedSize_;
+      std::size_t space = n*sizeof(ct) + alignment;
+      storage_.reset(new unsigned char[space]);
+      void *p = storage_.get();
+      p = std::align(alignment, n*sizeof(ct), p, space);
+      assert(p && (reinterpret_cast<std::uintptr_t>(p) % alignment == 0));
+      data_ = static_cast<ct *>(p);
+      std::uninitialized_fill_n(data_, n, ct(0));
+    }
+
+    void release ()
+    {
+      for (std::size_t i = 0; i < (dim+1)*paddedSize_; ++i)
+        data_[i].~ct();
+      storage_.reset();
+      data_ = nullptr;
+    }
+
+    ct *data () { return data_; }
+    const ct *data () const { return data_; }
+
+    std::size_t size_;
+    std::size_t paddedSize_;
+    ct *data_;
+    std::unique_ptr<unsigned char[]> storage_;
+  };
+
   // Forward declaration of the factory class,
   // needed internally by the QuadratureRules container class.
   template<typename ctype, int dim> class QuadratureRuleFactory;
 
+  namespace Impl {
+
+    /** \brief A thread-safe cache of objects per quadrature type, geometry
+     *         type and quadrature order
+     *
+     * The entries are created on first use and stay in place for the lifetime
+     * of the cache.  The entries of a geometry type are allocated in blocks of
+     * orderBlockSize orders when an order of the block is first requested, so
+     * a high maxOrder, e.g., of the generated one-dimensional rules, costs no
+     * memory until it is used.
+     *
+     * \tparam ctype Type used for coordinates and quadrature weights
+     * \tparam dim   Dimension of the reference element
+     * \tparam Entry Type of the cached objects, must be default constructible
+     */
+    template<typename ctype, int dim, class Entry>
+    class QuadratureCache
+    {
+      //! number of quadrature orders whose entries are allocated together
+      static const int orderBlockSize = 32;
+
+      typedef std::array<std::pair<std::once_flag, Entry>, orderBlockSize>
+        QuadratureOrderBlock; // indexed by quadrature order modulo orderBlockSize
+      //! \brief allocate the entries of a block of quadrature orders on first use
+      static void initQuadratureOrderBlock(std::unique_ptr<QuadratureOrderBlock> *qob)
+      {
+        qob->reset(new QuadratureOrderBlock);
+      }
+
+      typedef std::vector<std::pair<std::once_flag, std::unique_ptr<QuadratureOrderBlock> > >
+        QuadratureOrderVector; // indexed by quadrature order divided by orderBlockSize
+      //! \brief initialize the vector indexed by the quadrature order (for each
+      //!        geometry type and quadrature type)
+      static void initQuadratureOrderVector(QuadratureOrderVector *qov,
+                                            QuadratureType::Enum qt,
+                                            const GeometryType &t)
+      {
+        if(dim == 0)
+          // we only need one quadrature rule for points, not maxint
+          *qov = QuadratureOrderVector(1);
+        else
+          *qov = QuadratureOrderVector(QuadratureRuleFactory<ctype,dim>::maxOrder(t,qt)/orderBlockSize+1);
+      }
+
+      typedef std::vector<std::pair<std::once_flag, QuadratureOrderVector> >
+        GeometryTypeVector; // indexed by geometry type
+      //! \brief initialize the vector indexed by the geometry type (for each
+      //!        quadrature type)
+      static void initGeometryTypeVector(GeometryTypeVector *gtv)
+      {
+        *gtv = GeometryTypeVector(LocalGeometryTypeIndex::size(dim));
+      }
+
+    public:
+      QuadratureCache()
+        : cache_(QuadratureType::size)
+      {}
+
+      /** \brief get the entry for GeometryType t, order p and quadrature type qt
+       *
+       * On first use, the entry is initialized by calling init(&entry, qt, t, p)
+       * exactly once.  Orders that QuadratureRules does not provide for t
+       * throw a QuadratureOrderOutOfRange before anything is allocated for them.
+       */
+      template<class Init>
+      const Entry& entry(const GeometryType& t, int p, QuadratureType::Enum qt, Init init)
+      {
+        assert(t.dim()==dim);
+
+        // we only have one quadrature rule for points
+        const int order = (dim == 0 ? 0 : p);
+        if((order < 0) || (std::size_t(order) > QuadratureRuleFactory<ctype,dim>::maxOrder(t,qt)))
+          DUNE_THROW(QuadratureOrderOutOfRange,
+                     "QuadratureRule for order " << p << " and GeometryType " << t
+                     << " not available");
+
+        auto & quadratureTypeLevel = cache_[qt];
+        std::call_once(quadratureTypeLevel.first, initGeometryTypeVector,
+                       &quadratureTypeLevel.second);
+
+        auto & geometryTypeLevel =
+          quadratureTypeLevel.second[LocalGeometryTypeIndex::index(t)];
+        std::call_once(geometryTypeLevel.first, initQuadratureOrderVector,
+                       &geometryTypeLevel.second, qt, t);
+
+        auto & quadratureBlockLevel = geometryTypeLevel.second[order / orderBlockSize];
+        std::call_once(quadratureBlockLevel.first, initQuadratureOrderBlock,
+                       &quadratureBlockLevel.second);
+
+        auto & quadratureOrderLevel = (*quadratureBlockLevel.second)[order % orderBlockSize];
+        std::call_once(quadratureOrderLevel.first, init,
+                       &quadratureOrderLevel.second, qt, t, p);
+
+        return quadratureOrderLevel.second;
+      }
+
+    private:
+      std::vector<std::pair<std::once_flag, GeometryTypeVector> > cache_; // indexed by quadrature type
+    };
+
+  } // namespace Impl
+
   /** \brief A container for all quadrature rules of dimension <tt>dim</tt>
       \ingroup Quadrature
    */
@@ -143,65 +394,62 @@ namespace Dune {
 
     /** \brief Internal short-hand notation for the type of quadrature rules this container contains */
     typedef Dune::QuadratureRule<ctype, dim> QuadratureRule;
+    /** \brief Internal short-hand notation for the structure-of-arrays views this container contains */
+    typedef Dune::QuadratureRuleSoA<ctype, dim> QuadratureRuleSoA;
+
+    //! \brief a quadrature rule together with its structure-of-arrays view
+    struct QuadratureRuleEntry
+    {
+      QuadratureRule rule;
+      QuadratureRuleSoA soa;
+    };
+
     //! \brief a quadrature rule (for each quadrature order, geometry type,
     //!        and quadrature type)
-    static void initQuadratureRule(QuadratureRule *qr, QuadratureType::Enum qt,
+    static void initQuadratureRule(QuadratureRuleEntry *qr, QuadratureType::Enum qt,
                                    const GeometryType &t, int p)
     {
-      *qr = QuadratureRuleFactory<ctype,dim>::rule(t,p,qt);
+      qr->rule = QuadratureRuleFactory<ctype,dim>::rule(t,p,qt);
+      qr->soa = QuadratureRuleSoA(qr->rule);
     }
 
-    typedef std::vector<std::pair<std::once_flag, QuadratureRule> >
-      QuadratureOrderVector; // indexed by quadrature order
-    //! \brief initialize the vector indexed by the quadrature order (for each
-    //!        geometry type and quadrature type)
-    static void initQuadratureOrderVector(QuadratureOrderVector *qov,
-                                          QuadratureType::Enum qt,
-                                          const GeometryType &t)
+    //! number of quadrature orders covered by the lock-free lookup table
+    static const int lookupOrders = 64;
+
+    //! position of a rule in the lock-free lookup table
+    static std::size_t lookupIndex(const GeometryType& t, int p, QuadratureType::Enum qt)
     {
-      if(dim == 0)
-        // we only need one quadrature rule for points, not maxint
-        *qov = QuadratureOrderVector(1);
-      else
-        *qov = QuadratureOrderVector(QuadratureRuleFactory<ctype,dim>::maxOrder(t,qt)+1);
+      return (std::size_t(qt)*LocalGeometryTypeIndex::size(dim) + LocalGeometryTypeIndex::index(t))*lookupOrders + p;
     }
 
-    typedef std::vector<std::pair<std::once_flag, QuadratureOrderVector> >
-      GeometryTypeVector; // indexed by geometry type
-    //! \brief initialize the vector indexed by the geometry type (for each
-    //!        quadrature type)
-    static void initGeometryTypeVector(GeometryTypeVector *gtv)
+    //! rule lookup, synchronizing only until the rule has been published
+    const QuadratureRuleEntry& _rule(const GeometryType& t, int p, QuadratureType::Enum qt=QuadratureType::GaussLegendre)
     {
-      *gtv = GeometryTypeVector(LocalGeometryTypeIndex::size(dim));
+      assert(t.dim()==dim);
+
+      // we only have one quadrature rule for points
+      const int order = (dim == 0 ? 0 : p);
+      if((order < 0) || (order >= lookupOrders))
+        return _cachedRule(t,p,qt);
+
+      std::atomic<const QuadratureRuleEntry*> &slot = lookup_[lookupIndex(t,order,qt)];
+      const QuadratureRuleEntry *entry = slot.load(std::memory_order_acquire);
+      if(!entry)
+      {
+        entry = &_cachedRule(t,p,qt);
+        slot.store(entry, std::memory_order_release);
+      }
+      return *entry;
     }
 
     //! real rule creator
-    DUNE_EXPORT const QuadratureRule& _rule(const GeometryType& t, int p, QuadratureType::Enum qt=QuadratureType::GaussLegendre)
+    DUNE_EXPORT const QuadratureRuleEntry& _cachedRule(const GeometryType& t, int p, QuadratureType::Enum qt)
     {
       assert(t.dim()==dim);
 
       DUNE_ASSERT_CALL_ONCE();
 
-      static std::vector<std::pair< // indexed by quadrature type
-        std::once_flag,
-        GeometryTypeVector
-        > > quadratureCache(QuadratureType::size);
-
-      auto & quadratureTypeLevel = quadratureCache[qt];
-      std::call_once(quadratureTypeLevel.first, initGeometryTypeVector,
-                     &quadratureTypeLevel.second);
-
-      auto & geometryTypeLevel =
-        quadratureTypeLevel.second[LocalGeometryTypeIndex::index(t)];
-      std::call_once(geometryTypeLevel.first, initQuadratureOrderVector,
-                     &geometryTypeLevel.second, qt, t);
-
-      // we only have one quadrature rule for points
-      auto & quadratureOrderLevel = geometryTypeLevel.second[dim == 0 ? 0 : p];
-      std::call_once(quadratureOrderLevel.first, initQuadratureRule,
-                     &quadratureOrderLevel.second, qt, t, p);
-
-      return quadratureOrderLevel.second;
+      return cache_.entry(t,p,qt,initQuadratureRule);
     }
     //! singleton provider
     DUNE_EXPORT static QuadratureRules& instance()
@@ -210,7 +458,14 @@ namespace Dune {
       return instance;
     }
     //! private constructor
-    QuadratureRules () {}
+    QuadratureRules ()
+      : lookup_(std::size_t(QuadratureType::size)*LocalGeometryTypeIndex::size(dim)*lookupOrders)
+    {}
+
+    //! all rules created so far
+    Impl::QuadratureCache<ctype, dim, QuadratureRuleEntry> cache_;
+    //! pointers to the rules created so far, indexed by lookupIndex
+    std::vector<std::atomic<const QuadratureRuleEntry*> > lookup_;
   public:
     //! maximum quadrature order for given geometry type and quadrature type
     static unsigned
@@ -220,10 +475,29 @@ namespace Dune {
       return QuadratureRuleFactory<ctype,dim>::maxOrder(t,qt);
     }
 
+    /** \brief create all rules of quadrature type qt up to order maxOrder
+     *
+     *  Calling this once at startup, e.g., before spawning threads, makes sure
+     *  that rule() never needs to create a rule later on.  Rules of an order
+     *  higher than supported for some geometry type are skipped.
+     */
+    static void prepopulate(int maxOrder, QuadratureType::Enum qt=QuadratureType::GaussLegendre)
+    {
+      for(std::size_t i = 0; i < LocalGeometryTypeIndex::size(dim); ++i)
+      {
+        const GeometryType t = LocalGeometryTypeIndex::type(dim, i);
+        if(t.isNone())
+          continue;
+        const int order = (dim == 0 ? 0 : std::min(maxOrder, int(QuadratureRules::maxOrder(t,qt))));
+        for(int p = 0; p <= order; ++p)
+          instance()._rule(t,p,qt);
+      }
+    }
+
     //! select the appropriate QuadratureRule for GeometryType t and order p
     static const QuadratureRule& rule(const GeometryType& t, int p, QuadratureType::Enum qt=QuadratureType::GaussLegendre)
     {
-      return instance()._rule(t,p,qt);
+      return instance()._rule(t,p,qt).rule;
     }
 
     DUNE_NO_DEPRECATED_BEGIN
@@ -231,15 +505,29 @@ namespace Dune {
     static const QuadratureRule& rule(const GeometryType::BasicType t, int p, QuadratureType::Enum qt=QuadratureType::GaussLegendre)
     {
       GeometryType gt(t,dim);
-      return instance()._rule(gt,p,qt);
+      return instance()._rule(gt,p,qt).rule;
     }
     DUNE_NO_DEPRECATED_END
+
+    /** \brief select the structure-of-arrays view of the QuadratureRule for
+     *         GeometryType t and order p
+     *
+     *  The view is created once together with the rule returned by rule()
+     *  and holds the same points in the same order.
+     */
+    static const QuadratureRuleSoA& soa(const GeometryType& t, int p, QuadratureType::Enum qt=QuadratureType::GaussLegendre)
+    {
+      return instance()._rule(t,p,qt).soa;
+    }
   };
 
 } // end namespace Dune
 
 #include "quadraturerules/pointquadrature.hh"
 
+#define DUNE_INCLUDING_IMPLEMENTATION
+#include "quadraturerules/gaussjacobiquadrature.hh"
+
 namespace Dune {
 
   //! \internal Helper template for the initialization of the quadrature rules
@@ -268,7 +556,9 @@ namespace Dune {
   public:
     // compile time parameters
     enum { dim=1 };
-    enum { highest_order=61 };
+    enum { highest_order=Impl::GaussJacobiGenerator::highestOrder };
+    //! highest order available from the precomputed tables
+    enum { highest_tabulated_order=61 };
 
     ~GaussQuadratureRule1D(){}
   private:
@@ -280,8 +570,15 @@ namespace Dune {
       std::vector< FieldVector<ct, dim> > _points;
       std::vector< ct > _weight;
 
-      GaussQuadratureInitHelper<ct>::init
-        (p, _points, _weight, this->delivered_order);
+      if (p <= highest_tabulated_order)
+        GaussQuadratureInitHelper<ct>::init
+          (p, _points, _weight, this->delivered_order);
+      else
+      {
+        const int n = p/2 + 1;
+        Impl::GaussJacobiGenerator::gaussJacobi(n, 0, 0, _points, _weight);
+        this->delivered_order = 2*n - 1;
+      }
 
       assert(_points.size() == _weight.size());
       for (size_t i = 0; i < _points.size(); i++)
@@ -330,7 +627,10 @@ namespace Dune {
     enum { dim=1 };
 
     /** \brief The highest quadrature order available */
-    enum { highest_order=61 };
+    enum { highest_order=Impl::GaussJacobiGenerator::highestOrder };
+
+    /** \brief The highest quadrature order available from the precomputed tables */
+    enum { highest_tabulated_order=61 };
 
     ~Jacobi1QuadratureRule1D(){}
   private:
@@ -344,8 +644,15 @@ namespace Dune {
 
       int deliveredOrder_;
 
-      Jacobi1QuadratureInitHelper<ct>::init
-        (p, _points, _weight, deliveredOrder_);
+      if (p <= highest_tabulated_order)
+        Jacobi1QuadratureInitHelper<ct>::init
+          (p, _points, _weight, deliveredOrder_);
+      else
+      {
+        const int n = p/2 + 1;
+        Impl::GaussJacobiGenerator::gaussJacobi(n, 1, 0, _points, _weight);
+        deliveredOrder_ = 2*n - 1;
+      }
       this->delivered_order = deliveredOrder_;
       assert(_points.size() == _weight.size());
       for (size_t i = 0; i < _points.size(); i++)
@@ -396,7 +703,10 @@ namespace Dune {
     enum { dim=1 };
 
     /** \brief The highest quadrature order available */
-    enum { highest_order=61 };
+    enum { highest_order=Impl::GaussJacobiGenerator::highestOrder };
+
+    /** \brief The highest quadrature order available from the precomputed tables */
+    enum { highest_tabulated_order=61 };
 
     ~Jacobi2QuadratureRule1D(){}
   private:
@@ -410,8 +720,15 @@ namespace Dune {
 
       int deliveredOrder_;
 
-      Jacobi2QuadratureInitHelper<ct>::init
-        (p, _points, _weight, deliveredOrder_);
+      if (p <= highest_tabulated_order)
+        Jacobi2QuadratureInitHelper<ct>::init
+          (p, _points, _weight, deliveredOrder_);
+      else
+      {
+        const int n = p/2 + 1;
+        Impl::GaussJacobiGenerator::gaussJacobi(n, 2, 0, _points, _weight);
+        deliveredOrder_ = 2*n - 1;
+      }
 
       this->delivered_order = deliveredOrder_;
       assert(_points.size() == _weight.size());
@@ -463,7 +780,10 @@ namespace Dune {
     enum { dim=1 };
 
     /** \brief The highest quadrature order available */
-    enum { highest_order=31 };
+    enum { highest_order=Impl::GaussJacobiGenerator::highestOrder };
+
+    /** \brief The highest quadrature order available from the precomputed tables */
+    enum { highest_tabulated_order=31 };
 
     ~GaussLobattoQuadratureRule1D(){}
   private:
@@ -477,8 +797,15 @@ namespace Dune {
 
       int deliveredOrder_;
 
-      GaussLobattoQuadratureInitHelper<ct>::init
-        (p, _points, _weight, deliveredOrder_);
+      if (p <= highest_tabulated_order)
+        GaussLobattoQuadratureInitHelper<ct>::init
+          (p, _points, _weight, deliveredOrder_);
+      else
+      {
+        const int n = (p+4)/2;
+        Impl::GaussJacobiGenerator::gaussLobatto(n, _points, _weight);
+        deliveredOrder_ = 2*n - 3;
+      }
 
       this->delivered_order = deliveredOrder_;
       assert(_points.size() == _weight.size());
@@ -501,184 +828,13 @@ namespace Dune {
 
 #include "quadraturerules/simplexquadrature.hh"
 
-namespace Dune {
-
-  /***********************************
-   * quadrature for Prism
-   **********************************/
-
-  /** \todo Please doc me! */
-  template<int dim>
-  class PrismQuadraturePoints;
-
-  /** \todo Please doc me! */
-  template<>
-  class PrismQuadraturePoints<3>
-  {
-  public:
-    enum { MAXP=6};
-    enum { highest_order=2 };
-
-    //! initialize quadrature points on the interval for all orders
-    PrismQuadraturePoints ()
-    {
-      int m = 0;
-      O[m] = 0;
-
-      // polynom degree 0  ???
-      m = 6;
-      G[m][0][0] = 0.0;
-      G[m][0][1] = 0.0;
-      G[m][0][2] = 0.0;
-
-      G[m][1][0] = 1.0;
-      G[m][1][1] = 0.0;
-      G[m][1][2] = 0.0;
-
-      G[m][2][0] = 0.0;
-      G[m][2][1] = 1.0;
-      G[m][2][2] = 0.0;
-
-      G[m][3][0] = 0.0;
-      G[m][3][1] = 0.0;
-      G[m][3][2] = 1.0;
-
-      G[m][4][0] = 1.0;
-      G[m][4][1] = 0.0;
-      G[m][4][2] = 1.0;
-
-      G[m][5][0] = 0.0;
-      G[m][5][1] = 0.1;
-      G[m][5][2] = 1.0;
-
-      W[m][0] = 0.16666666666666666 / 2.0;
-      W[m][1] = 0.16666666666666666 / 2.0;
-      W[m][2] = 0.16666666666666666 / 2.0;
-      W[m][3] = 0.16666666666666666 / 2.0;
-      W[m][4] = 0.16666666666666666 / 2.0;
-      W[m][5] = 0.16666666666666666 / 2.0;
-
-      O[m] = 0;  // verify ????????
-
-
-      // polynom degree 2  ???
-      m = 6;
-      G[m][0][0] =0.66666666666666666 ;
-      G[m][0][1] =0.16666666666666666 ;
-      G[m][0][2] =0.211324865405187 ;
-
-      G[m][1][0] = 0.16666666666666666;
-      G[m][1][1] =0.66666666666666666 ;
-      G[m][1][2] = 0.211324865405187;
-
-      G[m][2][0] = 0.16666666666666666;
-      G[m][2][1] = 0.16666666666666666;
-      G[m][2][2] = 0.211324865405187;
-
-      G[m][3][0] = 0.66666666666666666;
-      G[m][3][1] = 0.16666666666666666;
-      G[m][3][2] = 0.788675134594813;
-
-      G[m][4][0] = 0.16666666666666666;
-      G[m][4][1] = 0.66666666666666666;
-      G[m][4][2] = 0.788675134594813;
-
-      G[m][5][0] = 0.16666666666666666;
-      G[m][5][1] = 0.16666666666666666;
-      G[m][5][2] = 0.788675134594813;
-
-      W[m][0] = 0.16666666666666666 / 2.0;
-      W[m][1] = 0.16666666666666666 / 2.0;
-      W[m][2] = 0.16666666666666666 / 2.0;
-      W[m][3] = 0.16666666666666666 / 2.0;
-      W[m][4] = 0.16666666666666666 / 2.0;
-      W[m][5] = 0.16666666666666666 / 2.0;
-
-      O[m] = 2;  // verify ????????
-
-    }
-
-    /** \todo Please doc me! */
-    FieldVector<double, 3> point(int m, int i)
-    {
-      return G[m][i];
-    }
-
-    /** \todo Please doc me! */
-    double weight (int m, int i)
-    {
-      return W[m][i];
-    }
-
-    /** \todo Please doc me! */
-    int order (int m)
-    {
-      return O[m];
-    }
-
-  private:
-    FieldVector<double, 3> G[MAXP+1][MAXP]; //positions
-
-    double W[MAXP+1][MAXP];     // weights associated with points
-    int O[MAXP+1];              // order of the rule
-  };
-
-
-  /** \brief Singleton holding the Prism Quadrature points
-     \ingroup Quadrature
-   */
-  template<int dim>
-  struct PrismQuadraturePointsSingleton {
-    static PrismQuadraturePoints<3> prqp;
-  };
-
-  /** \brief Singleton holding the Prism Quadrature points
-     \ingroup Quadrature
-   */
-  template<>
-  struct PrismQuadraturePointsSingleton<3> {
-    static PrismQuadraturePoints<3> prqp;
-  };
-
-  /** \brief Quadrature rules for prisms
-      \ingroup Quadrature
-   */
-  template<typename ct, int dim>
-  class PrismQuadratureRule;
-
-  /** \brief Quadrature rules for prisms
-      \ingroup Quadrature
-   */
-  template<typename ct>
-  class PrismQuadratureRule<ct,3> : public QuadratureRule<ct,3>
-  {
-  public:
-
-    /** \brief The space dimension */
-    enum { d = 3 };
+#define DUNE_INCLUDING_IMPLEMENTATION
+#include "quadraturerules/prismquadrature.hh"
 
-    /** \brief The highest quadrature order available */
-    enum { highest_order = 2 };
+#define DUNE_INCLUDING_IMPLEMENTATION
+#include "quadraturerules/pyramidquadrature.hh"
 
-    ~PrismQuadratureRule(){}
-  private:
-    friend class QuadratureRuleFactory<ct,d>;
-    PrismQuadratureRule(int p) : QuadratureRule<ct,3>(GeometryTypes::prism)
-    {
-      int m=6;
-      this->delivered_order = PrismQuadraturePointsSingleton<3>::prqp.order(m);
-      for(int i=0; i<m; ++i)
-      {
-        FieldVector<ct,3> local;
-        for (int k=0; k<d; k++)
-          local[k] = PrismQuadraturePointsSingleton<3>::prqp.point(m,i)[k];
-        double weight =
-          PrismQuadraturePointsSingleton<3>::prqp.weight(m,i);
-        // put in container
-        this->push_back(QuadraturePoint<ct,d>(local,weight));
-      }
-    }
-  };
+namespace Dune {
 
   /** \brief Factory class for creation of quadrature rules,
       depending on GeometryType, order and QuadratureType.
@@ -809,6 +965,9 @@ namespace Dune {
       if (t.isPrism())
         order = std::max
           (order, unsigned(PrismQuadratureRule<ctype,dim>::highest_order));
+      if (t.isPyramid())
+        order = std::max
+          (order, unsigned(PyramidQuadratureRule<ctype,dim>::highest_order));
       return order;
     }
     static QuadratureRule<ctype, dim> rule(const GeometryType& t, int p, QuadratureType::Enum qt)
@@ -825,6 +984,12 @@ namespace Dune {
       {
         return PrismQuadratureRule<ctype,dim>(p);
       }
+      if (t.isPyramid()
+        && qt == QuadratureType::GaussLegendre
+        && p <= PyramidQuadratureRule<ctype,dim>::highest_order)
+      {
+        return PyramidQuadratureRule<ctype,dim>(p);
+      }
       return TensorProductQuadratureRule<ctype,dim>(t.id(), p, qt);
     }
   };
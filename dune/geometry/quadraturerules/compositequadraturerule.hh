@@ -7,12 +7,34 @@
  * \brief Construct composite quadrature rules from other quadrature rules
  */
 
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <dune/common/visibility.hh>
+
 #include <dune/geometry/quadraturerules.hh>
+#include <dune/geometry/referenceelements.hh>
+#include <dune/geometry/refinementmeshcache.hh>
+#include <dune/geometry/typeindex.hh>
 #include <dune/geometry/virtualrefinement.hh>
 
 namespace Dune {
 
   /** \brief Construct composite quadrature rules from other quadrature rules
+   *
+   * The reference element is refined by the StaticRefinement for its type,
+   * and a quadrature rule is placed on each subelement.  Simplices and cubes
+   * are refined into subelements of the same type, which carry the base
+   * rule itself.  Prisms and pyramids are refined into simplices, which carry
+   * the simplex rule of the quadrature type and order of the base rule.
    *
    * \tparam ctype Type used for coordinates and quadrature weights
    * \tparam dim Dimension of the reference element
@@ -23,44 +45,88 @@ namespace Dune {
   {
     public:
     /** \brief Construct composite quadrature rule
-     * \param quad Base quadrature rule.  Element type of this rule must be simplex
+     * \param quad Base quadrature rule
      * \param intervals Number of refined intervals per axis
+     * \param qt Quadrature type of the base rule, used for the simplex rule
+     *           on the subelements of prisms and pyramids
+     * \param numThreads Number of threads to distribute the subelements on
+     *                   (0 means std::thread::hardware_concurrency()).  Small
+     *                   rules are always built by the calling thread.
      */
-    CompositeQuadratureRule(const Dune::QuadratureRule<ctype,dim>& quad, const Dune::RefinementIntervals intervals)
+    CompositeQuadratureRule(const Dune::QuadratureRule<ctype,dim>& quad, const Dune::RefinementIntervals intervals,
+                            QuadratureType::Enum qt = QuadratureType::GaussLegendre, unsigned int numThreads = 0)
       : QuadratureRule<ctype,dim>(quad.type(), quad.order())
     {
-      // Currently only works for simplices, because we are using the StaticRefinement
-      assert(quad.type().isSimplex());
-
-      typedef Dune::StaticRefinement<Dune::Impl::SimplexTopology<dim>::type::id,
-                                     ctype,
-                                     Dune::Impl::SimplexTopology<dim>::type::id,
-                                     dim> Refinement;
-      typedef typename Refinement::ElementIterator eIterator;
-
-      ctype volume = Dune::ReferenceElements<ctype,dim>::general(quad.type()).volume();
-
-      eIterator eSubEnd = Refinement::eEnd(intervals);
-      eIterator eSubIt  = Refinement::eBegin(intervals);
-
-      for (; eSubIt != eSubEnd; ++eSubIt) {
-
-        // Percentage of the overall volume of this subelement
-        ctype volumeFraction = eSubIt.geometry().volume() / volume;
-
-        for (size_t i=0; i<quad.size(); i++) {
+      const GeometryType type = quad.type();
+      const bool triangulate = type.isPrism() || type.isPyramid();
+      const GeometryType coerceTo = triangulate ? Dune::GeometryTypes::simplex(dim) : type;
+      const Dune::QuadratureRule<ctype,dim>& subQuad =
+        triangulate ? Dune::QuadratureRules<ctype,dim>::rule(coerceTo, quad.order(), qt) : quad;
+
+      // The subelement geometries are shared with all other users of the refinement
+      const auto mesh = RefinementMeshCache<dim, ctype>::mesh(type, coerceTo, intervals);
+      const ctype subVolume = Dune::ReferenceElements<ctype,dim>::general(coerceTo).volume();
+
+      const std::size_t nPoints = subQuad.size();
+      const std::size_t nElements = mesh->nElements();
+      std::vector<FieldVector<ctype,dim> > positions(nElements*nPoints);
+      std::vector<ctype> weights(nElements*nPoints);
+
+      // Map the rule into the subelements [begin,end)
+      auto build = [&] (std::size_t begin, std::size_t end) {
+        for (std::size_t e = begin; e < end; ++e) {
+          const auto& geometry = mesh->geometry(e);
+
+          // The subelements are affine, their volume fraction is the integration element
+          const ctype volumeFraction = geometry.volume() / subVolume;
+
+          geometry.global(subQuad, positions.begin() + e*nPoints);
+          for (std::size_t i=0; i<nPoints; i++)
+            weights[e*nPoints + i] = volumeFraction*subQuad[i].weight();
+        }
+      };
 
-          this->push_back(Dune::QuadraturePoint<ctype,dim>(eSubIt.geometry().global(quad[i].position()),
-                                                           volumeFraction*quad[i].weight()));
+      if (numThreads == 0)
+        numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+      numThreads = std::min<std::size_t>(numThreads, 1 + nElements*nPoints / minPointsPerThread);
 
+      // Exceptions must not escape a worker thread, they are rethrown after the join
+      std::vector<std::exception_ptr> errors(numThreads);
+      auto run = [&] (unsigned int t) {
+        try {
+          build(t*nElements / numThreads, (t+1)*nElements / numThreads);
         }
+        catch (...) {
+          errors[t] = std::current_exception();
+        }
+      };
 
+      std::vector<std::thread> threads;
+      try {
+        for (unsigned int t = 1; t < numThreads; ++t)
+          threads.emplace_back(run, t);
+      }
+      catch (...) {
+        // the threads started so far still write into positions and weights
+        for (std::thread& thread : threads)
+          thread.join();
+        throw;
       }
+      run(0);
+      for (std::thread& thread : threads)
+        thread.join();
+
+      for (const std::exception_ptr& error : errors)
+        if (error)
+          std::rethrow_exception(error);
 
+      this->reserve(nElements*nPoints);
+      for (std::size_t k = 0; k < positions.size(); ++k)
+        this->push_back(Dune::QuadraturePoint<ctype,dim>(positions[k], weights[k]));
     }
 
     /** \brief Construct composite quadrature rule
-     * \param quad Base quadrature rule.  Element type of this rule must be simplex
+     * \param quad Base quadrature rule
      * \param refinement Number of uniform refinement steps
      */
     DUNE_DEPRECATED_MSG("CompositeQuadratureRule(QuadratureRule, int) is deprecated, use CompositeQuadratureRule(QuadratureRule, Dune::refinement{Intervals|Levels}(int))")
@@ -68,6 +134,67 @@ namespace Dune {
         : CompositeQuadratureRule(quad, Dune::refinementLevels(refinement))
     { }
 
+    private:
+    //! Minimal number of quadrature points worth a thread of its own
+    static const std::size_t minPointsPerThread = 1 << 14;
+  };
+
+  /** \brief A container for composite quadrature rules
+   *
+   * The rules are created on first use and kept for the lifetime of the
+   * program, just like the QuadratureRules they are built from.
+   *
+   * \tparam ctype Type used for coordinates and quadrature weights
+   * \tparam dim Dimension of the reference element
+   */
+  template <class ctype, int dim>
+  class CompositeQuadratureRules
+  {
+    typedef Dune::CompositeQuadratureRule<ctype,dim> CompositeQuadratureRule;
+    typedef std::tuple<int, std::size_t, int, int> Key;
+
+    DUNE_EXPORT const CompositeQuadratureRule& _rule(const GeometryType& t, int p, const Dune::RefinementIntervals intervals,
+                                                      QuadratureType::Enum qt)
+    {
+      assert(t.dim()==dim);
+
+      const Key key(int(qt), LocalGeometryTypeIndex::index(t), p, intervals.intervals());
+      {
+        std::lock_guard<std::mutex> guard(mutex_);
+        auto it = rules_.find(key);
+        if (it != rules_.end())
+          return *it->second;
+      }
+
+      // build outside the lock, the construction itself is threaded
+      std::unique_ptr<const CompositeQuadratureRule> rule(
+        new CompositeQuadratureRule(QuadratureRules<ctype,dim>::rule(t, p, qt), intervals, qt));
+
+      std::lock_guard<std::mutex> guard(mutex_);
+      // another thread may have been faster, then its rule is kept
+      return *rules_.emplace(key, std::move(rule)).first->second;
+    }
+
+    DUNE_EXPORT static CompositeQuadratureRules& instance()
+    {
+      static CompositeQuadratureRules instance;
+      return instance;
+    }
+
+    CompositeQuadratureRules() {}
+
+    std::mutex mutex_;
+    std::map<Key, std::unique_ptr<const CompositeQuadratureRule> > rules_;
+
+  public:
+    /** \brief select the composite rule built from the QuadratureRule of
+     *         order p for GeometryType t on the given refinement
+     */
+    static const CompositeQuadratureRule& rule(const GeometryType& t, int p, const Dune::RefinementIntervals intervals,
+                                               QuadratureType::Enum qt=QuadratureType::GaussLegendre)
+    {
+      return instance()._rule(t, p, intervals, qt);
+    }
   };
 
 }
@@ -0,0 +1,281 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#ifndef DUNE_GEOMETRY_QUADRATURERULES_GAUSSJACOBIQUADRATURE_HH
+#define DUNE_GEOMETRY_QUADRATURERULES_GAUSSJACOBIQUADRATURE_HH
+
+#ifndef DUNE_INCLUDING_IMPLEMENTATION
+#error This is a private header that should not be included directly.
+#error Use #include <dune/geometry/quadraturerules.hh> instead.
+#endif
+#undef DUNE_INCLUDING_IMPLEMENTATION
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace Dune {
+
+  namespace Impl {
+
+    /** \brief Generator for one-dimensional Gauss-Jacobi and Gauss-Lobatto
+     *         quadrature rules of arbitrary order
+     *
+     *  All computations are done in long double and rounded to the requested
+     *  coordinate type only at the end.
+     *
+     *  The nodes of the n-point Gauss-Jacobi rule are the eigenvalues of the
+     *  symmetric tridiagonal Jacobi matrix built from the three-term recurrence
+     *  of the Jacobi polynomials (Golub-Welsch). The eigenvalues are polished
+     *  by a Newton step on the recurrence and the weights are obtained from
+     *  the Christoffel function.
+     *
+     *  As for the tabulated rules, the generated rules live on [0,1]. The
+     *  Gauss-Jacobi rule with parameters alpha, beta integrates with respect to
+     *  the weight function \f$2^{\alpha+\beta} (1-x)^\alpha x^\beta\f$.
+     */
+    struct GaussJacobiGenerator
+    {
+      typedef long double real;
+
+      //! highest quadrature order provided by the one-dimensional rules
+      static const int highestOrder = 1023;
+
+      /** \brief compute the n-point Gauss-Jacobi rule
+       *
+       *  The rule is exact for polynomials of degree 2n-1.
+       */
+      template<typename ct>
+      static void gaussJacobi (int n, real alpha, real beta,
+                               std::vector< FieldVector<ct, 1> > & points,
+                               std::vector< ct > & weights)
+      {
+        std::vector< real > x, w;
+        gaussJacobi(n, alpha, beta, x, w);
+        assign(x, w, points, weights);
+      }
+
+      /** \brief compute the n-point Gauss-Lobatto rule (n >= 2)
+       *
+       *  The rule contains both end points and is exact for polynomials of
+       *  degree 2n-3.
+       */
+      template<typename ct>
+      static void gaussLobatto (int n,
+                                std::vector< FieldVector<ct, 1> > & points,
+                                std::vector< ct > & weights)
+      {
+        assert(n >= 2);
+
+        // the interior nodes are the zeros of P_{n-1}', i.e., the nodes of
+        // the (n-2)-point Gauss-Jacobi rule for alpha = beta = 1
+        std::vector< real > x, w;
+        gaussJacobi(n-2, 1, 1, x, w);
+        x.insert(x.begin(), real(0));
+        x.push_back(real(1));
+
+        // w_i = 2 / (n (n-1) P_{n-1}(t_i)^2) on [-1,1]
+        w.resize(n);
+        for (int i = 0; i < n; ++i)
+        {
+          const real t = 2*x[i] - 1;
+          real p0 = 1, p1 = t;
+          for (int k = 1; k < n-1; ++k)
+          {
+            const real p2 = ((2*k+1)*t*p1 - k*p0) / (k+1);
+            p0 = p1;
+            p1 = p2;
+          }
+          w[i] = real(1) / (real(n) * real(n-1) * p1 * p1);
+        }
+        assign(x, w, points, weights);
+      }
+
+    private:
+      template<typename ct>
+      static void assign (const std::vector< real > & x, const std::vector< real > & w,
+                          std::vector< FieldVector<ct, 1> > & points,
+                          std::vector< ct > & weights)
+      {
+        points.resize(x.size());
+        weights.resize(w.size());
+        for (std::size_t i = 0; i < x.size(); ++i)
+        {
+          points[i] = ct(x[i]);
+          weights[i] = ct(w[i]);
+        }
+      }
+
+      // diagonal a_k and off-diagonal entries e_k = sqrt(b_k) of the Jacobi
+      // matrix for the orthonormal Jacobi polynomials on [-1,1]
+      static real recurrenceA (int k, real alpha, real beta)
+      {
+        const real s = alpha + beta;
+        if (k == 0)
+          return (beta - alpha) / (s + 2);
+        return (beta*beta - alpha*alpha) / ((2*k + s) * (2*k + s + 2));
+      }
+
+      static real recurrenceE (int k, real alpha, real beta)
+      {
+        using std::sqrt;
+        const real s = alpha + beta;
+        if (k == 1)
+          return sqrt(4 * (1 + alpha) * (1 + beta) / ((2 + s) * (2 + s) * (3 + s)));
+        const real c = 2*k + s;
+        return sqrt(4 * k * (k + alpha) * (k + beta) * (k + s) / (c * c * (c + 1) * (c - 1)));
+      }
+
+      // eigenvalues of a symmetric tridiagonal matrix (implicit QL)
+      static void tridiagonalEigenvalues (std::vector< real > & d, std::vector< real > e)
+      {
+        using std::abs;
+        using std::sqrt;
+        const int n = d.size();
+        e.push_back(real(0));
+        for (int l = 0; l < n; ++l)
+        {
+          for (int iter = 0; iter < 100; ++iter)
+          {
+            int m = l;
+            for (; m < n-1; ++m)
+            {
+              const real dd = abs(d[m]) + abs(d[m+1]);
+              if (abs(e[m]) <= std::numeric_limits< real >::epsilon() * dd)
+                break;
+            }
+            if (m == l)
+              break;
+
+            real g = (d[l+1] - d[l]) / (2 * e[l]);
+            real r = sqrt(g*g + 1);
+            g = d[m] - d[l] + e[l] / (g + (g >= 0 ? r : -r));
+            real s = 1, c = 1, p = 0;
+            int i = m-1;
+            for (; i >= l; --i)
+            {
+              real f = s * e[i];
+              const real b = c * e[i];
+              r = sqrt(f*f + g*g);
+              e[i+1] = r;
+              if (r == real(0))
+              {
+                d[i+1] -= p;
+                e[m] = 0;
+                break;
+              }
+              s = f / r;
+              c = g / r;
+              g = d[i+1] - p;
+              r = (d[i] - g) * s + 2 * c * b;
+              p = s * r;
+              d[i+1] = g + p;
+              g = c * r - b;
+            }
+            if ((r == real(0)) && (i >= l))
+              continue;
+            d[l] -= p;
+            e[l] = g;
+            e[m] = 0;
+          }
+        }
+      }
+
+      static void gaussJacobi (int n, real alpha, real beta,
+                               std::vector< real > & x, std::vector< real > & w)
+      {
+        using std::abs;
+        using std::exp;
+        using std::lgamma;
+        using std::log;
+
+        x.resize(n);
+        w.resize(n);
+        if (n == 0)
+          return;
+
+        std::vector< real > a(n), e(n+1);
+        for (int k = 0; k < n; ++k)
+          a[k] = recurrenceA(k, alpha, beta);
+        e[0] = 0;
+        for (int k = 1; k <= n; ++k)
+          e[k] = recurrenceE(k, alpha, beta);
+
+        // Golub-Welsch: nodes are the eigenvalues of the Jacobi matrix
+        std::vector< real > t(a);
+        tridiagonalEigenvalues(t, std::vector< real >(e.begin()+1, e.begin()+n));
+        std::sort(t.begin(), t.end());
+
+        // integral of the weight function (1-t)^alpha (1+t)^beta over [-1,1]
+        const real mu0 = exp((alpha + beta + 1) * log(real(2)) + lgamma(alpha + 1) + lgamma(beta + 1) - lgamma(alpha + beta + 2));
+
+        for (int i = 0; i < n; ++i)
+        {
+          // Newton polishing on the orthonormal recurrence; the sum of the
+          // squared polynomials yields the Christoffel function
+          real sum = 0;
+          for (int iter = 0; iter < 3; ++iter)
+          {
+            real p0 = 0, p1 = 1, dp0 = 0, dp1 = 0;
+            sum = 1;
+            for (int k = 0; k < n; ++k)
+            {
+              const real p2 = ((t[i] - a[k]) * p1 - e[k] * p0) / e[k+1];
+              const real dp2 = (p1 + (t[i] - a[k]) * dp1 - e[k] * dp0) / e[k+1];
+              p0 = p1; p1 = p2;
+              dp0 = dp1; dp1 = dp2;
+              if (k < n-1)
+                sum += p1 * p1;
+            }
+            const real dt = p1 / dp1;
+            t[i] -= dt;
+            if (abs(dt) <= std::numeric_limits< real >::epsilon())
+              break;
+          }
+
+          // map from [-1,1] to [0,1]
+          x[i] = (t[i] + 1) / 2;
+          w[i] = mu0 / (2 * sum);
+        }
+      }
+    };
+
+  } // namespace Impl
+
+  /** \brief Gauss-Jacobi quadrature rule of arbitrary order in 1D
+      \ingroup Quadrature
+
+      The rule integrates on [0,1] with respect to the weight function
+      \f$2^{\alpha+\beta} (1-x)^\alpha x^\beta\f$, the scaling being the same as
+      for Jacobi1QuadratureRule1D and Jacobi2QuadratureRule1D. The points and
+      weights are computed on construction (in long double precision); use
+      QuadratureRules to obtain cached rules for the standard cases.
+   */
+  template<typename ct>
+  class GaussJacobiQuadratureRule1D :
+    public QuadratureRule<ct,1>
+  {
+  public:
+    /** \brief The space dimension */
+    enum { dim=1 };
+
+    /** \brief construct a rule of order (at least) p for the parameters alpha and beta */
+    GaussJacobiQuadratureRule1D (int p, double alpha = 0, double beta = 0)
+      : QuadratureRule<ct,1>(GeometryTypes::line)
+    {
+      std::vector< FieldVector<ct, dim> > _points;
+      std::vector< ct > _weight;
+
+      const int n = (p < 0 ? 1 : p/2 + 1);
+      Impl::GaussJacobiGenerator::gaussJacobi(n, alpha, beta, _points, _weight);
+      this->delivered_order = 2*n - 1;
+
+      for (size_t i = 0; i < _points.size(); i++)
+        this->push_back(QuadraturePoint<ct,dim>(_points[i], _weight[i]));
+    }
+  };
+
+} // namespace Dune
+
+#endif // #ifndef DUNE_GEOMETRY_QUADRATURERULES_GAUSSJACOBIQUADRATURE_HH
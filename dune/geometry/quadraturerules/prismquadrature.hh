@@ -0,0 +1,309 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#ifndef DUNE_GEOMETRY_QUADRATURERULES_PRISMQUADRATURE_HH
+#define DUNE_GEOMETRY_QUADRATURERULES_PRISMQUADRATURE_HH
+
+#ifndef DUNE_INCLUDING_IMPLEMENTATION
+#error This is a private header that should not be included directly.
+#error Use #include <dune/geometry/quadraturerules.hh> instead.
+#endif
+#undef DUNE_INCLUDING_IMPLEMENTATION
+
+namespace Dune {
+
+  /***********************************
+   * quadrature for Prism
+   **********************************/
+
+  /** \brief Quadrature points on the prism
+      \ingroup Quadrature
+   */
+  template<int dim>
+  class PrismQuadraturePoints;
+
+  /** \brief Fully symmetric quadrature points on the prism
+
+      The rule of order m is invariant under the symmetries of the prism,
+      i.e., the permutations of the triangle and the reflection z -> 1-z.
+      All points are inside the prism and all weights are positive.
+   */
+  template<>
+  class PrismQuadraturePoints<3>
+  {
+  public:
+    enum { MAXP=91};
+    enum { highest_order=10 };
+
+    //! initialize quadrature points for all orders
+    PrismQuadraturePoints ()
+    {
+      // The rules have been computed by solving the moment equations for
+      // the invariant polynomials of the prism with a Levenberg-Marquardt
+      // method, starting from random orbit configurations, and taking the
+      // configuration with the least number of points for which a solution
+      // with interior points and positive weights has been found.
+
+      int m, i;
+
+      // polynom degree 1
+      // fully symmetric, 1 point, positive weight
+
+      m = 1;
+      i = addCentroid(m, 0, 0.5, 0.5);
+      O[m] = 1;
+
+      // polynom degree 2
+      // fully symmetric, 5 points, positive weights
+
+      m = 2;
+      i = addCentroid(m, 0, 0.04195622722151006595, 0.099298982020192119724);
+      i = addOrbit3(m, i, 0.11866861992270219539, 0.5, 0.10046734531987192018);
+      O[m] = 2;
+
+      // polynom degree 3
+      // fully symmetric, 8 points, positive weights
+
+      m = 3;
+      i = addCentroid(m, 0, 0.016476789307133355572, 0.089109521105665362439);
+      i = addOrbit6(m, i, 0.23768711698462977044, 0.030975743051775438131, 0.5, 0.053630159631444879187);
+      O[m] = 3;
+
+      // polynom degree 4
+      // fully symmetric, 11 points, positive weights
+
+      m = 4;
+      i = addCentroid(m, 0, 0.066569012995482595985, 0.053955987407767753983);
+      i = addOrbit3(m, i, 0.46865580986199523172, 0.5, 0.068207306302738815451);
+      i = addOrbit3(m, i, 0.10074040579891063718, 0.16218008815887013929, 0.031244351046041337477);
+      O[m] = 4;
+
+      // polynom degree 5
+      // fully symmetric, 16 points, positive weights
+
+      m = 5;
+      i = addCentroid(m, 0, 0.5, 0.088931944491435863109);
+      i = addOrbit3(m, i, 0.48729996455024565671, 0.5, 0.028088758403533357899);
+      i = addOrbit3(m, i, 0.44559810467037203052, 0.064498532567277971905, 0.023207677664519768546);
+      i = addOrbit3(m, i, 0.10085894598270853106, 0.2147865096474203539, 0.031259285718474243143);
+      O[m] = 5;
+
+      // polynom degree 6
+      // fully symmetric, 28 points, positive weights
+
+      m = 6;
+      i = addCentroid(m, 0, 0.22199923713894686994, 0.028136322445292145239);
+      i = addCentroid(m, i, 9.9711132455697703918e-05, 0.016151432153738588121);
+      i = addOrbit3(m, i, 0.023509033288112480414, 0.5, 0.0067615613080632096243);
+      i = addOrbit3(m, i, 0.1691012248187195588, 0.5, 0.03965506972637491967);
+      i = addOrbit3(m, i, 0.46662592976996647431, 0.25885731278298079738, 0.024165609246491998041);
+      i = addOrbit6(m, i, 0.76257429103177365448, 0.034773780148586959371, 0.095456817308512950659, 0.01059841185163934614);
+      O[m] = 6;
+
+      // polynom degree 7
+      // fully symmetric, 38 points, positive weights
+
+      m = 7;
+      i = addCentroid(m, 0, 0.61031545347181670458, 0.032961050814999309777);
+      i = addOrbit3(m, i, 0.040894001721549833039, 0.5, 0.0083177931591784711601);
+      i = addOrbit3(m, i, 0.49576635113619793582, 0.5, 0.014233880565647940783);
+      i = addOrbit3(m, i, 0.43811787245794209245, 0.94089082267610091304, 0.017203121503684023347);
+      i = addOrbit6(m, i, 0.8419486204253147088, 0.0043866489387042661638, 0.061166071926128919023, 0.0037341807912318115449);
+      i = addOrbit6(m, i, 0.095649976146222948081, 0.66921439712501951114, 0.26392933778637123199, 0.018199498223219690712);
+      O[m] = 7;
+
+      // polynom degree 8
+      // fully symmetric, 48 points, positive weights
+
+      m = 8;
+      i = addCentroid(m, 0, 0.5, 0.019162791943469426048);
+      i = addCentroid(m, i, 0.07405913924450371888, 0.014784602242977991013);
+      i = addOrbit3(m, i, 0.46913981755211897617, 0.5, 0.022207743977364718946);
+      i = addOrbit3(m, i, 0.11687205198160739716, 0.021439255472481360404, 0.0053505044223839193576);
+      i = addOrbit3(m, i, 0.02414575085883362629, 0.1428892509796803878, 0.0022209702740953289613);
+      i = addOrbit3(m, i, 0.46062522822395823852, 0.056973523439686958592, 0.0096522278576725590443);
+      i = addOrbit3(m, i, 0.21193362150965436297, 0.27168166696248735592, 0.02422561480908580131);
+      i = addOrbit6(m, i, 0.84371471431004296804, 0.10577500582435861443, 0.5, 0.0073297175799436481425);
+      i = addOrbit6(m, i, 0.020736457980917669813, 0.25557227916544306145, 0.19947381722964069306, 0.007664213498282740171);
+      O[m] = 8;
+
+      // polynom degree 9
+      // fully symmetric, 64 points, positive weights
+
+      m = 9;
+      i = addCentroid(m, 0, 0.7137131477309324179, 0.02201874304950629524);
+      i = addCentroid(m, i, 0.015659335285123265197, 0.0061638041084165675482);
+      i = addOrbit3(m, i, 0.03308571583841739272, 0.42387091758951916942, 0.0022222698272585149695);
+      i = addOrbit3(m, i, 0.049112110732686196923, 0.071303185762812026915, 0.0031786023922388698462);
+      i = addOrbit3(m, i, 0.44965626344414538762, 0.18092748282438153584, 0.017209290145104760156);
+      i = addOrbit3(m, i, 0.18549777523783900213, 0.058574323901613496723, 0.009460798635605730672);
+      i = addOrbit6(m, i, 0.59032007375019146522, 0.14539195760494633136, 0.5, 0.01538733842378795999);
+      i = addOrbit6(m, i, 0.46111257164503233197, 0.53114091811053287806, 0.5, 0.0039800336167358837253);
+      i = addOrbit6(m, i, 0.039883454961489525625, 0.76743894933845735462, 0.27115745169987737206, 0.0090044584176449758012);
+      i = addOrbit6(m, i, 0.65839785286956242771, 0.014322242851089595286, 0.030166654600942480885, 0.0022459505356686856534);
+      O[m] = 9;
+
+      // polynom degree 10
+      // fully symmetric, 91 points, positive weights
+
+      m = 10;
+      i = addCentroid(m, 0, 0.5, 0.020955180230557104992);
+      i = addOrbit3(m, i, 0.016093001665554711177, 0.5, 0.0014582808888873033393);
+      i = addOrbit3(m, i, 0.42775224222681229591, 0.5, 0.0095246681520644686791);
+      i = addOrbit3(m, i, 0.030920366572350192758, 0.0071681563320446567075, 0.00061933257410307313105);
+      i = addOrbit3(m, i, 0.44627361549991367839, 0.0048210084137861675471, 0.0034808060294557732414);
+      i = addOrbit3(m, i, 0.27007531763851555517, 0.10488716077339206578, 0.0088324445318534380855);
+      i = addOrbit3(m, i, 0.13788065041209762729, 0.054120044135844390387, 0.0056407431220023901072);
+      i = addOrbit3(m, i, 0.48016795734290029785, 0.19302043913985877932, 0.0064279173177780634177);
+      i = addOrbit6(m, i, 0.36208383004476552003, 0.6260919055732403482, 0.5, 0.0043327994694134413026);
+      i = addOrbit6(m, i, 0.098372118676387065861, 0.019711988873640617914, 0.197132937842516065, 0.0027935724831501134759);
+      i = addOrbit6(m, i, 0.13183968925599262589, 0.28754979129777979985, 0.28305068506124780869, 0.01148959642083385857);
+      i = addOrbit6(m, i, 0.16996586506397290406, 0.054644999154969620125, 0.39748240951422081357, 0.0050301309580749967859);
+      i = addOrbit6(m, i, 0.020933398536083103886, 0.28174033452638069797, 0.078564722643360965226, 0.0031943430028535738097);
+      O[m] = 10;
+    }
+
+    //! return the i-th point of the rule of order m
+    FieldVector<double, 3> point(int m, int i)
+    {
+      return G[m][i];
+    }
+
+    //! return the weight of the i-th point of the rule of order m
+    double weight (int m, int i)
+    {
+      return W[m][i];
+    }
+
+    //! return the order of the rule of order m
+    int order (int m)
+    {
+      return O[m];
+    }
+
+    //! return the number of points of the rule of order m
+    int size (int m)
+    {
+      return N[m];
+    }
+
+  private:
+    // the points of the triangle orbit x at height z and, unless z = 1/2,
+    // at height 1-z; returns the index of the next point
+    int addLayers (int m, int i, int n, const double (*x)[2], double z, double w)
+    {
+      for (int k = 0; k < n; ++k)
+      {
+        G[m][i][0] = x[k][0];
+        G[m][i][1] = x[k][1];
+        G[m][i][2] = z;
+        W[m][i++] = w;
+        if (z != 0.5)
+        {
+          G[m][i][0] = x[k][0];
+          G[m][i][1] = x[k][1];
+          G[m][i][2] = 1.0 - z;
+          W[m][i++] = w;
+        }
+      }
+      N[m] = i;
+      return i;
+    }
+
+    // the barycenter of the triangle
+    int addCentroid (int m, int i, double z, double w)
+    {
+      const double x[1][2] = { { 1.0/3.0, 1.0/3.0 } };
+      return addLayers(m, i, 1, x, z, w);
+    }
+
+    // all points with barycentric coordinates (a, a, 1-2a) in the triangle
+    int addOrbit3 (int m, int i, double a, double z, double w)
+    {
+      const double b = 1.0 - 2.0*a;
+      const double x[3][2] = { { a, a }, { a, b }, { b, a } };
+      return addLayers(m, i, 3, x, z, w);
+    }
+
+    // all points with barycentric coordinates (a, b, 1-a-b) in the triangle
+    int addOrbit6 (int m, int i, double a, double b, double z, double w)
+    {
+      const double c = 1.0 - a - b;
+      const double x[6][2] = { { a, b }, { b, a }, { a, c }, { c, a }, { b, c }, { c, b } };
+      return addLayers(m, i, 6, x, z, w);
+    }
+
+    FieldVector<double, 3> G[highest_order+1][MAXP]; //positions
+
+    double W[highest_order+1][MAXP];     // weights associated with points
+    int O[highest_order+1];              // order of the rule
+    int N[highest_order+1];              // number of points of the rule
+  };
+
+
+  /** \brief Singleton holding the Prism Quadrature points
+     \ingroup Quadrature
+   */
+  template<int dim>
+  struct PrismQuadraturePointsSingleton {
+    static PrismQuadraturePoints<3> prqp;
+  };
+
+  /** \brief Singleton holding the Prism Quadrature points
+     \ingroup Quadrature
+   */
+  template<>
+  struct PrismQuadraturePointsSingleton<3> {
+    static PrismQuadraturePoints<3> prqp;
+  };
+
+  /** \brief Quadrature rules for prisms
+      \ingroup Quadrature
+   */
+  template<typename ct, int dim>
+  class PrismQuadratureRule;
+
+  /** \brief Fully symmetric quadrature rules for prisms
+      \ingroup Quadrature
+
+      The rules need considerably fewer points than the tensor product of a
+      triangle rule and a Gauss-Legendre rule, see PrismQuadraturePoints<3>.
+   */
+  template<typename ct>
+  class PrismQuadratureRule<ct,3> : public QuadratureRule<ct,3>
+  {
+  public:
+
+    /** \brief The space dimension */
+    enum { d = 3 };
+
+    /** \brief The highest quadrature order available */
+    enum { highest_order = PrismQuadraturePoints<3>::highest_order };
+
+    ~PrismQuadratureRule(){}
+  private:
+    friend class QuadratureRuleFactory<ct,d>;
+    PrismQuadratureRule(int p) : QuadratureRule<ct,3>(GeometryTypes::prism)
+    {
+      if (p > highest_order)
+        DUNE_THROW(QuadratureOrderOutOfRange,
+                   "QuadratureRule for order " << p << " and GeometryType "
+                                               << this->type() << " not available");
+
+      const int m = std::max(p, 1);
+      this->delivered_order = PrismQuadraturePointsSingleton<3>::prqp.order(m);
+      for(int i=0; i<PrismQuadraturePointsSingleton<3>::prqp.size(m); ++i)
+      {
+        FieldVector<ct,3> local;
+        for (int k=0; k<d; k++)
+          local[k] = PrismQuadraturePointsSingleton<3>::prqp.point(m,i)[k];
+        double weight =
+          PrismQuadraturePointsSingleton<3>::prqp.weight(m,i);
+        // put in container
+        this->push_back(QuadraturePoint<ct,d>(local,weight));
+      }
+    }
+  };
+
+} // end namespace Dune
+
+#endif // DUNE_GEOMETRY_QUADRATURERULES_PRISMQUADRATURE_HH
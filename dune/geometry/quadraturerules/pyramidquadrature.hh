@@ -0,0 +1,295 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#ifndef DUNE_GEOMETRY_QUADRATURERULES_PYRAMIDQUADRATURE_HH
+#define DUNE_GEOMETRY_QUADRATURERULES_PYRAMIDQUADRATURE_HH
+
+#ifndef DUNE_INCLUDING_IMPLEMENTATION
+#error This is a private header that should not be included directly.
+#error Use #include <dune/geometry/quadraturerules.hh> instead.
+#endif
+#undef DUNE_INCLUDING_IMPLEMENTATION
+
+namespace Dune {
+
+  /***********************************
+   * quadrature for Pyramid
+   **********************************/
+
+  /** \brief Quadrature points on the pyramid
+      \ingroup Quadrature
+   */
+  template<int dim>
+  class PyramidQuadraturePoints;
+
+  /** \brief Fully symmetric quadrature points on the pyramid
+
+      The rule of order m is invariant under the symmetries of the pyramid,
+      i.e., the symmetries of the square base. All points are inside the
+      pyramid and all weights are positive.
+   */
+  template<>
+  class PyramidQuadraturePoints<3>
+  {
+  public:
+    enum { MAXP=69};
+    enum { highest_order=9 };
+
+    //! initialize quadrature points for all orders
+    PyramidQuadraturePoints ()
+    {
+      // The rules have been computed in the same way as the rules for the
+      // prism, see PrismQuadraturePoints<3>. A point is given by its height z
+      // and by its offset (s, t) in [-1,1]^2 from the axis, relative to the
+      // cross section [0,1-z]^2 of the pyramid at height z, see addAxis,
+      // addOrbit4 and addOrbit8.
+
+      int m, i;
+
+      // polynom degree 1
+      // fully symmetric, 1 point, positive weight
+
+      m = 1;
+      i = addAxis(m, 0, 0.25, 0.33333333333333331483);
+      O[m] = 1;
+
+      // polynom degree 2
+      // fully symmetric, 5 points, positive weights
+
+      m = 2;
+      i = addAxis(m, 0, 0.63011240827990910862, 0.068686812521160003908);
+      i = addOrbit4(m, i, 0.15134497274189070981, 0.5914119393890174825, 0.5914119393890174825, 0.0661616302030433312);
+      O[m] = 2;
+
+      // polynom degree 3
+      // fully symmetric, 6 points, positive weights
+
+      m = 3;
+      i = addAxis(m, 0, 0.55764898159556630652, 0.091690574522947237979);
+      i = addAxis(m, i, 0.067760055328154752963, 0.081608450609428798139);
+      i = addOrbit4(m, i, 0.16666666666666665741, 0.77451363566283815132, 0.77451363566283815132, 0.040008577050239323147);
+      O[m] = 3;
+
+      // polynom degree 4
+      // fully symmetric, 10 points, positive weights
+
+      m = 4;
+      i = addAxis(m, 0, 0.1251369531087464515, 0.068961134196517420714);
+      i = addAxis(m, i, 0.67723278888613736015, 0.037913961056880648992);
+      i = addOrbit4(m, i, 0.32238414957821365237, 0.96010380511800874626, 0.0, 0.03544152929644183575);
+      i = addOrbit4(m, i, 0.039248283898815350401, 0.68484602847422260119, 0.68484602847422260119, 0.02117303022354198247);
+      O[m] = 4;
+
+      // polynom degree 5
+      // fully symmetric, 15 points, positive weights
+
+      m = 5;
+      i = addAxis(m, 0, 0.73164211038716764346, 0.022361705572204588349);
+      i = addAxis(m, i, 0.0048201981656365586529, 0.021116782038899901269);
+      i = addAxis(m, i, 0.25525555654672854589, 0.060365457903306288245);
+      i = addOrbit4(m, i, 0.125, 0.88697276656030732411, 0.0, 0.017500323933486508499);
+      i = addOrbit4(m, i, 0.42114411104835164368, 0.71010967281281123231, 0.71010967281281123231, 0.022580928793935691606);
+      i = addOrbit4(m, i, 0.067559338449482808642, 0.71010967281281123231, 0.71010967281281123231, 0.017291094227308439341);
+      O[m] = 5;
+
+      // polynom degree 6
+      // fully symmetric, 23 points, positive weights
+
+      m = 6;
+      i = addAxis(m, 0, 0.08788098410244685188, 0.03139805344327465525);
+      i = addAxis(m, i, 0.81075926483256843813, 0.0083130510053509420326);
+      i = addAxis(m, i, 0.32619885743124893418, 0.042759461230747468352);
+      i = addOrbit4(m, i, 0.54883861374588638338, 0.91205180509679262268, 0.0, 0.014033270903001406754);
+      i = addOrbit4(m, i, 0.096326874466742165581, 0.92605050927109477943, 0.0, 0.012125675582067790489);
+      i = addOrbit4(m, i, 0.023779954251414599925, 0.99577562001904196265, 0.99577562001904196265, 0.0012169962593614673356);
+      i = addOrbit4(m, i, 0.028194533952503052915, 0.56492175073850214861, 0.56492175073850214861, 0.01221864453199849633);
+      i = addOrbit4(m, i, 0.24774115911348199015, 0.69939293503135946395, 0.69939293503135946395, 0.023121104637060903991);
+      O[m] = 6;
+
+      // polynom degree 7
+      // fully symmetric, 33 points, positive weights
+
+      m = 7;
+      i = addAxis(m, 0, 0.81578696211958345863, 0.0073483089561316144306);
+      i = addOrbit4(m, i, 0.33333333333333331483, 0.92582009977255141919, 0.0, 0.0095703125000000006939);
+      i = addOrbit4(m, i, 0.066666666666666665741, 0.92582009977255141919, 0.0, 0.008897253097667638666);
+      i = addOrbit4(m, i, 0.032352179197269896604, 0.38041093511555873485, 0.38041093511555873485, 0.010709522002540180705);
+      i = addOrbit4(m, i, 0.24436173957802553858, 0.80626507824597370977, 0.80626507824597370977, 0.0093794437626642888223);
+      i = addOrbit4(m, i, 0.19431906115829761239, 0.3809094048335630589, 0.3809094048335630589, 0.019978457276043734558);
+      i = addOrbit4(m, i, 0.045979368660896705046, 0.80591251546686615281, 0.80591251546686615281, 0.0064086523291239814656);
+      i = addOrbit4(m, i, 0.61415689577258902876, 0.79549261065542486993, 0.79549261065542486993, 0.0052831020287421419368);
+      i = addOrbit4(m, i, 0.48728346044856196695, 0.37731173423465225181, 0.37731173423465225181, 0.01126951309751846389);
+      O[m] = 7;
+
+      // polynom degree 8
+      // fully symmetric, 44 points, positive weights
+
+      m = 8;
+      i = addAxis(m, 0, 0.22998361095400796095, 0.030234994836820419661);
+      i = addAxis(m, i, 0.56197767352916228045, 0.011675981288818779863);
+      i = addAxis(m, i, 0.69119883345370314309, 0.0041352331896280011131);
+      i = addAxis(m, i, 0.86866938996941400752, 0.0028552224832751891062);
+      i = addOrbit4(m, i, 0.44001616996750581023, 0.89010146610451490456, 0.0, 0.0072317400551549721258);
+      i = addOrbit4(m, i, 0.043806487609569830233, 0.51305553366294998074, 0.0, 0.012488815783653314448);
+      i = addOrbit4(m, i, 0.1692217384963671245, 0.94655222140071026971, 0.0, 0.0079840946766679896096);
+      i = addOrbit4(m, i, 0.080853062826951427322, 0.90802878466234326904, 0.90802878466234326904, 0.0024584082390672655841);
+      i = addOrbit4(m, i, 0.17244294359877784806, 0.6068717612658488525, 0.6068717612658488525, 0.015689553205015652204);
+      i = addOrbit4(m, i, 0.67354284151951304693, 0.76136313814436928915, 0.76136313814436928915, 0.0041108352346373227756);
+      i = addOrbit4(m, i, 0.39021961442004282627, 0.55320329488144548424, 0.55320329488144548424, 0.011290419324939883483);
+      i = addOrbit4(m, i, 0.32350840653701984362, 0.94515054794752029199, 0.94515054794752029199, 0.0024430526435710304793);
+      i = addOrbit8(m, i, 0.022994450986628826861, 0.47628439790208049187, -0.88769360966332511165, 0.0037055281104951521241);
+      O[m] = 8;
+
+      // polynom degree 9
+      // fully symmetric, 69 points, positive weights
+
+      m = 9;
+      i = addAxis(m, 0, 0.16003918335978387089, 0.013130356086090503795);
+      i = addOrbit4(m, i, 0.39673811943035491856, -0.54525702896762440197, 0.0, 0.01216782020573896686);
+      i = addOrbit4(m, i, 0.85149024626693414763, 0.83937556478490649159, 0.0, 0.0010189896311196863354);
+      i = addOrbit4(m, i, 0.034873271532407150441, 0.49890991059361555759, 0.0, 0.0096160717408290564273);
+      i = addOrbit4(m, i, 0.19602496957237233732, 0.57909505417180617837, 0.0, 0.0090386317976055008394);
+      i = addOrbit4(m, i, 0.034173309919160448078, 0.69774825596562117802, 0.69774825596562117802, 0.0040602081176194645615);
+      i = addOrbit4(m, i, 0.62091581019845243361, 0.89225813075895943349, 0.89225813075895943349, 0.0014675835222035611607);
+      i = addOrbit4(m, i, 0.16263024826851832372, 0.56371346143579503796, 0.56371346143579503796, 0.0082806937559552918487);
+      i = addOrbit4(m, i, 0.18129277966811926937, 0.87840976484114274836, 0.87840976484114274836, 0.0033058133080012155718);
+      i = addOrbit4(m, i, 0.037025614742468800078, 0.93793588859750209874, 0.93793588859750209874, 0.00091188086609837618133);
+      i = addOrbit8(m, i, 0.63813973031631354704, 0.098720191280378469245, 0.68552996726798032245, 0.0032507122998026724905);
+      i = addOrbit8(m, i, 0.032767158389335769575, 0.91926205370058644561, 0.35602585418095028524, 0.0028112914738994561857);
+      i = addOrbit8(m, i, 0.38483335776210925161, 0.91714490696424089133, 0.53939782235703248592, 0.0049420768461487128362);
+      i = addOrbit8(m, i, 0.16381564361623696113, 0.92340898107669133754, 0.3136934650164934224, 0.0040874450634689517628);
+      O[m] = 9;
+    }
+
+    //! return the i-th point of the rule of order m
+    FieldVector<double, 3> point(int m, int i)
+    {
+      return G[m][i];
+    }
+
+    //! return the weight of the i-th point of the rule of order m
+    double weight (int m, int i)
+    {
+      return W[m][i];
+    }
+
+    //! return the order of the rule of order m
+    int order (int m)
+    {
+      return O[m];
+    }
+
+    //! return the number of points of the rule of order m
+    int size (int m)
+    {
+      return N[m];
+    }
+
+  private:
+    // the point with offset (s, t) at height z
+    void setPoint (int m, int i, double z, double s, double t, double w)
+    {
+      G[m][i][0] = 0.5*(1.0 - z)*(1.0 + s);
+      G[m][i][1] = 0.5*(1.0 - z)*(1.0 + t);
+      G[m][i][2] = z;
+      W[m][i] = w;
+    }
+
+    // the point on the axis at height z; returns the index of the next point
+    int addAxis (int m, int i, double z, double w)
+    {
+      setPoint(m, i, z, 0.0, 0.0, w);
+      N[m] = i+1;
+      return i+1;
+    }
+
+    // the rotations of the offset (s, t) by multiples of 90 degrees, i.e.,
+    // all images of (a, 0) or (a, a) under the symmetries of the square
+    int addOrbit4 (int m, int i, double z, double s, double t, double w)
+    {
+      setPoint(m, i, z, s, t, w);
+      setPoint(m, i+1, z, -t, s, w);
+      setPoint(m, i+2, z, -s, -t, w);
+      setPoint(m, i+3, z, t, -s, w);
+      N[m] = i+4;
+      return i+4;
+    }
+
+    // all images of the offset (s, t) under the symmetries of the square
+    int addOrbit8 (int m, int i, double z, double s, double t, double w)
+    {
+      return addOrbit4(m, addOrbit4(m, i, z, s, t, w), z, t, s, w);
+    }
+
+    FieldVector<double, 3> G[highest_order+1][MAXP]; //positions
+
+    double W[highest_order+1][MAXP];     // weights associated with points
+    int O[highest_order+1];              // order of the rule
+    int N[highest_order+1];              // number of points of the rule
+  };
+
+
+  /** \brief Singleton holding the Pyramid Quadrature points
+     \ingroup Quadrature
+   */
+  template<int dim>
+  struct PyramidQuadraturePointsSingleton {};
+
+  /** \brief Singleton holding the Pyramid Quadrature points
+     \ingroup Quadrature
+   */
+  template<>
+  struct PyramidQuadraturePointsSingleton<3> {
+    static PyramidQuadraturePoints<3> pyqp;
+  };
+
+  /** \brief Quadrature rules for pyramids
+      \ingroup Quadrature
+   */
+  template<typename ct, int dim>
+  class PyramidQuadratureRule;
+
+  /** \brief Fully symmetric quadrature rules for pyramids
+      \ingroup Quadrature
+
+      The rules need considerably fewer points than the conical product
+      rules, see PyramidQuadraturePoints<3>.
+   */
+  template<typename ct>
+  class PyramidQuadratureRule<ct,3> : public QuadratureRule<ct,3>
+  {
+  public:
+
+    /** \brief The space dimension */
+    enum { d = 3 };
+
+    /** \brief The highest quadrature order available */
+    enum { highest_order = PyramidQuadraturePoints<3>::highest_order };
+
+    ~PyramidQuadratureRule(){}
+  private:
+    friend class QuadratureRuleFactory<ct,d>;
+    PyramidQuadratureRule(int p) : QuadratureRule<ct,3>(GeometryTypes::pyramid)
+    {
+      if (p > highest_order)
+        DUNE_THROW(QuadratureOrderOutOfRange,
+                   "QuadratureRule for order " << p << " and GeometryType "
+                                               << this->type() << " not available");
+
+      const int m = std::max(p, 1);
+      this->delivered_order = PyramidQuadraturePointsSingleton<3>::pyqp.order(m);
+      for(int i=0; i<PyramidQuadraturePointsSingleton<3>::pyqp.size(m); ++i)
+      {
+        FieldVector<ct,3> local;
+        for (int k=0; k<d; k++)
+          local[k] = PyramidQuadraturePointsSingleton<3>::pyqp.point(m,i)[k];
+        double weight =
+          PyramidQuadraturePointsSingleton<3>::pyqp.weight(m,i);
+        // put in container
+        this->push_back(QuadraturePoint<ct,d>(local,weight));
+      }
+    }
+  };
+
+} // end namespace Dune
+
+#endif // DUNE_GEOMETRY_QUADRATURERULES_PYRAMIDQUADRATURE_HH
@@ -14,6 +14,9 @@ namespace Dune {
   /** Singleton holding the Prism Quadrature points  */
   PrismQuadraturePoints<3> PrismQuadraturePointsSingleton<3>::prqp;
 
+  /** Singleton holding the Pyramid Quadrature points  */
+  PyramidQuadraturePoints<3> PyramidQuadraturePointsSingleton<3>::pyqp;
+
   template SimplexQuadratureRule<float, 2>::SimplexQuadratureRule(int);
   template SimplexQuadratureRule<double, 2>::SimplexQuadratureRule(int);
   template SimplexQuadratureRule<float, 3>::SimplexQuadratureRule(int);
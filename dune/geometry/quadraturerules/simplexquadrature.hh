@@ -23,7 +23,7 @@ namespace Dune {
   {
   public:
     /** \brief The highest quadrature order available */
-    enum { highest_order = 12 };
+    enum { highest_order = 20 };
   private:
     friend class QuadratureRuleFactory<ct,2>;
     SimplexQuadratureRule (int p);
@@ -38,7 +38,7 @@ namespace Dune {
   {
   public:
     /** \brief The highest quadrature order available */
-    enum { highest_order = 5 };
+    enum { highest_order = 10 };
   private:
     friend class QuadratureRuleFactory<ct,3>;
     SimplexQuadratureRule (int p);
@@ -67,8 +67,8 @@ namespace Dune {
   class SimplexQuadraturePoints<2>
   {
   public:
-    enum { MAXP=33};
-    enum { highest_order=12 };
+    enum { MAXP=84};
+    enum { highest_order=20 };
 
     //! initialize quadrature points on the interval for all orders
     SimplexQuadraturePoints ()
@@ -737,6 +737,167 @@ namespace Dune {
       W[m][31] = 0.5 * 0.017316231108659;
       W[m][32] = 0.5 * 0.017316231108659;
       O[m] = 12;
+
+      // The following rules have been computed by solving the moment
+      // equations for fully symmetric rules with interior points and positive
+      // weights in extended precision. The number of points is close to the
+      // minimal numbers reported in F.D. Witherden, P.E. Vincent, "On the
+      // identification of symmetric quadrature rules for finite element
+      // methods", Comput. Math. Appl. 69 (2015), 1232-1241.
+      // The coordinates are given in barycentric coordinates, see addOrbit3
+      // and addOrbit6.
+
+      int i;
+
+      // polynom degree 13
+      // fully symmetric, 37 inner points, positive weights
+
+      m = 37;
+      i = addCentroid(m, 0, 0.033980018293415822174);
+      i = addOrbit3(m, i, 0.48907694645253934994, 0.011997200964447365338);
+      i = addOrbit3(m, i, 0.22137228629183290054, 0.029139242559599990714);
+      i = addOrbit3(m, i, 0.42694141425980040595, 0.027800983765226664342);
+      i = addOrbit3(m, i, 0.021509681108843183806, 0.0030261685517695859057);
+      i = addOrbit6(m, i, 0.11092204280346339503, 0.86470777029544277574, 0.0074827005525828335991);
+      i = addOrbit6(m, i, 0.74850711589995219517, 0.087895483032197324220, 0.012089519905796909664);
+      i = addOrbit6(m, i, 0.27251581777342966583, 0.72235779312418796556, 0.0047953405017716313625);
+      i = addOrbit6(m, i, 0.62354599555367557021, 0.30844176089211777534, 0.017320638070424185206);
+      O[m] = 13;
+
+      // polynom degree 14
+      // fully symmetric, 42 inner points, positive weights
+
+      m = 42;
+      i = addOrbit3(m, 0, 0.41764471934045392253, 0.016394176772062675322);
+      i = addOrbit3(m, i, 0.27347752830883865976, 0.025887052253645793163);
+      i = addOrbit3(m, i, 0.17720553241254343696, 0.021081294368496508773);
+      i = addOrbit3(m, i, 0.019390961248701048163, 0.0024617018012000408405);
+      i = addOrbit3(m, i, 0.48896391036217863867, 0.010941790684714445324);
+      i = addOrbit3(m, i, 0.061799883090872601264, 0.0072168498348883338024);
+      i = addOrbit6(m, i, 0.092916249356971824767, 0.57022229084668317348, 0.019285755393530341616);
+      i = addOrbit6(m, i, 0.17226668782135557836, 0.057124757403647939044, 0.012332876606281836983);
+      i = addOrbit6(m, i, 0.11897449769695684541, 0.87975717137017112951, 0.0025051144192503358858);
+      i = addOrbit6(m, i, 0.014646950055654409689, 0.29837288213625775299, 0.0072181540567669202491);
+      O[m] = 14;
+
+      // polynom degree 15
+      // fully symmetric, 49 inner points, positive weights
+
+      m = 49;
+      i = addCentroid(m, 0, 0.024777380743035579817);
+      i = addOrbit3(m, i, 0.079031013655541635007, 0.0092433943023307730581);
+      i = addOrbit3(m, i, 0.40886316907744105976, 0.019011381726930579259);
+      i = addOrbit3(m, i, 0.49250168823249670531, 0.0067052581900064143782);
+      i = addOrbit3(m, i, 0.018789501810770077603, 0.0022485768962175402793);
+      i = addOrbit6(m, i, 0.098765911355712115938, 0.69872859059598790713, 0.015087322572773133727);
+      i = addOrbit6(m, i, 0.077663767064308164079, 0.55349674918711643207, 0.015630213780078803024);
+      i = addOrbit6(m, i, 0.78345022567320812357, 0.021594628433980258574, 0.0061808086085778203206);
+      i = addOrbit6(m, i, 0.89514624528794883412, 0.012563596287784997708, 0.0032209366452594664873);
+      i = addOrbit6(m, i, 0.53877851064220142445, 0.26709528567005227261, 0.014605445387471889401);
+      i = addOrbit6(m, i, 0.65975989271796938704, 0.32515745241110782863, 0.0058747373242569702675);
+      O[m] = 15;
+
+      // polynom degree 16
+      // fully symmetric, 55 inner points, positive weights
+
+      m = 55;
+      i = addCentroid(m, 0, 0.023285054705086549472);
+      i = addOrbit3(m, i, 0.49221060853955518700, 0.0069794202658214571771);
+      i = addOrbit3(m, i, 0.24247548463607194562, 0.0024271270430109961237);
+      i = addOrbit3(m, i, 0.18107805173735438346, 0.015270381617910553168);
+      i = addOrbit3(m, i, 0.0062883330624728897176, 0.00051077379852769042012);
+      i = addOrbit6(m, i, 0.015089339252307962060, 0.81414205017533430717, 0.0050869923397174259437);
+      i = addOrbit6(m, i, 0.92272653498808957222, 0.016117026002306335504, 0.0033988764404700571671);
+      i = addOrbit6(m, i, 0.32786720253495676725, 0.48388307019161461728, 0.019234271417161505368);
+      i = addOrbit6(m, i, 0.37921154152835610292, 0.080197523669796557672, 0.014098485236461041979);
+      i = addOrbit6(m, i, 0.69269317440268757653, 0.079326560819270444930, 0.012125945601625144908);
+      i = addOrbit6(m, i, 0.66394920687014741300, 0.015572712194018957126, 0.0065260284208662768176);
+      i = addOrbit6(m, i, 0.071993541146850657998, 0.81605332720024660224, 0.0063880400635487744587);
+      O[m] = 16;
+
+      // polynom degree 17
+      // fully symmetric, 61 inner points, positive weights
+
+      m = 61;
+      i = addCentroid(m, 0, 0.016358974612404985747);
+      i = addOrbit3(m, i, 0.46300927095736209865, 0.013156226277626211475);
+      i = addOrbit3(m, i, 0.27217887488682529780, 0.011622832222317520608);
+      i = addOrbit3(m, i, 0.099238206338597439702, 0.0053636702433737595046);
+      i = addOrbit3(m, i, 0.046805803501678291806, 0.0047129043920631252801);
+      i = addOrbit6(m, i, 0.76330660077422001039, 0.067318119491886813270, 0.0083938266788006055724);
+      i = addOrbit6(m, i, 0.071889744697672339908, 0.30598342097513231598, 0.011859433778569477159);
+      i = addOrbit6(m, i, 0.34118728626448467542, 0.48659604403723779275, 0.016288610732114600493);
+      i = addOrbit6(m, i, 0.96714791665835570401, 0.030542142997043102257, 0.00087480232114615966722);
+      i = addOrbit6(m, i, 0.25058689437692963130, 0.013757382108554370486, 0.0051757815981501769993);
+      i = addOrbit6(m, i, 0.014266173531424473739, 0.40897045138074374437, 0.0060541746426407980750);
+      i = addOrbit6(m, i, 0.013686922043753461002, 0.11963792679877366441, 0.0038564022447237175589);
+      i = addOrbit6(m, i, 0.15409525834270281416, 0.21255946936015865767, 0.010675989000763325083);
+      O[m] = 17;
+
+      // polynom degree 18
+      // fully symmetric, 70 inner points, positive weights
+
+      m = 70;
+      i = addCentroid(m, 0, 0.0082206451233105995239);
+      i = addOrbit3(m, i, 0.38081688119604642249, 0.013546258791032511859);
+      i = addOrbit3(m, i, 0.15787153678371904313, 0.0093595117371927202661);
+      i = addOrbit3(m, i, 0.24439189653868387698, 0.016061459089252104459);
+      i = addOrbit3(m, i, 0.061869054632242487060, 0.0049809252665368380442);
+      i = addOrbit3(m, i, 0.012634503380170505520, 0.0010386520054793777607);
+      i = addOrbit6(m, i, 0.25888709477904267797, 0.61679643273259897643, 0.010502722799649956366);
+      i = addOrbit6(m, i, 0.53619831578448204134, 0.40258958737967472322, 0.0089705162206201661103);
+      i = addOrbit6(m, i, 0.011906313992465200935, 0.41784012598411716678, 0.0045856468112820593683);
+      i = addOrbit6(m, i, 0.065007627293849759573, 0.011580866153765794303, 0.0021383400446868002965);
+      i = addOrbit6(m, i, 0.49157842708367653701, 0.14213550949465736625, 0.011235434036921460431);
+      i = addOrbit6(m, i, 0.71832840691683092903, 0.0072163491376441625193, 0.0027048859620935617230);
+      i = addOrbit6(m, i, 0.15094907228754455753, 0.069347871802352403264, 0.0078558655706183202507);
+      i = addOrbit6(m, i, 0.046523886063308648614, 0.27191065453041884668, 0.0077626163023246092239);
+      i = addOrbit6(m, i, 0.013879048530266846481, 0.83230704195742344906, 0.0037137946198378567403);
+      O[m] = 18;
+
+      // polynom degree 19
+      // fully symmetric, 76 inner points, positive weights
+
+      m = 76;
+      i = addCentroid(m, 0, 0.013398177810636952221);
+      i = addOrbit3(m, i, 0.22123482057246617337, 0.010881090895283794774);
+      i = addOrbit3(m, i, 0.062614836287085778798, 0.0048595044753953549563);
+      i = addOrbit3(m, i, 0.012967095027593449137, 0.0010975197799312978109);
+      i = addOrbit6(m, i, 0.33127340457247451733, 0.22144210678267210717, 0.012127971307674219438);
+      i = addOrbit6(m, i, 0.010180357176110808771, 0.56822708895917500198, 0.0037868360168058064954);
+      i = addOrbit6(m, i, 0.37249576199638591636, 0.12517542036788412620, 0.011040007297310411260);
+      i = addOrbit6(m, i, 0.14999564650489275519, 0.79259117829915275063, 0.0065741113811524853651);
+      i = addOrbit6(m, i, 0.011052332593149477748, 0.82962891537560243163, 0.0030693206408511083108);
+      i = addOrbit6(m, i, 0.12485246463402422245, 0.62683225102113973028, 0.010111635297912710801);
+      i = addOrbit6(m, i, 0.052655806491810227848, 0.54461969406555258143, 0.0082133844705946012699);
+      i = addOrbit6(m, i, 0.72397486461890687840, 0.14354696804780182108, 0.0046096353817214198818);
+      i = addOrbit6(m, i, 0.68020796456289588615, 0.26749262971425385958, 0.0074378793095653240117);
+      i = addOrbit6(m, i, 0.067073602086010763707, 0.92091142526355418082, 0.0022823300315055078193);
+      i = addOrbit6(m, i, 0.70861805026992243312, 0.28130536098648476880, 0.0034281349878283561890);
+      O[m] = 19;
+
+      // polynom degree 20
+      // fully symmetric, 84 inner points, positive weights
+
+      m = 84;
+      i = addOrbit3(m, 0, 0.45192242011832985848, 0.011194152247445869821);
+      i = addOrbit3(m, i, 0.037870712477587102246, 0.0027809680917639301700);
+      i = addOrbit3(m, i, 0.20831362293985387258, 0.013741669827155416992);
+      i = addOrbit3(m, i, 0.082522232631651498762, 0.0054980555370093755603);
+      i = addOrbit3(m, i, 0.49014015244831041142, 0.0033315937598116590706);
+      i = addOrbit3(m, i, 0.29413960823225491958, 0.013271867365835018064);
+      i = addOrbit6(m, i, 0.90307408749816712470, 0.010072504024850599266, 0.0020734989577727881969);
+      i = addOrbit6(m, i, 0.56892663028935293296, 0.42707160338098478956, 0.0013966029200619382658);
+      i = addOrbit6(m, i, 0.67717501268447201780, 0.0083921796209820555355, 0.0025965777528163536513);
+      i = addOrbit6(m, i, 0.18580030502994918989, 0.34330615474151064396, 0.012706213507981808029);
+      i = addOrbit6(m, i, 0.19097952438535913182, 0.80329554894467735787, 0.0019504513561346317375);
+      i = addOrbit6(m, i, 0.038516499049695873817, 0.81911411398335119254, 0.0045435462660720136427);
+      i = addOrbit6(m, i, 0.0031019064871050487502, 0.022584598156280654429, 0.00054291724063032322837);
+      i = addOrbit6(m, i, 0.10573970402743836244, 0.17871958851006558704, 0.0089478831366225775684);
+      i = addOrbit6(m, i, 0.59494150646746442638, 0.29849001665983432896, 0.010705869400721694780);
+      i = addOrbit6(m, i, 0.38518156435081321275, 0.57216955234180739271, 0.0068789479555546695559);
+      i = addOrbit6(m, i, 0.25064889561978625408, 0.040326318643690942905, 0.0060816714244538998213);
+      O[m] = 20;
     }
 
     FieldVector<double, 2> point(int m, int i)
@@ -755,6 +916,42 @@ namespace Dune {
     }
 
   private:
+    // the centroid; returns the index of the next point
+    int addCentroid (int m, int i, double w)
+    {
+      G[m][i] = 1.0/3.0;
+      W[m][i] = w;
+      return i+1;
+    }
+
+    // all points with barycentric coordinates (a, a, 1-2a)
+    int addOrbit3 (int m, int i, double a, double w)
+    {
+      const double b = 1.0 - 2.0*a;
+      const double x[3][2] = { { a, a }, { a, b }, { b, a } };
+      for (int k = 0; k < 3; ++k, ++i)
+      {
+        G[m][i][0] = x[k][0];
+        G[m][i][1] = x[k][1];
+        W[m][i] = w;
+      }
+      return i;
+    }
+
+    // all points with barycentric coordinates (a, b, 1-a-b)
+    int addOrbit6 (int m, int i, double a, double b, double w)
+    {
+      const double c = 1.0 - a - b;
+      const double x[6][2] = { { a, b }, { b, a }, { a, c }, { c, a }, { b, c }, { c, b } };
+      for (int k = 0; k < 6; ++k, ++i)
+      {
+        G[m][i][0] = x[k][0];
+        G[m][i][1] = x[k][1];
+        W[m][i] = w;
+      }
+      return i;
+    }
+
     FieldVector<double, 2> G[MAXP+1][MAXP];
 
     double W[MAXP+1][MAXP];     // weights associated with points
@@ -811,7 +1008,31 @@ namespace Dune {
     case 12 :
       m=33;
       break;
-    default : m=33;
+    case 13 :
+      m=37;
+      break;
+    case 14 :
+      m=42;
+      break;
+    case 15 :
+      m=49;
+      break;
+    case 16 :
+      m=55;
+      break;
+    case 17 :
+      m=61;
+      break;
+    case 18 :
+      m=70;
+      break;
+    case 19 :
+      m=76;
+      break;
+    case 20 :
+      m=84;
+      break;
+    default : m=84;
     }
 
     this->delivered_order = SimplexQuadraturePointsSingleton<2>::sqp.order(m);
@@ -830,8 +1051,8 @@ namespace Dune {
   class SimplexQuadraturePoints<3>
   {
   public:
-    enum { MAXP=15};
-    enum { highest_order=5 };
+    enum { MAXP=89};
+    enum { highest_order=10 };
 
     //! initialize quadrature points on the interval for all orders
     SimplexQuadraturePoints()
@@ -1015,6 +1236,75 @@ namespace Dune {
       W[m][14] = C;
       O[m] = 5;
 
+      // The following rules have been computed in the same way as the
+      // triangle rules of order 13 and higher, see SimplexQuadraturePoints<2>.
+      // The coordinates are given in barycentric coordinates, see addOrbit4,
+      // addOrbit6, addOrbit12 and addOrbit24.
+
+      int i;
+
+      // polynom degree 6
+      // fully symmetric, 24 inner points, positive weights
+
+      m = 24;
+      i = addOrbit4(m, 0, 0.21460287125915202932, 0.0066537917096945820116);
+      i = addOrbit4(m, i, 0.32233789014227551034, 0.0092261969239424536870);
+      i = addOrbit4(m, i, 0.040673958534611353101, 0.0016795351758867738242);
+      i = addOrbit12(m, i, 0.063661001875017525294, 0.26967233145831580801, 0.0080357142857142857175);
+      O[m] = 6;
+
+      // polynom degree 7
+      // fully symmetric, 35 inner points, positive weights
+
+      m = 35;
+      i = addCentroid(m, 0, 0.015914214910688474807);
+      i = addOrbit4(m, i, 0.31570114977820279943, 0.0070549302016611715129);
+      i = addOrbit6(m, i, 0.050489822598396368756, 0.0053161546388095966549);
+      i = addOrbit12(m, i, 0.021265472541483245983, 0.14663881381848494691, 0.0013517951383172235941);
+      i = addOrbit12(m, i, 0.18883383102600104774, 0.047160700360997881059, 0.0062011884547224368943);
+      O[m] = 7;
+
+      // polynom degree 8
+      // fully symmetric, 46 inner points, positive weights
+
+      m = 46;
+      i = addOrbit4(m, 0, 0.31555698131265242374, 0.0047723370955827422588);
+      i = addOrbit4(m, i, 0.18589621968287834244, 0.0097253541972492876488);
+      i = addOrbit4(m, i, 0.075241800873506305352, 0.0030935791986304016073);
+      i = addOrbit4(m, i, 0.0029864883330316357708, 0.00012954939220704599079);
+      i = addOrbit6(m, i, 0.44296532825103433076, 0.0052991891939023230025);
+      i = addOrbit12(m, i, 0.21073223335640306139, 0.025553866454961862259, 0.0039482139243978582012);
+      i = addOrbit12(m, i, 0.026111684612337222420, 0.73325715220774040142, 0.0013841404063167100170);
+      O[m] = 8;
+
+      // polynom degree 9
+      // fully symmetric, 61 inner points, positive weights
+
+      m = 61;
+      i = addCentroid(m, 0, 0.0096255907208369513285);
+      i = addOrbit4(m, i, 0.034938495937859609884, 0.00073010480449562173159);
+      i = addOrbit4(m, i, 0.31432607103711677677, 0.0065459359965439049492);
+      i = addOrbit4(m, i, 0.15325282393868967563, 0.0073986275737670385791);
+      i = addOrbit6(m, i, 0.089427631888452163566, 0.0051777848120120394520);
+      i = addOrbit6(m, i, 0.48992886034629643069, 0.00068904575946289210084);
+      i = addOrbit12(m, i, 0.040392064069416694819, 0.18294626026132219757, 0.0020763048556453767637);
+      i = addOrbit24(m, i, 0.56235066715029261443, 0.14243401922542022923, 0.010709681785211497371, 0.0015927400312503893271);
+      O[m] = 9;
+
+      // polynom degree 10
+      // fully symmetric, 89 inner points, positive weights
+
+      m = 89;
+      i = addCentroid(m, 0, 0.0085743195190500507778);
+      i = addOrbit4(m, i, 0.023229023144883106455, 0.00024512369483312283498);
+      i = addOrbit12(m, i, 0.11693993856673921163, 0.26712254504083691439, 0.0040703141215879270490);
+      i = addOrbit12(m, i, 0.11143000847416679892, 0.71570511391603007571, 0.00070533720007271643788);
+      i = addOrbit12(m, i, 0.026889434657654187601, 0.80611237785467631113, 0.00083879720426817744543);
+      i = addOrbit12(m, i, 0.41097020263724468991, 0.16910505830772480866, 0.0015454250480386611570);
+      i = addOrbit12(m, i, 0.033941965797062136071, 0.34341215145795809594, 0.0017461610725512578247);
+      i = addOrbit12(m, i, 0.17365254267688127900, 0.017252111828523167937, 0.0017943789427587684245);
+      i = addOrbit12(m, i, 0.35368177545833000524, 0.065961898080143774602, 0.0023922407747461687048);
+      O[m] = 10;
     }
 
     FieldVector<double, 3> point(int m, int i)
@@ -1033,6 +1323,53 @@ namespace Dune {
     }
 
   private:
+    // the centroid; returns the index of the next point
+    int addCentroid (int m, int i, double w)
+    {
+      G[m][i] = 0.25;
+      W[m][i] = w;
+      return i+1;
+    }
+
+    // all distinct permutations of the barycentric coordinates l; returns
+    // the index of the next point
+    int addPermutations (int m, int i, std::array<double, 4> l, double w)
+    {
+      std::sort(l.begin(), l.end());
+      do
+      {
+        G[m][i][0] = l[1];
+        G[m][i][1] = l[2];
+        G[m][i][2] = l[3];
+        W[m][i++] = w;
+      } while (std::next_permutation(l.begin(), l.end()));
+      return i;
+    }
+
+    // all points with barycentric coordinates (a, a, a, 1-3a)
+    int addOrbit4 (int m, int i, double a, double w)
+    {
+      return addPermutations(m, i, {{ a, a, a, 1.0 - 3.0*a }}, w);
+    }
+
+    // all points with barycentric coordinates (a, a, 1/2-a, 1/2-a)
+    int addOrbit6 (int m, int i, double a, double w)
+    {
+      return addPermutations(m, i, {{ a, a, 0.5 - a, 0.5 - a }}, w);
+    }
+
+    // all points with barycentric coordinates (a, a, b, 1-2a-b)
+    int addOrbit12 (int m, int i, double a, double b, double w)
+    {
+      return addPermutations(m, i, {{ a, a, b, 1.0 - 2.0*a - b }}, w);
+    }
+
+    // all points with barycentric coordinates (a, b, c, 1-a-b-c)
+    int addOrbit24 (int m, int i, double a, double b, double c, double w)
+    {
+      return addPermutations(m, i, {{ a, b, c, 1.0 - a - b - c }}, w);
+    }
+
     FieldVector<double, 3> G[MAXP+1][MAXP];
     double W[MAXP+1][MAXP];     // weights associated with points
     int O[MAXP+1];              // order of the rule
@@ -1064,7 +1401,22 @@ namespace Dune {
     case 5 :
       m=15;
       break;
-    default : m=15;
+    case 6 :
+      m=24;
+      break;
+    case 7 :
+      m=35;
+      break;
+    case 8 :
+      m=46;
+      break;
+    case 9 :
+      m=61;
+      break;
+    case 10 :
+      m=89;
+      break;
+    default : m=89;
     }
     this->delivered_order = SimplexQuadraturePointsSingleton<3>::sqp.order(m);
 
@@ -0,0 +1,1342 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+//
+// The values in this file are copied from gauss_imp.hh (Gauss-Legendre
+// rules up to order 31) and from the triangle and tetrahedron rules in
+// simplexquadrature.hh (rounded to double, as they are used there).
+// Both sources only assign double values for fundamental types, so the
+// tables are double as well.  test-quadrature checks that both sources agree
+// for float, double and long double.
+
+#ifndef DUNE_INCLUDING_IMPLEMENTATION
+#error This is a private header that should not be included directly.
+#error Use #include <dune/geometry/quadraturerules/staticquadraturerule.hh> instead.
+#endif
+#undef DUNE_INCLUDING_IMPLEMENTATION
+
+namespace Dune {
+
+namespace Impl {
+
+  // The tables are static data members of class templates, so that they can
+  // be defined in a header.
+
+  //! one-dimensional Gauss-Legendre rules with n = 1, ..., size points
+  template< class = void >
+  struct StaticGaussLegendreTable
+  {
+    //! number of tabulated rules; the n-th rule has n points
+    static constexpr int size = 16;
+
+    //! index of the first point of the rule with n points
+    static constexpr int offset ( int n ) { return n*(n-1)/2; }
+
+    static constexpr double points[] = {
+      // 1 point
+      0.5,
+      // 2 points
+      0.2113248654051871177454256097490212721761991243649365619906988367580111638485333271531423022071252374,
+      0.7886751345948128822545743902509787278238008756350634380093011632419888361514666728468576977928747626,
+      // 3 points
+      0.8872983346207416885179265399782399610832921705291590826587573766113483091936979033519287376858673518,
+      0.1127016653792583114820734600217600389167078294708409173412426233886516908063020966480712623141326482,
+      0.5,
+      // 4 points
+      0.9305681557970262876119732444464047525478626898148588188078609604532647357475244328520811699422396526,
+      0.0694318442029737123880267555535952474521373101851411811921390395467352642524755671479188300577603474,
+      0.3300094782075718675986671204483776563997120651145428237035230115894899847683814827610623597822225942,
+      0.6699905217924281324013328795516223436002879348854571762964769884105100152316185172389376402177774058,
+      // 5 points
+      0.953089922969331996398813439149696482562825955381265431436881143271885397458343423470571494776771131,
+      0.04691007703066800360118656085030351743717404461873456856311885672811460254165657652942850522322886904,
+      0.7692346550528415455181572103501044024836433034527799781011158135297355926838776455179018336252854658,
+      0.2307653449471584544818427896498955975163566965472200218988841864702644073161223544820981663747145342,
+      0.5,
+      // 6 points
+      0.03376524289842398609384922275300269543261713114385508756372519173669324957789990186185563003903700748,
+      0.9662347571015760139061507772469973045673828688561449124362748082633067504221000981381443699609629925,
+      0.8306046932331322568306997975099526735032242821975850354072633529260917483035715504721432018732307282,
+      0.1693953067668677431693002024900473264967757178024149645927366470739082516964284495278567981267692718,
+      0.6193095930415984543152508608403559677093053150700106750906975822871374671378199211246122136286745658,
+      0.3806904069584015456847491391596440322906946849299893249093024177128625328621800788753877863713254342,
+      // 7 points
+      0.9745539561713792622630948420239256312003854688353088917743845519565316651774200704028653850139628621,
+      0.02544604382862073773690515797607436879961453116469110822561544804346833482257992959713461498603713794,
+      0.1292344072003027800680676133596057964629261764293048699400223240162850626639097431035865838165683765,
+      0.8707655927996972199319323866403942035370738235706951300599776759837149373360902568964134161834316235,
+      0.2970774243113014165466967939615192683263089929503149368064783741026680933869371723358436551361267061,
+      0.7029225756886985834533032060384807316736910070496850631935216258973319066130628276641563448638732939,
+      0.5,
+      // 8 points
+      0.9801449282487681158417804342847364952141176171507260191358198886862124488717096422197194796316561341,
+      0.01985507175123188415821956571526350478588238284927398086418011131378755112829035778028052036834386592,
+      0.1016667612931866302042230317620847815814141341920175839649148524803913471617634539264240363521370304,
+      0.8983332387068133697957769682379152184185858658079824160350851475196086528382365460735759636478629696,
+      0.237233795041835507091130475405376825479017878439803571124571450363772589615719363738019299903184009,
+      0.762766204958164492908869524594623174520982121560196428875428549636227410384280636261980700096815991,
+      0.4082826787521750975302619288199080096666210935435131088414057631503977628892289429419658881444383231,
+      0.5917173212478249024697380711800919903333789064564868911585942368496022371107710570580341118555616769,
+      // 9 points
+      0.01591988024618695508221189854816356497529759975403733522498834407545981280169962346906312538655294424,
+      0.9840801197538130449177881014518364350247024002459626647750116559245401871983003765309368746134470557,
+      0.08198444633668210285028510596513256172794664093766200194781401018027249655920494055302690148707122983,
+      0.9180155536633178971497148940348674382720533590623379980521859898197275034407950594469730985129287703,
+      0.8066857163502951986543510196707370923928603024702823464364064711406336732455005992916200069517842923,
+      0.1933142836497048013456489803292629076071396975297176535635935288593663267544994007083799930482157077,
+      0.3378732882980955354807309926783316957140218696315134555864762615789067102324378754034506991507512164,
+      0.6621267117019044645192690073216683042859781303684865444135237384210932897675621245965493008492487836,
+      0.5,
+      // 10 points
+      0.9869532642585858600389820060422260267141349733461910596156060333482976016173180798128617824781342781,
+      0.01304673574141413996101799395777397328586502665380894038439396665170239838268192018713821752186572192,
+      0.9325316833444922553660483442117465242637715074826652262609798659226873775690277806783953644730228854,
+      0.06746831665550774463395165578825347573622849251733477373902013407731262243097221932160463552697711466,
+      0.1602952158504877968828363174425632121153526440825952661675914055237207123024625376924607132147598102,
+      0.8397047841495122031171636825574367878846473559174047338324085944762792876975374623075392867852401898,
+      0.2833023029353764046003670284171079188999640811718767517486492434281165054611482493874486210249411394,
+      0.7166976970646235953996329715828920811000359188281232482513507565718834945388517506125513789750588606,
+      0.4255628305091843945575869994351400076912175702896541521460053732420481913221657393144111851002681544,
+      0.5744371694908156054424130005648599923087824297103458478539946267579518086778342606855888148997318456,
+      // 11 points
+      0.01088567092697150359803099943857130461428879554010779228709946700816810030955500589984030091632761502,
+      0.9891143290730284964019690005614286953857112044598922077129005329918318996904449941001596990836723848,
+      0.9435312998840476495375788846519636333158378756126571924837055277688056569286863337211452975632986873,
+      0.05646870011595235046242111534803636668416212438734280751629447223119434307131366627885470243670131297,
+      0.86507600278702466204670812601557672902482153101306515598918916984350662252925961479771170548564185,
+      0.13492399721297533795329187398442327097517846898693484401081083015649337747074038520228829451435815,
+      0.2404519353965940920371371652706952227598864424400357554895386942566520367744635535872006099477254724,
+      0.7595480646034059079628628347293047772401135575599642445104613057433479632255364464127993900522745276,
+      0.6347715779761724861657659927004307623398109312195261408119628159400285331118473678519107961221336507,
+      0.3652284220238275138342340072995692376601890687804738591880371840599714668881526321480892038778663493,
+      0.5,
+      // 12 points
+      0.009219682876640374654725454925359588519922400093134244768658939096103377840873008887371366054773882871,
+      0.9907803171233596253452745450746404114800775999068657552313410609038966221591269911126286339452261171,
+      0.9520586281852374283392329330595480962687983546066487732770378803406173978646178952434847139118666353,
+      0.0479413718147625716607670669404519037312016453933512267229621196593826021353821047565152860881333648,
+      0.8849513370971523435184469166064090379924628750094658188322095321245582715542356120082124996117109545,
+      0.1150486629028476564815530833935909620075371249905341811677904678754417284457643879917875003882890453,
+      0.7936589771433087236483512094702671401845492570240262407551354398336703496879476312178553824943741012,
+      0.2063410228566912763516487905297328598154507429759737592448645601663296503120523687821446175056258989,
+      0.3160842505009099031236542316781412193718199293322951893441000602479550352416060630606327857497267114,
+      0.6839157494990900968763457683218587806281800706677048106558999397520449647583939369393672142502732886,
+      0.5626167042557344577362206847319265649916984581527221366064608773742310281206948443714341492347456798,
+      0.4373832957442655422637793152680734350083015418472778633935391226257689718793051556285658507652543202,
+      // 13 points
+      0.9920915273592940747364147244035548055324952809629374543470036602142976189378134209302846436307092946,
+      0.007908472640705925263585275596445194467504719037062545652996339785702381062186579069715356369290706896,
+      0.9587991996114889826032739182503597561952373950558416479476426728298296042948049571417426951702914619,
+      0.04120080038851101739672608174964024380476260494415835205235732717017039570519504285825730482970853578,
+      0.9007890453666549563971032447914299451528078623952500149486923569296110581133200610150149370926585299,
+      0.09921095463334504360289675520857005484719213760474998505130764307038894188667993898498506290734147097,
+      0.1788253302798298896780076965022421749641513008692115713054287960406782234275032125428058499429042223,
+      0.8211746697201701103219923034977578250358486991307884286945712039593217765724967874571941500570957777,
+      0.724246375518223426438956426063819933900960833720878939479141473729122046033108571822519104277366505,
+      0.2757536244817765735610435739361800660990391662791210605208585262708779539668914281774808957226334949,
+      0.6152291579775673970327640605489944176057711879417655817346307489185810418442909754064014723823400647,
+      0.3847708420224326029672359394510055823942288120582344182653692510814189581557090245935985276176599353,
+      0.5,
+      // 14 points
+      0.006858095651593830579201366647973599161954296380387059177964594111125222933754181044676880167424125515,
+      0.9931419043484061694207986333520264008380457036196129408220354058888747770662458189553231198325758757,
+      0.9642174418317867586681955696889371322385196052049188093589812237410655467721799265557069528418287599,
+      0.03578255816821324133180443031106286776148039479508119064101877625893445322782007344429304715817123803,
+      0.9136006575348824965948973713251974805198505507375405907803545271207399154050144367852131950689447722,
+      0.08639934246511750340510262867480251948014944926245940921964547287926008459498556321478680493105522878,
+      0.8436464524058427350740099015096670687692006063735853378096332443140924480915666284736865352526059193,
+      0.1563535475941572649259900984903329312307993936264146621903667556859075519084333715263134647473940806,
+      0.2423756818209229540173546407244056688455573587153469815242476154536075240839721697739639898246135538,
+      0.7576243181790770459826453592755943311544426412846530184757523845463924759160278302260360101753864463,
+      0.3404438155360551197821640879157622665828693982330780217016749063713332797436036084175331472893267934,
+      0.6595561844639448802178359120842377334171306017669219782983250936286667202563963915824668527106732066,
+      0.4459725256463281689668776748900826261940241972628812214795894693459932354941349964349496559116553164,
+      0.5540274743536718310331223251099173738059758027371187785204105306540067645058650035650503440883446836,
+      // 15 points
+      0.006003740989757285755217140706693709426513591438119255000001242206305781315490287643638974815840423912,
+      0.9939962590102427142447828592933062905734864085618807449999987577936942186845097123563610251841595731,
+      0.9686366962003529521538794738551047356219981367576522289506815381751014868985227639752737930871340456,
+      0.03136330379964704784612052614489526437800186324234777104931846182489851310147723602472620691286596038,
+      0.07589670829478639189967583961289157431687191263150368295213622061966246241292725740119614012458925999,
+      0.9241032917052136081003241603871084256831280873684963170478637793803375375870727425988038598754107365,
+      0.8622088656800850237080930273069690048154496472920512817757117103520618908389626094980505488015671642,
+      0.1377911343199149762919069726930309951845503527079487182242882896479381091610373905019494511984328364,
+      0.2145139136957305762313866313730446793808068018586251975733672914729023100651207102582926857150869278,
+      0.7854860863042694237686133686269553206191931981413748024266327085270976899348792897417073142849130721,
+      0.302924326461218315051396314509477265818623611920650872484417328024195521106519291012251442919170119,
+      0.6970756735387816849486036854905227341813763880793491275155826719758044788934807089877485570808298811,
+      0.3994029530012827388496858483027018960935817727686811601920251376950258804984899061990818709662394704,
+      0.6005970469987172611503141516972981039064182272313188398079748623049741195015100938009181290337605296,
+      0.5,
+      // 16 points
+      0.005299532504175033701922913274833686286862964171177434974388047634337931392087301530731784046600902477,
+      0.9947004674958249662980770867251663137131370358288225650256119523656620686079126984692682159533990871,
+      0.9722875115366162880389942077673041725455696362955363004627768260333048944513411521097828643690791645,
+      0.02771248846338371196100579223269582745443036370446369953722317396669510554865884789021713563092085786,
+      0.06718439880608412805976605114380343380633230757623664594824428721611980114375472087143375281761380758,
+      0.9328156011939158719402339488561965661936676924237633540517557127838801988562452791285662471823861744,
+      0.8777022041775015169475505974237211341769068282287515048908785884611484305156358388603110284596247239,
+      0.1222977958224984830524494025762788658230931717712484951091214115388515694843641611396889715403752838,
+      0.8089381222013218742233358820243955094959411088828288970518986777708666588774057122284555152139792502,
+      0.191061877798678125776664117975604490504058891117171102948101322229133341122594287771544484786020748,
+      0.7290083888286136931712097214917887867700158065177617454505773754738795871451468038677177639679940468,
+      0.2709916111713863068287902785082112132299841934822382545494226245261204128548531961322822360320059534,
+      0.6408017753896294566152302507302480532430347453852999002744173669779625897495653852207201145760200796,
+      0.3591982246103705433847697492697519467569652546147000997255826330220374102504346147792798854239799204,
+      0.4524937450811812799073403322875209684348234721554672716513900913874373508777039335076206535121083239,
+      0.5475062549188187200926596677124790315651765278445327283486099086125626491222960664923793464878916761,
+    };
+    static constexpr double weights[] = {
+      // 1 point
+      1.0,
+      // 2 points
+      0.5,
+      0.5,
+      // 3 points
+      0.2777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777,
+      0.2777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777778,
+      0.4444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444,
+      // 4 points
+      0.1739274225687269286865319746109997036176743479169467702462646597593759337329551758609918838661290797,
+      0.1739274225687269286865319746109997036176743479169467702462646597593759337329551758609918838661290798,
+      0.3260725774312730713134680253890002963823256520830532297537353402406240662670448241390081161338709202,
+      0.3260725774312730713134680253890002963823256520830532297537353402406240662670448241390081161338709202,
+      // 5 points
+      0.1184634425280945437571320203599586813216300011062070077914139441108586442015215492899967152469757223,
+      0.1184634425280945437571320203599586813216300011062070077914139441108586442015215492899967152469757223,
+      0.2393143352496832340206457574178190964561477766715707699863638336669191335762562284877810625308020554,
+      0.2393143352496832340206457574178190964561477766715707699863638336669191335762562284877810625308020554,
+      0.2844444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444,
+      // 6 points
+      0.08566224618958517252014807108636644676341125074202199119931771989947288027117007732396385271319433444,
+      0.08566224618958517252014807108636644676341125074202199119931771989947288027117007732396385271319433508,
+      0.1803807865240693037849167569188580558307609463733727411448696201185700189186308591604811009944096738,
+      0.180380786524069303784916756918858055830760946373372741144869620118570018918630859160481100994409674,
+      0.2339569672863455236949351719947754974058278028846052676558126599819571008101990635155550462923959912,
+      0.2339569672863455236949351719947754974058278028846052676558126599819571008101990635155550462923959912,
+      // 7 points
+      0.06474248308443484663530571633954100916429370112997333198860431936232761748602115435781270908146042202,
+      0.06474248308443484663530571633954100916429370112997333198860431936232761748602115435781270908146042288,
+      0.139852695744638333950733885711889791243462532613299382268507016346809405215281338406620471450598809,
+      0.1398526957446383339507338857118897912434625326132993822685070163468094052152813384066204714505988098,
+      0.1909150252525594724751848877444875669391825417669313673755417255153527732170648541743423296720224007,
+      0.1909150252525594724751848877444875669391825417669313673755417255153527732170648541743423296720224007,
+      0.2089795918367346938775510204081632653061224489795918367346938775510204081632653061224489795918367347,
+      // 8 points
+      0.05061426814518812957626567715498109505769704552584247852950184903237008938173539243014136965202249679,
+      0.05061426814518812957626567715498109505769704552584247852950184903237008938173539243014136965202250399,
+      0.1111905172266872352721779972131204422150654350256247823629546446468084072852245204268265711885989599,
+      0.1111905172266872352721779972131204422150654350256247823629546446468084072852245204268265711885989642,
+      0.156853322938943643668981100993300656630164499501367468845131972537478135971086748480849038116964278,
+      0.156853322938943643668981100993300656630164499501367468845131972537478135971086748480849038116964278,
+      0.1813418916891809914825752246385978060970730199471652702624115337833433673619533386621830210424142548,
+      0.1813418916891809914825752246385978060970730199471652702624115337833433673619533386621830210424142548,
+      // 9 points
+      0.04063719418078720598594607905526182533783086039120537535555383844034334315422603147278927735147130028,
+      0.0406371941807872059859460790552618253378308603912053753555538384403433431542260314727892773514713142,
+      0.0903240803474287020292360156214564047571689108660202422491679532356786452724731348822974886515998753,
+      0.0903240803474287020292360156214564047571689108660202422491679532356786452724731348822974886515998796,
+      0.1303053482014677311593714347093164248859201022186499759699985010598054078344456223238230465475086993,
+      0.1303053482014677311593714347093164248859201022186499759699985010598054078344456223238230465475087005,
+      0.1561735385200014200343152032922218327993774306309523227770055827995719486620096582850609609440031769,
+      0.156173538520001420034315203292221832799377430630952322777005582799571948662009658285060960944003177,
+      0.1651196775006298815822625346434870244394053917863441672965482489292013101536911060720584530108339632,
+      // 10 points
+      0.03333567215434406879678440494666589642893241716007907256434744080670603204204355088839275484252937791,
+      0.03333567215434406879678440494666589642893241716007907256434744080670603204204355088839275484252937791,
+      0.07472567457529029657288816982884866620127831983471368391773863437661932736331500547297363231736586137,
+      0.07472567457529029657288816982884866620127831983471368391773863437661932736331500547297363231736596593,
+      0.1095431812579910219977674671140815962293859352613385449404782718175999553264756406213419965886010702,
+      0.1095431812579910219977674671140815962293859352613385449404782718175999553264756406213419965886011106,
+      0.1346333596549981775456134607847346764298799692304418979002816381210767161595896383821133183546263798,
+      0.1346333596549981775456134607847346764298799692304418979002816381210767161595896383821133183546263804,
+      0.1477621123573764350869464973256691647105233585134268006771540148779979691085761646351782978968771084,
+      0.1477621123573764350869464973256691647105233585134268006771540148779979691085761646351782978968771084,
+      // 11 points
+      0.02783428355808683324137686022127428936425781284844907417419214283707770364036877194184561103615985882,
+      0.02783428355808683324137686022127428936425781284844907417419214283707770364036877194184561103615998649,
+      0.06279018473245231231734714961197005009880789569770175033196700540895728756623563881734382085702807703,
+      0.0627901847324523123173471496119700500988078956977017503319670054089572875662356388173438208570284425,
+      0.0931451054638671257130488207158279458456423740201017058907532020869361740043927512346653792589896456,
+      0.09314510546386712571304882071582794584564237402010170589075320208693617400439275123466537925898987179,
+      0.1165968822959952399592618524215875697158990861584792545136598610609661066094404979770199742191308423,
+      0.1165968822959952399592618524215875697158990861584792545136598610609661066094404979770199742191308499,
+      0.131402272255123331090344434945254597686382338801572278190027685742756401669772626776208498508513353,
+      0.131402272255123331090344434945254597686382338801572278190027685742756401669772626776208498508513353,
+      0.1364625433889503153572417641681710945780209849473918737988002057266126530195794265058334322403586473,
+      // 12 points
+      0.02358766819325591359730798074250853015851453699742354478025267350190486057601935533541295353770570183,
+      0.02358766819325591359730798074250853015851453699742354478025267350190486057601935533541295353771090306,
+      0.05346966299765921548012735909699811210728508673516244000256302105140949681374878827026865904815670116,
+      0.05346966299765921548012735909699811210728508673516244000256302105140949681374878827026865904815772913,
+      0.08003916427167311316732626477167953593600586524543208895494977207897711258664557534082827631852788289,
+      0.08003916427167311316732626477167953593600586524543208895494977207897711258664557534082827631852953845,
+      0.1015837133615329608745322279048991882532590736372950731992972828988228162552364218975721975323025648,
+      0.1015837133615329608745322279048991882532590736372950731992972828988228162552364218975721975323026497,
+      0.1167462682691774043804249494624390281297049860998774373652617489107460000397058376403395132542818442,
+      0.1167462682691774043804249494624390281297049860998774373652617489107460000397058376403395132542818454,
+      0.1245735229067013925002812180214756054152304512848094156976755015581397137286440215155784003090211765,
+      0.1245735229067013925002812180214756054152304512848094156976755015581397137286440215155784003090211765,
+      // 13 points
+      0.02024200238265793976001079610049303002099327287249443406752330375249723025639635524721040621651256352,
+      0.02024200238265793976001079610049303002099327287249443406752330375249723025639635524721040621651575551,
+      0.04606074991886422395721088797689856046184199993111841954419577366979686486381646314594890787783233253,
+      0.04606074991886422395721088797689856046184199993111841954419577366979686486381646314594890787787365219,
+      0.069436755109893619231800888434435733810931359131649113823177508252886260767444767862590771427295539,
+      0.06943675510989361923180088843443573381093135913164911382317750825288626076744476786259077142729935376,
+      0.08907299038097286914002334599804899775640632533050825149339722014457253474937436174735847561115655018,
+      0.08907299038097286914002334599804899775640632533050825149339722014457253474937436174735847561115720583,
+      0.1039080237684442511562616096530263816932913045997517746095555599582692717825422161302977640233059593,
+      0.1039080237684442511562616096530263816932913045997517746095555599582692717825422161302977640233059661,
+      0.1131415901314486192060450930198883092173788688077785099324842743857878315602499855209131593331569649,
+      0.1131415901314486192060450930198883092173788688077785099324842743857878315602499855209131593331569649,
+      0.1162757766154369550972947576344179740783137386533989930593327196723800120403517006913610310213706817,
+      // 14 points
+      0.01755973016587593151591643806909589030985280463856363829074994509820816141890413526883839849926422796,
+      0.01755973016587593151591643806909589030985280463856363829074994509820816141890413526883839849929733993,
+      0.04007904357988010490281663853142715479184889269729738260069953274478573722864358493176809540971271623,
+      0.0400790435798801049028166385314271547918488926972973826006995327447857372286435849317680954097315832,
+      0.06075928534395159234470740453623831297833467284503733614553769627157987194626324615940995313520037766,
+      0.06075928534395159234470740453623831297833467284503733614553769627157987194626324615940995313521470206,
+      0.07860158357909676728480096931192107830283401866866168748465852193738408818480414925697904668120528128,
+      0.07860158357909676728480096931192107830283401866866168748465852193738408818480414925697904668120705796,
+      0.09276919873896890687085829506257851812446130146866582951001746253454917513176272221277636557335623116,
+      0.09276919873896890687085829506257851812446130146866582951001746253454917513176272221277636557335624966,
+      0.1025992318606478019829620328306090278551695306547097258584486451416835724126248601697159199959454469,
+      0.1025992318606478019829620328306090278551695306547097258584486451416835724126248601697159199959454481,
+      0.1076319267315788950979382216581300176374987790270644001098881962718093936769973020005122207054097891,
+      0.1076319267315788950979382216581300176374987790270644001098881962718093936769973020005122207054097891,
+      // 15 points
+      0.01537662099805863417731419678860220886087407241671703713211414275211859473355858401951938536567818793,
+      0.01537662099805863417731419678860220886087407241671703713211414275211859473355858401951938536633108639,
+      0.03518302374405406235463370822533366923335401637716535991295364645719352775643711852242022603232734774,
+      0.03518302374405406235463370822533366923335401637716535991295364645719352775643711852242022603294154521,
+      0.05357961023358596750593477334293465170777185787905099034351119456093899742615789986284292856885599421,
+      0.05357961023358596750593477334293465170777185787905099034351119456093899742615789986284292856902630637,
+      0.06978533896307715722390239725551416126042513765775562160119556431554422227095390584038412868178503037,
+      0.06978533896307715722390239725551416126042513765775562160119556431554422227095390584038412868179665823,
+      0.08313460290849696677660043024060440556545009004920645366093259528177678160613925885535258714620779062,
+      0.08313460290849696677660043024060440556545009004920645366093259528177678160613925885535258714620808482,
+      0.09308050000778110551340028093321141225311300613896420140774786365500662775134958030947488444304965858,
+      0.09308050000778110551340028093321141225311300613896420140774786365500662775134958030947488444304966241,
+      0.09921574266355578822805916322191966240934627997877099674236896396456239876671713406665749958240891154,
+      0.09921574266355578822805916322191966240934627997877099674236896396456239876671713406665749958240891161,
+      0.1012891209627806364403100999837596574193310790047386783983520580257176993773730370466967203563940161,
+      // 16 points
+      0.01357622970587704742589028622800905175613368778338039899530515953690205683210808662466288961558883448,
+      0.01357622970587704742589028622800905175613368778338039899530515953690205683210808662466288961642578809,
+      0.03112676196932394643142191849718884713749325417645342895065175790976786944352190953060585476930010037,
+      0.03112676196932394643142191849718884713749325417645342895065175790976786944352190953060585476935955411,
+      0.04757925584124639240496255380112311317763175159185632907841114361481587978884097972351247865969801944,
+      0.04757925584124639240496255380112311317763175159185632907841114361481587978884097972351247866179909653,
+      0.06231448562776693602623814109600821007244342961110133997237529521470548196073267679898459500869048106,
+      0.06231448562776693602623814109600821007244342961110133997237529521470548196073267679898459500869141184,
+      0.07479799440828836604075086527373927448524553410391823340271098109368020201020899122588931920152688622,
+      0.07479799440828836604075086527373927448524553410391823340271098109368020201020899122588931920153081579,
+      0.08457825969750126909465603951517998110581973670801414087254146784040183210496526546607766127103887189,
+      0.08457825969750126909465603951517998110581973670801414087254146784040183210496526546607766127103912237,
+      0.09130170752246179443338183398460996969177811182732464120924757218971523247505558748020021255849263684,
+      0.09130170752246179443338183398460996969177811182732464120924757218971523247505558748020021255849263706,
+      0.09472530522753424814269836160414155257345449419795148751875662260001144538456650315006698891676697614,
+      0.09472530522753424814269836160414155257345449419795148751875662260001144538456650315006698891676697614,
+    };
+  };
+
+  template< class T >
+  constexpr double StaticGaussLegendreTable< T >::points[];
+  template< class T >
+  constexpr double StaticGaussLegendreTable< T >::weights[];
+
+  //! triangle rules of SimplexQuadratureRule< ct, 2 >
+  template< class = void >
+  struct StaticTriangleQuadratureTable
+  {
+    //! number of tabulated rules
+    static constexpr int size = 19;
+    //! orders of the tabulated rules
+    static constexpr int orders[] = { 1, 2, 3, 4, 5, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20 };
+    //! number of points of the tabulated rules
+    static constexpr int sizes[] = { 1, 3, 4, 6, 7, 12, 16, 19, 25, 28, 33, 37, 42, 49, 55, 61, 70, 76, 84 };
+    //! index of the first point of the tabulated rules
+    static constexpr int offsets[] = { 0, 1, 4, 8, 14, 21, 33, 49, 68, 93, 121, 154, 191, 233, 282, 337, 398, 468, 544 };
+    //! coordinates and weight of all points
+    static constexpr double data[][ 3 ] = {
+      // order 1
+      { 0.33333333333333331, 0.33333333333333331, 0.5 },
+      // order 2
+      { 0.66666666666666663, 0.16666666666666666, 0.16666666666666666 },
+      { 0.16666666666666666, 0.66666666666666663, 0.16666666666666666 },
+      { 0.16666666666666666, 0.16666666666666666, 0.16666666666666666 },
+      // order 3
+      { 0.33333333333333331, 0.33333333333333331, -0.28125 },
+      { 0.59999999999999998, 0.20000000000000001, 0.26041666666666669 },
+      { 0.20000000000000001, 0.59999999999999998, 0.26041666666666669 },
+      { 0.20000000000000001, 0.20000000000000001, 0.26041666666666669 },
+      // order 4
+      { 0.81684757298045851, 0.091576213509770743, 0.054975871827660935 },
+      { 0.091576213509770743, 0.81684757298045851, 0.054975871827660935 },
+      { 0.091576213509770743, 0.091576213509770743, 0.054975871827660935 },
+      { 0.10810301816807023, 0.44594849091596489, 0.11169079483900574 },
+      { 0.44594849091596489, 0.10810301816807023, 0.11169079483900574 },
+      { 0.44594849091596489, 0.44594849091596489, 0.11169079483900574 },
+      // order 5
+      { 0.33333333333333331, 0.33333333333333331, 0.1125 },
+      { 0.79742698535308731, 0.10128650732345634, 0.06296959027241357 },
+      { 0.10128650732345634, 0.79742698535308731, 0.06296959027241357 },
+      { 0.10128650732345634, 0.10128650732345634, 0.06296959027241357 },
+      { 0.059715871789769823, 0.47014206410511511, 0.066197076394253096 },
+      { 0.47014206410511511, 0.059715871789769823, 0.066197076394253096 },
+      { 0.47014206410511511, 0.47014206410511511, 0.066197076394253096 },
+      // order 7
+      { 0.062382265094402117, 0.067517867073916091, 0.026517028157436253 },
+      { 0.067517867073916091, 0.87009986783168181, 0.026517028157436253 },
+      { 0.87009986783168181, 0.062382265094402117, 0.026517028157436253 },
+      { 0.055225456656926609, 0.32150249385198182, 0.043881408714446055 },
+      { 0.32150249385198182, 0.62327204949109161, 0.043881408714446055 },
+      { 0.62327204949109161, 0.055225456656926609, 0.043881408714446055 },
+      { 0.034324302945097147, 0.66094919618673564, 0.028775042784981587 },
+      { 0.66094919618673564, 0.30472650086816722, 0.028775042784981587 },
+      { 0.30472650086816722, 0.034324302945097147, 0.028775042784981587 },
+      { 0.51584233435359172, 0.27771616697639179, 0.06749318700980278 },
+      { 0.27771616697639179, 0.20644149867001643, 0.06749318700980278 },
+      { 0.20644149867001643, 0.51584233435359172, 0.06749318700980278 },
+      // order 8
+      { 0.33333333333333331, 0.33333333333333331, 0.072157803838893586 },
+      { 0.17056930775176021, 0.17056930775176021, 0.051608685267359122 },
+      { 0.17056930775176021, 0.65886138449647957, 0.051608685267359122 },
+      { 0.65886138449647957, 0.17056930775176021, 0.051608685267359122 },
+      { 0.050547228317030977, 0.050547228317030977, 0.01622924881159904 },
+      { 0.050547228317030977, 0.89890554336593809, 0.01622924881159904 },
+      { 0.89890554336593809, 0.050547228317030977, 0.01622924881159904 },
+      { 0.45929258829272318, 0.45929258829272318, 0.04754581713364231 },
+      { 0.45929258829272318, 0.081414823414553694, 0.04754581713364231 },
+      { 0.081414823414553694, 0.45929258829272318, 0.04754581713364231 },
+      { 0.72849239295540424, 0.26311282963463811, 0.013615157087217496 },
+      { 0.72849239295540424, 0.0083947774099576052, 0.013615157087217496 },
+      { 0.26311282963463811, 0.72849239295540424, 0.013615157087217496 },
+      { 0.26311282963463811, 0.0083947774099576052, 0.013615157087217496 },
+      { 0.0083947774099576052, 0.72849239295540424, 0.013615157087217496 },
+      { 0.0083947774099576052, 0.26311282963463811, 0.013615157087217496 },
+      // order 9
+      { 0.33333333333333331, 0.33333333333333331, 0.048567898141399418 },
+      { 0.48968251919873762, 0.48968251919873762, 0.015667350113569536 },
+      { 0.48968251919873762, 0.020634961602524746, 0.015667350113569536 },
+      { 0.020634961602524746, 0.48968251919873762, 0.015667350113569536 },
+      { 0.43708959149293664, 0.43708959149293664, 0.038913770502387139 },
+      { 0.43708959149293664, 0.12582081701412673, 0.038913770502387139 },
+      { 0.12582081701412673, 0.43708959149293664, 0.038913770502387139 },
+      { 0.18820353561903272, 0.18820353561903272, 0.039823869463605124 },
+      { 0.18820353561903272, 0.62359292876193451, 0.039823869463605124 },
+      { 0.62359292876193451, 0.18820353561903272, 0.039823869463605124 },
+      { 0.044729513394452712, 0.044729513394452712, 0.012788837829349016 },
+      { 0.044729513394452712, 0.91054097321109462, 0.012788837829349016 },
+      { 0.91054097321109462, 0.044729513394452712, 0.012788837829349016 },
+      { 0.74119859878449801, 0.036838412054736286, 0.021641769688644688 },
+      { 0.74119859878449801, 0.22196298916076571, 0.021641769688644688 },
+      { 0.036838412054736286, 0.74119859878449801, 0.021641769688644688 },
+      { 0.036838412054736286, 0.22196298916076571, 0.021641769688644688 },
+      { 0.22196298916076571, 0.74119859878449801, 0.021641769688644688 },
+      { 0.22196298916076571, 0.036838412054736286, 0.021641769688644688 },
+      // order 10
+      { 0.33333333333333331, 0.33333333333333331, 0.039947252370619857 },
+      { 0.42508621060209056, 0.42508621060209056, 0.03556190111618867 },
+      { 0.42508621060209056, 0.14982757879581884, 0.03556190111618867 },
+      { 0.14982757879581884, 0.42508621060209056, 0.03556190111618867 },
+      { 0.023308867510000192, 0.023308867510000192, 0.0041119093452320976 },
+      { 0.023308867510000192, 0.95338226497999967, 0.0041119093452320976 },
+      { 0.95338226497999967, 0.023308867510000192, 0.0041119093452320976 },
+      { 0.62830740021349252, 0.22376697357697301, 0.022715296148085009 },
+      { 0.62830740021349252, 0.14792562620953445, 0.022715296148085009 },
+      { 0.22376697357697301, 0.62830740021349252, 0.022715296148085009 },
+      { 0.22376697357697301, 0.14792562620953445, 0.022715296148085009 },
+      { 0.14792562620953445, 0.62830740021349252, 0.022715296148085009 },
+      { 0.14792562620953445, 0.22376697357697301, 0.022715296148085009 },
+      { 0.61131382618139762, 0.35874014186443148, 0.018679928117152637 },
+      { 0.61131382618139762, 0.029946031954170886, 0.018679928117152637 },
+      { 0.35874014186443148, 0.61131382618139762, 0.018679928117152637 },
+      { 0.35874014186443148, 0.029946031954170886, 0.018679928117152637 },
+      { 0.029946031954170886, 0.61131382618139762, 0.018679928117152637 },
+      { 0.029946031954170886, 0.35874014186443148, 0.018679928117152637 },
+      { 0.82107206998562943, 0.14329537042686716, 0.015443328442281995 },
+      { 0.82107206998562943, 0.035632559587503485, 0.015443328442281995 },
+      { 0.14329537042686716, 0.82107206998562943, 0.015443328442281995 },
+      { 0.14329537042686716, 0.035632559587503485, 0.015443328442281995 },
+      { 0.035632559587503485, 0.82107206998562943, 0.015443328442281995 },
+      { 0.035632559587503485, 0.14329537042686716, 0.015443328442281995 },
+      // order 11
+      { 0.85887028128263665, 0.14112971871736329, 0.0036811918916502769 },
+      { 0.85887028128263665, 0, 0.0036811918916502769 },
+      { 0.14112971871736329, 0.85887028128263665, 0.0036811918916502769 },
+      { 0.14112971871736329, 0, 0.0036811918916502769 },
+      { 0, 0.85887028128263665, 0.0036811918916502769 },
+      { 0, 0.14112971871736329, 0.0036811918916502769 },
+      { 0.33333333333333331, 0.33333333333333331, 0.043988650581116118 },
+      { 0.025989140928287396, 0.025989140928287396, 0.0043721557768680117 },
+      { 0.025989140928287396, 0.94802171814342517, 0.0043721557768680117 },
+      { 0.94802171814342517, 0.025989140928287396, 0.0043721557768680117 },
+      { 0.094287502647922489, 0.094287502647922489, 0.019040785996967468 },
+      { 0.094287502647922489, 0.81142499470415497, 0.019040785996967468 },
+      { 0.81142499470415497, 0.094287502647922489, 0.019040785996967468 },
+      { 0.49463677501721381, 0.49463677501721381, 0.0094277240280656455 },
+      { 0.49463677501721381, 0.010726449965572373, 0.0094277240280656455 },
+      { 0.010726449965572373, 0.49463677501721381, 0.0094277240280656455 },
+      { 0.20734338261451132, 0.20734338261451132, 0.036079848772369763 },
+      { 0.20734338261451132, 0.5853132347709773, 0.036079848772369763 },
+      { 0.5853132347709773, 0.20734338261451132, 0.036079848772369763 },
+      { 0.43890780570049209, 0.43890780570049209, 0.034664569352767953 },
+      { 0.43890780570049209, 0.12218438859901581, 0.034664569352767953 },
+      { 0.12218438859901581, 0.43890780570049209, 0.034664569352767953 },
+      { 0.67793765488259039, 0.044841677589130442, 0.020528157714644283 },
+      { 0.67793765488259039, 0.27722066752827917, 0.020528157714644283 },
+      { 0.044841677589130442, 0.67793765488259039, 0.020528157714644283 },
+      { 0.044841677589130442, 0.27722066752827917, 0.020528157714644283 },
+      { 0.27722066752827917, 0.67793765488259039, 0.020528157714644283 },
+      { 0.27722066752827917, 0.044841677589130442, 0.020528157714644283 },
+      // order 12
+      { 0.023565220452389998, 0.48821738977380502, 0.0128655332202275 },
+      { 0.48821738977380502, 0.023565220452389998, 0.0128655332202275 },
+      { 0.48821738977380502, 0.48821738977380502, 0.0128655332202275 },
+      { 0.43972439229445998, 0.43972439229445998, 0.021846272269019001 },
+      { 0.43972439229445998, 0.12055121541107899, 0.021846272269019001 },
+      { 0.12055121541107899, 0.43972439229445998, 0.021846272269019001 },
+      { 0.27121038501211597, 0.27121038501211597, 0.031429112108942503 },
+      { 0.27121038501211597, 0.457579229975768, 0.031429112108942503 },
+      { 0.457579229975768, 0.27121038501211597, 0.031429112108942503 },
+      { 0.127576145541586, 0.127576145541586, 0.0173980564653545 },
+      { 0.127576145541586, 0.74484770891682794, 0.0173980564653545 },
+      { 0.74484770891682794, 0.127576145541586, 0.0173980564653545 },
+      { 0.02131735045321, 0.02131735045321, 0.0030831305257795001 },
+      { 0.02131735045321, 0.95736529909357992, 0.0030831305257795001 },
+      { 0.95736529909357992, 0.02131735045321, 0.0030831305257795001 },
+      { 0.115343494534698, 0.27571326968551402, 0.020185778883190501 },
+      { 0.115343494534698, 0.60894323577978793, 0.020185778883190501 },
+      { 0.27571326968551402, 0.115343494534698, 0.020185778883190501 },
+      { 0.27571326968551402, 0.60894323577978793, 0.020185778883190501 },
+      { 0.60894323577978793, 0.115343494534698, 0.020185778883190501 },
+      { 0.60894323577978793, 0.27571326968551402, 0.020185778883190501 },
+      { 0.022838332222257, 0.28132558098993998, 0.0111783866011515 },
+      { 0.022838332222257, 0.69583608678780307, 0.0111783866011515 },
+      { 0.28132558098993998, 0.022838332222257, 0.0111783866011515 },
+      { 0.28132558098993998, 0.69583608678780307, 0.0111783866011515 },
+      { 0.69583608678780307, 0.022838332222257, 0.0111783866011515 },
+      { 0.69583608678780307, 0.28132558098993998, 0.0111783866011515 },
+      { 0.025734050548330001, 0.11625191590759699, 0.0086581155543294999 },
+      { 0.025734050548330001, 0.85801403354407302, 0.0086581155543294999 },
+      { 0.11625191590759699, 0.025734050548330001, 0.0086581155543294999 },
+      { 0.11625191590759699, 0.85801403354407302, 0.0086581155543294999 },
+      { 0.85801403354407302, 0.025734050548330001, 0.0086581155543294999 },
+      { 0.85801403354407302, 0.11625191590759699, 0.0086581155543294999 },
+      // order 13
+      { 0.33333333333333331, 0.33333333333333331, 0.03398001829341582 },
+      { 0.48907694645253935, 0.48907694645253935, 0.011997200964447365 },
+      { 0.48907694645253935, 0.021846107094921297, 0.011997200964447365 },
+      { 0.021846107094921297, 0.48907694645253935, 0.011997200964447365 },
+      { 0.22137228629183289, 0.22137228629183289, 0.029139242559599991 },
+      { 0.22137228629183289, 0.55725542741633416, 0.029139242559599991 },
+      { 0.55725542741633416, 0.22137228629183289, 0.029139242559599991 },
+      { 0.42694141425980042, 0.42694141425980042, 0.027800983765226665 },
+      { 0.42694141425980042, 0.14611717148039916, 0.027800983765226665 },
+      { 0.14611717148039916, 0.42694141425980042, 0.027800983765226665 },
+      { 0.021509681108843184, 0.021509681108843184, 0.0030261685517695858 },
+      { 0.021509681108843184, 0.95698063778231368, 0.0030261685517695858 },
+      { 0.95698063778231368, 0.021509681108843184, 0.0030261685517695858 },
+      { 0.11092204280346339, 0.86470777029544277, 0.0074827005525828338 },
+      { 0.86470777029544277, 0.11092204280346339, 0.0074827005525828338 },
+      { 0.11092204280346339, 0.024370186901093827, 0.0074827005525828338 },
+      { 0.024370186901093827, 0.11092204280346339, 0.0074827005525828338 },
+      { 0.86470777029544277, 0.024370186901093827, 0.0074827005525828338 },
+      { 0.024370186901093827, 0.86470777029544277, 0.0074827005525828338 },
+      { 0.74850711589995222, 0.087895483032197325, 0.01208951990579691 },
+      { 0.087895483032197325, 0.74850711589995222, 0.01208951990579691 },
+      { 0.74850711589995222, 0.16359740106785045, 0.01208951990579691 },
+      { 0.16359740106785045, 0.74850711589995222, 0.01208951990579691 },
+      { 0.087895483032197325, 0.16359740106785045, 0.01208951990579691 },
+      { 0.16359740106785045, 0.087895483032197325, 0.01208951990579691 },
+      { 0.27251581777342965, 0.72235779312418802, 0.0047953405017716316 },
+      { 0.72235779312418802, 0.27251581777342965, 0.0047953405017716316 },
+      { 0.27251581777342965, 0.0051263891023822783, 0.0047953405017716316 },
+      { 0.0051263891023822783, 0.27251581777342965, 0.0047953405017716316 },
+      { 0.72235779312418802, 0.0051263891023822783, 0.0047953405017716316 },
+      { 0.0051263891023822783, 0.72235779312418802, 0.0047953405017716316 },
+      { 0.62354599555367562, 0.30844176089211778, 0.017320638070424187 },
+      { 0.30844176089211778, 0.62354599555367562, 0.017320638070424187 },
+      { 0.62354599555367562, 0.068012243554206597, 0.017320638070424187 },
+      { 0.068012243554206597, 0.62354599555367562, 0.017320638070424187 },
+      { 0.30844176089211778, 0.068012243554206597, 0.017320638070424187 },
+      { 0.068012243554206597, 0.30844176089211778, 0.017320638070424187 },
+      // order 14
+      { 0.41764471934045394, 0.41764471934045394, 0.016394176772062674 },
+      { 0.41764471934045394, 0.16471056131909212, 0.016394176772062674 },
+      { 0.16471056131909212, 0.41764471934045394, 0.016394176772062674 },
+      { 0.27347752830883865, 0.27347752830883865, 0.025887052253645793 },
+      { 0.27347752830883865, 0.45304494338232271, 0.025887052253645793 },
+      { 0.45304494338232271, 0.27347752830883865, 0.025887052253645793 },
+      { 0.17720553241254344, 0.17720553241254344, 0.021081294368496508 },
+      { 0.17720553241254344, 0.64558893517491311, 0.021081294368496508 },
+      { 0.64558893517491311, 0.17720553241254344, 0.021081294368496508 },
+      { 0.019390961248701048, 0.019390961248701048, 0.0024617018012000409 },
+      { 0.019390961248701048, 0.96121807750259791, 0.0024617018012000409 },
+      { 0.96121807750259791, 0.019390961248701048, 0.0024617018012000409 },
+      { 0.48896391036217862, 0.48896391036217862, 0.010941790684714445 },
+      { 0.48896391036217862, 0.022072179275642756, 0.010941790684714445 },
+      { 0.022072179275642756, 0.48896391036217862, 0.010941790684714445 },
+      { 0.061799883090872601, 0.061799883090872601, 0.0072168498348883338 },
+      { 0.061799883090872601, 0.87640023381825483, 0.0072168498348883338 },
+      { 0.87640023381825483, 0.061799883090872601, 0.0072168498348883338 },
+      { 0.09291624935697182, 0.57022229084668319, 0.019285755393530342 },
+      { 0.57022229084668319, 0.09291624935697182, 0.019285755393530342 },
+      { 0.09291624935697182, 0.33686145979634496, 0.019285755393530342 },
+      { 0.33686145979634496, 0.09291624935697182, 0.019285755393530342 },
+      { 0.57022229084668319, 0.33686145979634496, 0.019285755393530342 },
+      { 0.33686145979634496, 0.57022229084668319, 0.019285755393530342 },
+      { 0.17226668782135557, 0.05712475740364794, 0.012332876606281837 },
+      { 0.05712475740364794, 0.17226668782135557, 0.012332876606281837 },
+      { 0.17226668782135557, 0.77060855477499646, 0.012332876606281837 },
+      { 0.77060855477499646, 0.17226668782135557, 0.012332876606281837 },
+      { 0.05712475740364794, 0.77060855477499646, 0.012332876606281837 },
+      { 0.77060855477499646, 0.05712475740364794, 0.012332876606281837 },
+      { 0.11897449769695685, 0.87975717137017118, 0.002505114419250336 },
+      { 0.87975717137017118, 0.11897449769695685, 0.002505114419250336 },
+      { 0.11897449769695685, 0.0012683309328719305, 0.002505114419250336 },
+      { 0.0012683309328719305, 0.11897449769695685, 0.002505114419250336 },
+      { 0.87975717137017118, 0.0012683309328719305, 0.002505114419250336 },
+      { 0.0012683309328719305, 0.87975717137017118, 0.002505114419250336 },
+      { 0.01464695005565441, 0.29837288213625773, 0.0072181540567669202 },
+      { 0.29837288213625773, 0.01464695005565441, 0.0072181540567669202 },
+      { 0.01464695005565441, 0.68698016780808779, 0.0072181540567669202 },
+      { 0.68698016780808779, 0.01464695005565441, 0.0072181540567669202 },
+      { 0.29837288213625773, 0.68698016780808779, 0.0072181540567669202 },
+      { 0.68698016780808779, 0.29837288213625773, 0.0072181540567669202 },
+      // order 15
+      { 0.33333333333333331, 0.33333333333333331, 0.024777380743035579 },
+      { 0.079031013655541632, 0.079031013655541632, 0.0092433943023307735 },
+      { 0.079031013655541632, 0.84193797268891668, 0.0092433943023307735 },
+      { 0.84193797268891668, 0.079031013655541632, 0.0092433943023307735 },
+      { 0.40886316907744108, 0.40886316907744108, 0.019011381726930579 },
+      { 0.40886316907744108, 0.18227366184511784, 0.019011381726930579 },
+      { 0.18227366184511784, 0.40886316907744108, 0.019011381726930579 },
+      { 0.49250168823249668, 0.49250168823249668, 0.0067052581900064146 },
+      { 0.49250168823249668, 0.014996623535006637, 0.0067052581900064146 },
+      { 0.014996623535006637, 0.49250168823249668, 0.0067052581900064146 },
+      { 0.018789501810770076, 0.018789501810770076, 0.0022485768962175402 },
+      { 0.018789501810770076, 0.96242099637845979, 0.0022485768962175402 },
+      { 0.96242099637845979, 0.018789501810770076, 0.0022485768962175402 },
+      { 0.09876591135571211, 0.69872859059598791, 0.015087322572773133 },
+      { 0.69872859059598791, 0.09876591135571211, 0.015087322572773133 },
+      { 0.09876591135571211, 0.20250549804829998, 0.015087322572773133 },
+      { 0.20250549804829998, 0.09876591135571211, 0.015087322572773133 },
+      { 0.69872859059598791, 0.20250549804829998, 0.015087322572773133 },
+      { 0.20250549804829998, 0.69872859059598791, 0.015087322572773133 },
+      { 0.077663767064308165, 0.55349674918711644, 0.015630213780078804 },
+      { 0.55349674918711644, 0.077663767064308165, 0.015630213780078804 },
+      { 0.077663767064308165, 0.36883948374857545, 0.015630213780078804 },
+      { 0.36883948374857545, 0.077663767064308165, 0.015630213780078804 },
+      { 0.55349674918711644, 0.36883948374857545, 0.015630213780078804 },
+      { 0.36883948374857545, 0.55349674918711644, 0.015630213780078804 },
+      { 0.7834502256732081, 0.021594628433980259, 0.0061808086085778204 },
+      { 0.021594628433980259, 0.7834502256732081, 0.0061808086085778204 },
+      { 0.7834502256732081, 0.19495514589281165, 0.0061808086085778204 },
+      { 0.19495514589281165, 0.7834502256732081, 0.0061808086085778204 },
+      { 0.021594628433980259, 0.19495514589281165, 0.0061808086085778204 },
+      { 0.19495514589281165, 0.021594628433980259, 0.0061808086085778204 },
+      { 0.89514624528794884, 0.012563596287784997, 0.0032209366452594663 },
+      { 0.012563596287784997, 0.89514624528794884, 0.0032209366452594663 },
+      { 0.89514624528794884, 0.092290158424266161, 0.0032209366452594663 },
+      { 0.092290158424266161, 0.89514624528794884, 0.0032209366452594663 },
+      { 0.012563596287784997, 0.092290158424266161, 0.0032209366452594663 },
+      { 0.092290158424266161, 0.012563596287784997, 0.0032209366452594663 },
+      { 0.53877851064220139, 0.26709528567005225, 0.01460544538747189 },
+      { 0.26709528567005225, 0.53877851064220139, 0.01460544538747189 },
+      { 0.53877851064220139, 0.19412620368774636, 0.01460544538747189 },
+      { 0.19412620368774636, 0.53877851064220139, 0.01460544538747189 },
+      { 0.26709528567005225, 0.19412620368774636, 0.01460544538747189 },
+      { 0.19412620368774636, 0.26709528567005225, 0.01460544538747189 },
+      { 0.65975989271796942, 0.32515745241110783, 0.0058747373242569699 },
+      { 0.32515745241110783, 0.65975989271796942, 0.0058747373242569699 },
+      { 0.65975989271796942, 0.015082654870922751, 0.0058747373242569699 },
+      { 0.015082654870922751, 0.65975989271796942, 0.0058747373242569699 },
+      { 0.32515745241110783, 0.015082654870922751, 0.0058747373242569699 },
+      { 0.015082654870922751, 0.32515745241110783, 0.0058747373242569699 },
+      // order 16
+      { 0.33333333333333331, 0.33333333333333331, 0.023285054705086551 },
+      { 0.49221060853955517, 0.49221060853955517, 0.0069794202658214569 },
+      { 0.49221060853955517, 0.015578782920889656, 0.0069794202658214569 },
+      { 0.015578782920889656, 0.49221060853955517, 0.0069794202658214569 },
+      { 0.24247548463607194, 0.24247548463607194, 0.0024271270430109961 },
+      { 0.24247548463607194, 0.51504903072785613, 0.0024271270430109961 },
+      { 0.51504903072785613, 0.24247548463607194, 0.0024271270430109961 },
+      { 0.18107805173735439, 0.18107805173735439, 0.015270381617910554 },
+      { 0.18107805173735439, 0.63784389652529128, 0.015270381617910554 },
+      { 0.63784389652529128, 0.18107805173735439, 0.015270381617910554 },
+      { 0.0062883330624728898, 0.0062883330624728898, 0.00051077379852769043 },
+      { 0.0062883330624728898, 0.98742333387505421, 0.00051077379852769043 },
+      { 0.98742333387505421, 0.0062883330624728898, 0.00051077379852769043 },
+      { 0.015089339252307961, 0.81414205017533425, 0.0050869923397174263 },
+      { 0.81414205017533425, 0.015089339252307961, 0.0050869923397174263 },
+      { 0.015089339252307961, 0.17076861057235782, 0.0050869923397174263 },
+      { 0.17076861057235782, 0.015089339252307961, 0.0050869923397174263 },
+      { 0.81414205017533425, 0.17076861057235782, 0.0050869923397174263 },
+      { 0.17076861057235782, 0.81414205017533425, 0.0050869923397174263 },
+      { 0.92272653498808954, 0.016117026002306335, 0.003398876440470057 },
+      { 0.016117026002306335, 0.92272653498808954, 0.003398876440470057 },
+      { 0.92272653498808954, 0.061156439009604123, 0.003398876440470057 },
+      { 0.061156439009604123, 0.92272653498808954, 0.003398876440470057 },
+      { 0.016117026002306335, 0.061156439009604123, 0.003398876440470057 },
+      { 0.061156439009604123, 0.016117026002306335, 0.003398876440470057 },
+      { 0.32786720253495677, 0.48388307019161464, 0.019234271417161504 },
+      { 0.48388307019161464, 0.32786720253495677, 0.019234271417161504 },
+      { 0.32786720253495677, 0.18824972727342865, 0.019234271417161504 },
+      { 0.18824972727342865, 0.32786720253495677, 0.019234271417161504 },
+      { 0.48388307019161464, 0.18824972727342865, 0.019234271417161504 },
+      { 0.18824972727342865, 0.48388307019161464, 0.019234271417161504 },
+      { 0.37921154152835612, 0.080197523669796558, 0.014098485236461043 },
+      { 0.080197523669796558, 0.37921154152835612, 0.014098485236461043 },
+      { 0.37921154152835612, 0.54059093480184728, 0.014098485236461043 },
+      { 0.54059093480184728, 0.37921154152835612, 0.014098485236461043 },
+      { 0.080197523669796558, 0.54059093480184728, 0.014098485236461043 },
+      { 0.54059093480184728, 0.080197523669796558, 0.014098485236461043 },
+      { 0.69269317440268763, 0.079326560819270447, 0.012125945601625145 },
+      { 0.079326560819270447, 0.69269317440268763, 0.012125945601625145 },
+      { 0.69269317440268763, 0.22798026477804192, 0.012125945601625145 },
+      { 0.22798026477804192, 0.69269317440268763, 0.012125945601625145 },
+      { 0.079326560819270447, 0.22798026477804192, 0.012125945601625145 },
+      { 0.22798026477804192, 0.079326560819270447, 0.012125945601625145 },
+      { 0.66394920687014747, 0.015572712194018958, 0.0065260284208662764 },
+      { 0.015572712194018958, 0.66394920687014747, 0.0065260284208662764 },
+      { 0.66394920687014747, 0.32047808093583358, 0.0065260284208662764 },
+      { 0.32047808093583358, 0.66394920687014747, 0.0065260284208662764 },
+      { 0.015572712194018958, 0.32047808093583358, 0.0065260284208662764 },
+      { 0.32047808093583358, 0.015572712194018958, 0.0065260284208662764 },
+      { 0.071993541146850665, 0.81605332720024659, 0.0063880400635487741 },
+      { 0.81605332720024659, 0.071993541146850665, 0.0063880400635487741 },
+      { 0.071993541146850665, 0.11195313165290277, 0.0063880400635487741 },
+      { 0.11195313165290277, 0.071993541146850665, 0.0063880400635487741 },
+      { 0.81605332720024659, 0.11195313165290277, 0.0063880400635487741 },
+      { 0.11195313165290277, 0.81605332720024659, 0.0063880400635487741 },
+      // order 17
+      { 0.33333333333333331, 0.33333333333333331, 0.016358974612404986 },
+      { 0.46300927095736211, 0.46300927095736211, 0.013156226277626212 },
+      { 0.46300927095736211, 0.073981458085275786, 0.013156226277626212 },
+      { 0.073981458085275786, 0.46300927095736211, 0.013156226277626212 },
+      { 0.27217887488682529, 0.27217887488682529, 0.01162283222231752 },
+      { 0.27217887488682529, 0.45564225022634941, 0.01162283222231752 },
+      { 0.45564225022634941, 0.27217887488682529, 0.01162283222231752 },
+      { 0.099238206338597437, 0.099238206338597437, 0.0053636702433737596 },
+      { 0.099238206338597437, 0.80152358732280515, 0.0053636702433737596 },
+      { 0.80152358732280515, 0.099238206338597437, 0.0053636702433737596 },
+      { 0.046805803501678289, 0.046805803501678289, 0.0047129043920631254 },
+      { 0.046805803501678289, 0.90638839299664342, 0.0047129043920631254 },
+      { 0.90638839299664342, 0.046805803501678289, 0.0047129043920631254 },
+      { 0.76330660077421997, 0.067318119491886819, 0.0083938266788006061 },
+      { 0.067318119491886819, 0.76330660077421997, 0.0083938266788006061 },
+      { 0.76330660077421997, 0.16937527973389321, 0.0083938266788006061 },
+      { 0.16937527973389321, 0.76330660077421997, 0.0083938266788006061 },
+      { 0.067318119491886819, 0.16937527973389321, 0.0083938266788006061 },
+      { 0.16937527973389321, 0.067318119491886819, 0.0083938266788006061 },
+      { 0.071889744697672342, 0.30598342097513231, 0.011859433778569477 },
+      { 0.30598342097513231, 0.071889744697672342, 0.011859433778569477 },
+      { 0.071889744697672342, 0.6221268343271954, 0.011859433778569477 },
+      { 0.6221268343271954, 0.071889744697672342, 0.011859433778569477 },
+      { 0.30598342097513231, 0.6221268343271954, 0.011859433778569477 },
+      { 0.6221268343271954, 0.30598342097513231, 0.011859433778569477 },
+      { 0.34118728626448469, 0.48659604403723777, 0.0162886107321146 },
+      { 0.48659604403723777, 0.34118728626448469, 0.0162886107321146 },
+      { 0.34118728626448469, 0.17221666969827754, 0.0162886107321146 },
+      { 0.17221666969827754, 0.34118728626448469, 0.0162886107321146 },
+      { 0.48659604403723777, 0.17221666969827754, 0.0162886107321146 },
+      { 0.17221666969827754, 0.48659604403723777, 0.0162886107321146 },
+      { 0.96714791665835576, 0.030542142997043102, 0.00087480232114615962 },
+      { 0.030542142997043102, 0.96714791665835576, 0.00087480232114615962 },
+      { 0.96714791665835576, 0.0023099403446011427, 0.00087480232114615962 },
+      { 0.0023099403446011427, 0.96714791665835576, 0.00087480232114615962 },
+      { 0.030542142997043102, 0.0023099403446011427, 0.00087480232114615962 },
+      { 0.0023099403446011427, 0.030542142997043102, 0.00087480232114615962 },
+      { 0.25058689437692966, 0.013757382108554371, 0.0051757815981501769 },
+      { 0.013757382108554371, 0.25058689437692966, 0.0051757815981501769 },
+      { 0.25058689437692966, 0.73565572351451602, 0.0051757815981501769 },
+      { 0.73565572351451602, 0.25058689437692966, 0.0051757815981501769 },
+      { 0.013757382108554371, 0.73565572351451602, 0.0051757815981501769 },
+      { 0.73565572351451602, 0.013757382108554371, 0.0051757815981501769 },
+      { 0.014266173531424474, 0.40897045138074373, 0.0060541746426407981 },
+      { 0.40897045138074373, 0.014266173531424474, 0.0060541746426407981 },
+      { 0.014266173531424474, 0.57676337508783182, 0.0060541746426407981 },
+      { 0.57676337508783182, 0.014266173531424474, 0.0060541746426407981 },
+      { 0.40897045138074373, 0.57676337508783182, 0.0060541746426407981 },
+      { 0.57676337508783182, 0.40897045138074373, 0.0060541746426407981 },
+      { 0.013686922043753462, 0.11963792679877366, 0.0038564022447237175 },
+      { 0.11963792679877366, 0.013686922043753462, 0.0038564022447237175 },
+      { 0.013686922043753462, 0.86667515115747285, 0.0038564022447237175 },
+      { 0.86667515115747285, 0.013686922043753462, 0.0038564022447237175 },
+      { 0.11963792679877366, 0.86667515115747285, 0.0038564022447237175 },
+      { 0.86667515115747285, 0.11963792679877366, 0.0038564022447237175 },
+      { 0.15409525834270282, 0.21255946936015865, 0.010675989000763325 },
+      { 0.21255946936015865, 0.15409525834270282, 0.010675989000763325 },
+      { 0.15409525834270282, 0.63334527229713844, 0.010675989000763325 },
+      { 0.63334527229713844, 0.15409525834270282, 0.010675989000763325 },
+      { 0.21255946936015865, 0.63334527229713844, 0.010675989000763325 },
+      { 0.63334527229713844, 0.21255946936015865, 0.010675989000763325 },
+      // order 18
+      { 0.33333333333333331, 0.33333333333333331, 0.0082206451233106 },
+      { 0.3808168811960464, 0.3808168811960464, 0.013546258791032512 },
+      { 0.3808168811960464, 0.23836623760790721, 0.013546258791032512 },
+      { 0.23836623760790721, 0.3808168811960464, 0.013546258791032512 },
+      { 0.15787153678371904, 0.15787153678371904, 0.009359511737192721 },
+      { 0.15787153678371904, 0.68425692643256197, 0.009359511737192721 },
+      { 0.68425692643256197, 0.15787153678371904, 0.009359511737192721 },
+      { 0.24439189653868387, 0.24439189653868387, 0.016061459089252106 },
+      { 0.24439189653868387, 0.51121620692263225, 0.016061459089252106 },
+      { 0.51121620692263225, 0.24439189653868387, 0.016061459089252106 },
+      { 0.061869054632242487, 0.061869054632242487, 0.0049809252665368384 },
+      { 0.061869054632242487, 0.87626189073551508, 0.0049809252665368384 },
+      { 0.87626189073551508, 0.061869054632242487, 0.0049809252665368384 },
+      { 0.012634503380170506, 0.012634503380170506, 0.0010386520054793777 },
+      { 0.012634503380170506, 0.97473099323965895, 0.0010386520054793777 },
+      { 0.97473099323965895, 0.012634503380170506, 0.0010386520054793777 },
+      { 0.2588870947790427, 0.61679643273259899, 0.010502722799649956 },
+      { 0.61679643273259899, 0.2588870947790427, 0.010502722799649956 },
+      { 0.2588870947790427, 0.12431647248835831, 0.010502722799649956 },
+      { 0.12431647248835831, 0.2588870947790427, 0.010502722799649956 },
+      { 0.61679643273259899, 0.12431647248835831, 0.010502722799649956 },
+      { 0.12431647248835831, 0.61679643273259899, 0.010502722799649956 },
+      { 0.53619831578448207, 0.40258958737967471, 0.0089705162206201658 },
+      { 0.40258958737967471, 0.53619831578448207, 0.0089705162206201658 },
+      { 0.53619831578448207, 0.061212096835843222, 0.0089705162206201658 },
+      { 0.061212096835843222, 0.53619831578448207, 0.0089705162206201658 },
+      { 0.40258958737967471, 0.061212096835843222, 0.0089705162206201658 },
+      { 0.061212096835843222, 0.40258958737967471, 0.0089705162206201658 },
+      { 0.0119063139924652, 0.41784012598411718, 0.0045856468112820594 },
+      { 0.41784012598411718, 0.0119063139924652, 0.0045856468112820594 },
+      { 0.0119063139924652, 0.57025356002341754, 0.0045856468112820594 },
+      { 0.57025356002341754, 0.0119063139924652, 0.0045856468112820594 },
+      { 0.41784012598411718, 0.57025356002341754, 0.0045856468112820594 },
+      { 0.57025356002341754, 0.41784012598411718, 0.0045856468112820594 },
+      { 0.065007627293849762, 0.011580866153765794, 0.0021383400446868001 },
+      { 0.011580866153765794, 0.065007627293849762, 0.0021383400446868001 },
+      { 0.065007627293849762, 0.92341150655238446, 0.0021383400446868001 },
+      { 0.92341150655238446, 0.065007627293849762, 0.0021383400446868001 },
+      { 0.011580866153765794, 0.92341150655238446, 0.0021383400446868001 },
+      { 0.92341150655238446, 0.011580866153765794, 0.0021383400446868001 },
+      { 0.49157842708367655, 0.14213550949465736, 0.01123543403692146 },
+      { 0.14213550949465736, 0.49157842708367655, 0.01123543403692146 },
+      { 0.49157842708367655, 0.36628606342166614, 0.01123543403692146 },
+      { 0.36628606342166614, 0.49157842708367655, 0.01123543403692146 },
+      { 0.14213550949465736, 0.36628606342166614, 0.01123543403692146 },
+      { 0.36628606342166614, 0.14213550949465736, 0.01123543403692146 },
+      { 0.71832840691683097, 0.0072163491376441629, 0.0027048859620935617 },
+      { 0.0072163491376441629, 0.71832840691683097, 0.0027048859620935617 },
+      { 0.71832840691683097, 0.27445524394552484, 0.0027048859620935617 },
+      { 0.27445524394552484, 0.71832840691683097, 0.0027048859620935617 },
+      { 0.0072163491376441629, 0.27445524394552484, 0.0027048859620935617 },
+      { 0.27445524394552484, 0.0072163491376441629, 0.0027048859620935617 },
+      { 0.15094907228754456, 0.069347871802352398, 0.00785586557061832 },
+      { 0.069347871802352398, 0.15094907228754456, 0.00785586557061832 },
+      { 0.15094907228754456, 0.77970305591010303, 0.00785586557061832 },
+      { 0.77970305591010303, 0.15094907228754456, 0.00785586557061832 },
+      { 0.069347871802352398, 0.77970305591010303, 0.00785586557061832 },
+      { 0.77970305591010303, 0.069347871802352398, 0.00785586557061832 },
+      { 0.04652388606330865, 0.27191065453041885, 0.0077626163023246089 },
+      { 0.27191065453041885, 0.04652388606330865, 0.0077626163023246089 },
+      { 0.04652388606330865, 0.68156545940627256, 0.0077626163023246089 },
+      { 0.68156545940627256, 0.04652388606330865, 0.0077626163023246089 },
+      { 0.27191065453041885, 0.68156545940627256, 0.0077626163023246089 },
+      { 0.68156545940627256, 0.27191065453041885, 0.0077626163023246089 },
+      { 0.013879048530266846, 0.83230704195742344, 0.0037137946198378567 },
+      { 0.83230704195742344, 0.013879048530266846, 0.0037137946198378567 },
+      { 0.013879048530266846, 0.15381390951230967, 0.0037137946198378567 },
+      { 0.15381390951230967, 0.013879048530266846, 0.0037137946198378567 },
+      { 0.83230704195742344, 0.15381390951230967, 0.0037137946198378567 },
+      { 0.15381390951230967, 0.83230704195742344, 0.0037137946198378567 },
+      // order 19
+      { 0.33333333333333331, 0.33333333333333331, 0.013398177810636952 },
+      { 0.22123482057246618, 0.22123482057246618, 0.010881090895283795 },
+      { 0.22123482057246618, 0.55753035885506763, 0.010881090895283795 },
+      { 0.55753035885506763, 0.22123482057246618, 0.010881090895283795 },
+      { 0.062614836287085779, 0.062614836287085779, 0.0048595044753953548 },
+      { 0.062614836287085779, 0.8747703274258285, 0.0048595044753953548 },
+      { 0.8747703274258285, 0.062614836287085779, 0.0048595044753953548 },
+      { 0.01296709502759345, 0.01296709502759345, 0.0010975197799312979 },
+      { 0.01296709502759345, 0.97406580994481307, 0.0010975197799312979 },
+      { 0.97406580994481307, 0.01296709502759345, 0.0010975197799312979 },
+      { 0.33127340457247451, 0.22144210678267209, 0.012127971307674219 },
+      { 0.22144210678267209, 0.33127340457247451, 0.012127971307674219 },
+      { 0.33127340457247451, 0.44728448864485337, 0.012127971307674219 },
+      { 0.44728448864485337, 0.33127340457247451, 0.012127971307674219 },
+      { 0.22144210678267209, 0.44728448864485337, 0.012127971307674219 },
+      { 0.44728448864485337, 0.22144210678267209, 0.012127971307674219 },
+      { 0.010180357176110809, 0.56822708895917495, 0.0037868360168058063 },
+      { 0.56822708895917495, 0.010180357176110809, 0.0037868360168058063 },
+      { 0.010180357176110809, 0.42159255386471428, 0.0037868360168058063 },
+      { 0.42159255386471428, 0.010180357176110809, 0.0037868360168058063 },
+      { 0.56822708895917495, 0.42159255386471428, 0.0037868360168058063 },
+      { 0.42159255386471428, 0.56822708895917495, 0.0037868360168058063 },
+      { 0.3724957619963859, 0.12517542036788412, 0.011040007297310412 },
+      { 0.12517542036788412, 0.3724957619963859, 0.011040007297310412 },
+      { 0.3724957619963859, 0.50232881763573001, 0.011040007297310412 },
+      { 0.50232881763573001, 0.3724957619963859, 0.011040007297310412 },
+      { 0.12517542036788412, 0.50232881763573001, 0.011040007297310412 },
+      { 0.50232881763573001, 0.12517542036788412, 0.011040007297310412 },
+      { 0.14999564650489275, 0.79259117829915271, 0.0065741113811524851 },
+      { 0.79259117829915271, 0.14999564650489275, 0.0065741113811524851 },
+      { 0.14999564650489275, 0.057413175195954569, 0.0065741113811524851 },
+      { 0.057413175195954569, 0.14999564650489275, 0.0065741113811524851 },
+      { 0.79259117829915271, 0.057413175195954569, 0.0065741113811524851 },
+      { 0.057413175195954569, 0.79259117829915271, 0.0065741113811524851 },
+      { 0.011052332593149477, 0.82962891537560246, 0.0030693206408511082 },
+      { 0.82962891537560246, 0.011052332593149477, 0.0030693206408511082 },
+      { 0.011052332593149477, 0.15931875203124801, 0.0030693206408511082 },
+      { 0.15931875203124801, 0.011052332593149477, 0.0030693206408511082 },
+      { 0.82962891537560246, 0.15931875203124801, 0.0030693206408511082 },
+      { 0.15931875203124801, 0.82962891537560246, 0.0030693206408511082 },
+      { 0.12485246463402422, 0.62683225102113971, 0.010111635297912711 },
+      { 0.62683225102113971, 0.12485246463402422, 0.010111635297912711 },
+      { 0.12485246463402422, 0.24831528434483607, 0.010111635297912711 },
+      { 0.24831528434483607, 0.12485246463402422, 0.010111635297912711 },
+      { 0.62683225102113971, 0.24831528434483607, 0.010111635297912711 },
+      { 0.24831528434483607, 0.62683225102113971, 0.010111635297912711 },
+      { 0.052655806491810231, 0.54461969406555255, 0.0082133844705946004 },
+      { 0.54461969406555255, 0.052655806491810231, 0.0082133844705946004 },
+      { 0.052655806491810231, 0.40272449944263722, 0.0082133844705946004 },
+      { 0.40272449944263722, 0.052655806491810231, 0.0082133844705946004 },
+      { 0.54461969406555255, 0.40272449944263722, 0.0082133844705946004 },
+      { 0.40272449944263722, 0.54461969406555255, 0.0082133844705946004 },
+      { 0.72397486461890692, 0.14354696804780182, 0.00460963538172142 },
+      { 0.14354696804780182, 0.72397486461890692, 0.00460963538172142 },
+      { 0.72397486461890692, 0.13247816733329126, 0.00460963538172142 },
+      { 0.13247816733329126, 0.72397486461890692, 0.00460963538172142 },
+      { 0.14354696804780182, 0.13247816733329126, 0.00460963538172142 },
+      { 0.13247816733329126, 0.14354696804780182, 0.00460963538172142 },
+      { 0.68020796456289589, 0.26749262971425386, 0.0074378793095653244 },
+      { 0.26749262971425386, 0.68020796456289589, 0.0074378793095653244 },
+      { 0.68020796456289589, 0.052299405722850245, 0.0074378793095653244 },
+      { 0.052299405722850245, 0.68020796456289589, 0.0074378793095653244 },
+      { 0.26749262971425386, 0.052299405722850245, 0.0074378793095653244 },
+      { 0.052299405722850245, 0.26749262971425386, 0.0074378793095653244 },
+      { 0.067073602086010764, 0.92091142526355418, 0.0022823300315055078 },
+      { 0.92091142526355418, 0.067073602086010764, 0.0022823300315055078 },
+      { 0.067073602086010764, 0.012014972650435052, 0.0022823300315055078 },
+      { 0.012014972650435052, 0.067073602086010764, 0.0022823300315055078 },
+      { 0.92091142526355418, 0.012014972650435052, 0.0022823300315055078 },
+      { 0.012014972650435052, 0.92091142526355418, 0.0022823300315055078 },
+      { 0.70861805026992242, 0.28130536098648479, 0.0034281349878283562 },
+      { 0.28130536098648479, 0.70861805026992242, 0.0034281349878283562 },
+      { 0.70861805026992242, 0.010076588743592796, 0.0034281349878283562 },
+      { 0.010076588743592796, 0.70861805026992242, 0.0034281349878283562 },
+      { 0.28130536098648479, 0.010076588743592796, 0.0034281349878283562 },
+      { 0.010076588743592796, 0.28130536098648479, 0.0034281349878283562 },
+      // order 20
+      { 0.45192242011832984, 0.45192242011832984, 0.01119415224744587 },
+      { 0.45192242011832984, 0.096155159763340325, 0.01119415224744587 },
+      { 0.096155159763340325, 0.45192242011832984, 0.01119415224744587 },
+      { 0.037870712477587103, 0.037870712477587103, 0.0027809680917639302 },
+      { 0.037870712477587103, 0.92425857504482578, 0.0027809680917639302 },
+      { 0.92425857504482578, 0.037870712477587103, 0.0027809680917639302 },
+      { 0.20831362293985387, 0.20831362293985387, 0.013741669827155417 },
+      { 0.20831362293985387, 0.58337275412029221, 0.013741669827155417 },
+      { 0.58337275412029221, 0.20831362293985387, 0.013741669827155417 },
+      { 0.082522232631651496, 0.082522232631651496, 0.0054980555370093753 },
+      { 0.082522232631651496, 0.83495553473669704, 0.0054980555370093753 },
+      { 0.83495553473669704, 0.082522232631651496, 0.0054980555370093753 },
+      { 0.49014015244831038, 0.49014015244831038, 0.0033315937598116592 },
+      { 0.49014015244831038, 0.019719695103379231, 0.0033315937598116592 },
+      { 0.019719695103379231, 0.49014015244831038, 0.0033315937598116592 },
+      { 0.29413960823225493, 0.29413960823225493, 0.013271867365835018 },
+      { 0.29413960823225493, 0.41172078353549013, 0.013271867365835018 },
+      { 0.41172078353549013, 0.29413960823225493, 0.013271867365835018 },
+      { 0.90307408749816709, 0.010072504024850598, 0.0020734989577727882 },
+      { 0.010072504024850598, 0.90307408749816709, 0.0020734989577727882 },
+      { 0.90307408749816709, 0.086853408476982308, 0.0020734989577727882 },
+      { 0.086853408476982308, 0.90307408749816709, 0.0020734989577727882 },
+      { 0.010072504024850598, 0.086853408476982308, 0.0020734989577727882 },
+      { 0.086853408476982308, 0.010072504024850598, 0.0020734989577727882 },
+      { 0.56892663028935297, 0.42707160338098477, 0.0013966029200619384 },
+      { 0.42707160338098477, 0.56892663028935297, 0.0013966029200619384 },
+      { 0.56892663028935297, 0.0040017663296622596, 0.0013966029200619384 },
+      { 0.0040017663296622596, 0.56892663028935297, 0.0013966029200619384 },
+      { 0.42707160338098477, 0.0040017663296622596, 0.0013966029200619384 },
+      { 0.0040017663296622596, 0.42707160338098477, 0.0013966029200619384 },
+      { 0.677175012684472, 0.0083921796209820553, 0.0025965777528163536 },
+      { 0.0083921796209820553, 0.677175012684472, 0.0025965777528163536 },
+      { 0.677175012684472, 0.31443280769454596, 0.0025965777528163536 },
+      { 0.31443280769454596, 0.677175012684472, 0.0025965777528163536 },
+      { 0.0083921796209820553, 0.31443280769454596, 0.0025965777528163536 },
+      { 0.31443280769454596, 0.0083921796209820553, 0.0025965777528163536 },
+      { 0.18580030502994918, 0.34330615474151066, 0.012706213507981809 },
+      { 0.34330615474151066, 0.18580030502994918, 0.012706213507981809 },
+      { 0.18580030502994918, 0.47089354022854019, 0.012706213507981809 },
+      { 0.47089354022854019, 0.18580030502994918, 0.012706213507981809 },
+      { 0.34330615474151066, 0.47089354022854019, 0.012706213507981809 },
+      { 0.47089354022854019, 0.34330615474151066, 0.012706213507981809 },
+      { 0.19097952438535915, 0.80329554894467736, 0.0019504513561346317 },
+      { 0.80329554894467736, 0.19097952438535915, 0.0019504513561346317 },
+      { 0.19097952438535915, 0.0057249266699634926, 0.0019504513561346317 },
+      { 0.0057249266699634926, 0.19097952438535915, 0.0019504513561346317 },
+      { 0.80329554894467736, 0.0057249266699634926, 0.0019504513561346317 },
+      { 0.0057249266699634926, 0.80329554894467736, 0.0019504513561346317 },
+      { 0.038516499049695875, 0.81911411398335121, 0.0045435462660720132 },
+      { 0.81911411398335121, 0.038516499049695875, 0.0045435462660720132 },
+      { 0.038516499049695875, 0.14236938696695289, 0.0045435462660720132 },
+      { 0.14236938696695289, 0.038516499049695875, 0.0045435462660720132 },
+      { 0.81911411398335121, 0.14236938696695289, 0.0045435462660720132 },
+      { 0.14236938696695289, 0.81911411398335121, 0.0045435462660720132 },
+      { 0.0031019064871050488, 0.022584598156280656, 0.00054291724063032325 },
+      { 0.022584598156280656, 0.0031019064871050488, 0.00054291724063032325 },
+      { 0.0031019064871050488, 0.97431349535661427, 0.00054291724063032325 },
+      { 0.97431349535661427, 0.0031019064871050488, 0.00054291724063032325 },
+      { 0.022584598156280656, 0.97431349535661427, 0.00054291724063032325 },
+      { 0.97431349535661427, 0.022584598156280656, 0.00054291724063032325 },
+      { 0.10573970402743836, 0.17871958851006559, 0.0089478831366225781 },
+      { 0.17871958851006559, 0.10573970402743836, 0.0089478831366225781 },
+      { 0.10573970402743836, 0.71554070746249598, 0.0089478831366225781 },
+      { 0.71554070746249598, 0.10573970402743836, 0.0089478831366225781 },
+      { 0.17871958851006559, 0.71554070746249598, 0.0089478831366225781 },
+      { 0.71554070746249598, 0.17871958851006559, 0.0089478831366225781 },
+      { 0.59494150646746446, 0.29849001665983432, 0.010705869400721695 },
+      { 0.29849001665983432, 0.59494150646746446, 0.010705869400721695 },
+      { 0.59494150646746446, 0.10656847687270121, 0.010705869400721695 },
+      { 0.10656847687270121, 0.59494150646746446, 0.010705869400721695 },
+      { 0.29849001665983432, 0.10656847687270121, 0.010705869400721695 },
+      { 0.10656847687270121, 0.29849001665983432, 0.010705869400721695 },
+      { 0.38518156435081319, 0.57216955234180744, 0.00687894795555467 },
+      { 0.57216955234180744, 0.38518156435081319, 0.00687894795555467 },
+      { 0.38518156435081319, 0.04264888330737937, 0.00687894795555467 },
+      { 0.04264888330737937, 0.38518156435081319, 0.00687894795555467 },
+      { 0.57216955234180744, 0.04264888330737937, 0.00687894795555467 },
+      { 0.04264888330737937, 0.57216955234180744, 0.00687894795555467 },
+      { 0.25064889561978626, 0.040326318643690941, 0.0060816714244538994 },
+      { 0.040326318643690941, 0.25064889561978626, 0.0060816714244538994 },
+      { 0.25064889561978626, 0.70902478573652272, 0.0060816714244538994 },
+      { 0.70902478573652272, 0.25064889561978626, 0.0060816714244538994 },
+      { 0.040326318643690941, 0.70902478573652272, 0.0060816714244538994 },
+      { 0.70902478573652272, 0.040326318643690941, 0.0060816714244538994 },
+    };
+  };
+
+  template< class T >
+  constexpr int StaticTriangleQuadratureTable< T >::orders[];
+  template< class T >
+  constexpr int StaticTriangleQuadratureTable< T >::sizes[];
+  template< class T >
+  constexpr int StaticTriangleQuadratureTable< T >::offsets[];
+  template< class T >
+  constexpr double StaticTriangleQuadratureTable< T >::data[][ 3 ];
+
+  //! tetrahedron rules of SimplexQuadratureRule< ct, 3 >
+  template< class = void >
+  struct StaticTetrahedronQuadratureTable
+  {
+    //! number of tabulated rules
+    static constexpr int size = 9;
+    //! orders of the tabulated rules
+    static constexpr int orders[] = { 1, 2, 3, 5, 6, 7, 8, 9, 10 };
+    //! number of points of the tabulated rules
+    static constexpr int sizes[] = { 1, 4, 8, 15, 24, 35, 46, 61, 89 };
+    //! index of the first point of the tabulated rules
+    static constexpr int offsets[] = { 0, 1, 5, 13, 28, 52, 87, 133, 194 };
+    //! coordinates and weight of all points
+    static constexpr double data[][ 4 ] = {
+      // order 1
+      { 0.25, 0.25, 0.25, 0.16666666666666666 },
+      // order 2
+      { 0.58541019662496852, 0.1381966011250105, 0.1381966011250105, 0.041666666666666664 },
+      { 0.1381966011250105, 0.58541019662496852, 0.1381966011250105, 0.041666666666666664 },
+      { 0.1381966011250105, 0.1381966011250105, 0.58541019662496852, 0.041666666666666664 },
+      { 0.1381966011250105, 0.1381966011250105, 0.1381966011250105, 0.041666666666666664 },
+      // order 3
+      { 0, 0, 0, 0.0041666666666666666 },
+      { 1, 0, 0, 0.0041666666666666666 },
+      { 0, 1, 0, 0.0041666666666666666 },
+      { 0, 0, 1, 0.0041666666666666666 },
+      { 0.33333333333333331, 0.33333333333333331, 0, 0.037499999999999999 },
+      { 0.33333333333333331, 0, 0.33333333333333331, 0.037499999999999999 },
+      { 0, 0.33333333333333331, 0.33333333333333331, 0.037499999999999999 },
+      { 0.33333333333333331, 0.33333333333333331, 0.33333333333333331, 0.037499999999999999 },
+      // order 5
+      { 0.25, 0.25, 0.25, 0.019753086419753086 },
+      { 0.091971078052723032, 0.091971078052723032, 0.091971078052723032, 0.01198951396316977 },
+      { 0.72408676584183085, 0.091971078052723032, 0.091971078052723032, 0.01198951396316977 },
+      { 0.091971078052723032, 0.72408676584183085, 0.091971078052723032, 0.01198951396316977 },
+      { 0.091971078052723032, 0.091971078052723032, 0.72408676584183085, 0.01198951396316977 },
+      { 0.31979362782962989, 0.31979362782962989, 0.31979362782962989, 0.011511367871045397 },
+      { 0.040619116511110276, 0.31979362782962989, 0.31979362782962989, 0.011511367871045397 },
+      { 0.31979362782962989, 0.040619116511110276, 0.31979362782962989, 0.011511367871045397 },
+      { 0.31979362782962989, 0.31979362782962989, 0.040619116511110276, 0.011511367871045397 },
+      { 0.44364916731037085, 0.056350832689629156, 0.056350832689629156, 0.0088183421516754845 },
+      { 0.056350832689629156, 0.44364916731037085, 0.056350832689629156, 0.0088183421516754845 },
+      { 0.056350832689629156, 0.056350832689629156, 0.44364916731037085, 0.0088183421516754845 },
+      { 0.44364916731037085, 0.44364916731037085, 0.056350832689629156, 0.0088183421516754845 },
+      { 0.44364916731037085, 0.056350832689629156, 0.44364916731037085, 0.0088183421516754845 },
+      { 0.056350832689629156, 0.44364916731037085, 0.44364916731037085, 0.0088183421516754845 },
+      // order 6
+      { 0.21460287125915203, 0.21460287125915203, 0.35619138622254387, 0.0066537917096945818 },
+      { 0.21460287125915203, 0.35619138622254387, 0.21460287125915203, 0.0066537917096945818 },
+      { 0.35619138622254387, 0.21460287125915203, 0.21460287125915203, 0.0066537917096945818 },
+      { 0.21460287125915203, 0.21460287125915203, 0.21460287125915203, 0.0066537917096945818 },
+      { 0.32233789014227548, 0.32233789014227548, 0.32233789014227548, 0.0092261969239424545 },
+      { 0.032986329573173601, 0.32233789014227548, 0.32233789014227548, 0.0092261969239424545 },
+      { 0.32233789014227548, 0.032986329573173601, 0.32233789014227548, 0.0092261969239424545 },
+      { 0.32233789014227548, 0.32233789014227548, 0.032986329573173601, 0.0092261969239424545 },
+      { 0.040673958534611351, 0.040673958534611351, 0.87797812439616596, 0.0016795351758867739 },
+      { 0.040673958534611351, 0.87797812439616596, 0.040673958534611351, 0.0016795351758867739 },
+      { 0.87797812439616596, 0.040673958534611351, 0.040673958534611351, 0.0016795351758867739 },
+      { 0.040673958534611351, 0.040673958534611351, 0.040673958534611351, 0.0016795351758867739 },
+      { 0.063661001875017525, 0.26967233145831582, 0.60300566479164908, 0.0080357142857142849 },
+      { 0.063661001875017525, 0.60300566479164908, 0.26967233145831582, 0.0080357142857142849 },
+      { 0.26967233145831582, 0.063661001875017525, 0.60300566479164908, 0.0080357142857142849 },
+      { 0.26967233145831582, 0.60300566479164908, 0.063661001875017525, 0.0080357142857142849 },
+      { 0.60300566479164908, 0.063661001875017525, 0.26967233145831582, 0.0080357142857142849 },
+      { 0.60300566479164908, 0.26967233145831582, 0.063661001875017525, 0.0080357142857142849 },
+      { 0.063661001875017525, 0.063661001875017525, 0.60300566479164908, 0.0080357142857142849 },
+      { 0.063661001875017525, 0.60300566479164908, 0.063661001875017525, 0.0080357142857142849 },
+      { 0.60300566479164908, 0.063661001875017525, 0.063661001875017525, 0.0080357142857142849 },
+      { 0.063661001875017525, 0.063661001875017525, 0.26967233145831582, 0.0080357142857142849 },
+      { 0.063661001875017525, 0.26967233145831582, 0.063661001875017525, 0.0080357142857142849 },
+      { 0.26967233145831582, 0.063661001875017525, 0.063661001875017525, 0.0080357142857142849 },
+      // order 7
+      { 0.25, 0.25, 0.25, 0.015914214910688475 },
+      { 0.31570114977820279, 0.31570114977820279, 0.31570114977820279, 0.0070549302016611713 },
+      { 0.052896550665391562, 0.31570114977820279, 0.31570114977820279, 0.0070549302016611713 },
+      { 0.31570114977820279, 0.052896550665391562, 0.31570114977820279, 0.0070549302016611713 },
+      { 0.31570114977820279, 0.31570114977820279, 0.052896550665391562, 0.0070549302016611713 },
+      { 0.050489822598396371, 0.44951017740160365, 0.44951017740160365, 0.0053161546388095964 },
+      { 0.44951017740160365, 0.050489822598396371, 0.44951017740160365, 0.0053161546388095964 },
+      { 0.44951017740160365, 0.44951017740160365, 0.050489822598396371, 0.0053161546388095964 },
+      { 0.050489822598396371, 0.050489822598396371, 0.44951017740160365, 0.0053161546388095964 },
+      { 0.050489822598396371, 0.44951017740160365, 0.050489822598396371, 0.0053161546388095964 },
+      { 0.44951017740160365, 0.050489822598396371, 0.050489822598396371, 0.0053161546388095964 },
+      { 0.021265472541483248, 0.14663881381848495, 0.81083024109854851, 0.0013517951383172236 },
+      { 0.021265472541483248, 0.81083024109854851, 0.14663881381848495, 0.0013517951383172236 },
+      { 0.14663881381848495, 0.021265472541483248, 0.81083024109854851, 0.0013517951383172236 },
+      { 0.14663881381848495, 0.81083024109854851, 0.021265472541483248, 0.0013517951383172236 },
+      { 0.81083024109854851, 0.021265472541483248, 0.14663881381848495, 0.0013517951383172236 },
+      { 0.81083024109854851, 0.14663881381848495, 0.021265472541483248, 0.0013517951383172236 },
+      { 0.021265472541483248, 0.021265472541483248, 0.81083024109854851, 0.0013517951383172236 },
+      { 0.021265472541483248, 0.81083024109854851, 0.021265472541483248, 0.0013517951383172236 },
+      { 0.81083024109854851, 0.021265472541483248, 0.021265472541483248, 0.0013517951383172236 },
+      { 0.021265472541483248, 0.021265472541483248, 0.14663881381848495, 0.0013517951383172236 },
+      { 0.021265472541483248, 0.14663881381848495, 0.021265472541483248, 0.0013517951383172236 },
+      { 0.14663881381848495, 0.021265472541483248, 0.021265472541483248, 0.0013517951383172236 },
+      { 0.18883383102600104, 0.18883383102600104, 0.57517163758700007, 0.0062011884547224366 },
+      { 0.18883383102600104, 0.57517163758700007, 0.18883383102600104, 0.0062011884547224366 },
+      { 0.57517163758700007, 0.18883383102600104, 0.18883383102600104, 0.0062011884547224366 },
+      { 0.047160700360997884, 0.18883383102600104, 0.57517163758700007, 0.0062011884547224366 },
+      { 0.047160700360997884, 0.57517163758700007, 0.18883383102600104, 0.0062011884547224366 },
+      { 0.18883383102600104, 0.047160700360997884, 0.57517163758700007, 0.0062011884547224366 },
+      { 0.18883383102600104, 0.57517163758700007, 0.047160700360997884, 0.0062011884547224366 },
+      { 0.57517163758700007, 0.047160700360997884, 0.18883383102600104, 0.0062011884547224366 },
+      { 0.57517163758700007, 0.18883383102600104, 0.047160700360997884, 0.0062011884547224366 },
+      { 0.047160700360997884, 0.18883383102600104, 0.18883383102600104, 0.0062011884547224366 },
+      { 0.18883383102600104, 0.047160700360997884, 0.18883383102600104, 0.0062011884547224366 },
+      { 0.18883383102600104, 0.18883383102600104, 0.047160700360997884, 0.0062011884547224366 },
+      // order 8
+      { 0.31555698131265242, 0.31555698131265242, 0.31555698131265242, 0.004772337095582742 },
+      { 0.053329056062042746, 0.31555698131265242, 0.31555698131265242, 0.004772337095582742 },
+      { 0.31555698131265242, 0.053329056062042746, 0.31555698131265242, 0.004772337095582742 },
+      { 0.31555698131265242, 0.31555698131265242, 0.053329056062042746, 0.004772337095582742 },
+      { 0.18589621968287834, 0.18589621968287834, 0.44231134095136504, 0.0097253541972492884 },
+      { 0.18589621968287834, 0.44231134095136504, 0.18589621968287834, 0.0097253541972492884 },
+      { 0.44231134095136504, 0.18589621968287834, 0.18589621968287834, 0.0097253541972492884 },
+      { 0.18589621968287834, 0.18589621968287834, 0.18589621968287834, 0.0097253541972492884 },
+      { 0.075241800873506307, 0.075241800873506307, 0.77427459737948112, 0.0030935791986304016 },
+      { 0.075241800873506307, 0.77427459737948112, 0.075241800873506307, 0.0030935791986304016 },
+      { 0.77427459737948112, 0.075241800873506307, 0.075241800873506307, 0.0030935791986304016 },
+      { 0.075241800873506307, 0.075241800873506307, 0.075241800873506307, 0.0030935791986304016 },
+      { 0.0029864883330316359, 0.0029864883330316359, 0.99104053500090505, 0.00012954939220704599 },
+      { 0.0029864883330316359, 0.99104053500090505, 0.0029864883330316359, 0.00012954939220704599 },
+      { 0.99104053500090505, 0.0029864883330316359, 0.0029864883330316359, 0.00012954939220704599 },
+      { 0.0029864883330316359, 0.0029864883330316359, 0.0029864883330316359, 0.00012954939220704599 },
+      { 0.057034671748965649, 0.44296532825103435, 0.44296532825103435, 0.0052991891939023232 },
+      { 0.44296532825103435, 0.057034671748965649, 0.44296532825103435, 0.0052991891939023232 },
+      { 0.44296532825103435, 0.44296532825103435, 0.057034671748965649, 0.0052991891939023232 },
+      { 0.057034671748965649, 0.057034671748965649, 0.44296532825103435, 0.0052991891939023232 },
+      { 0.057034671748965649, 0.44296532825103435, 0.057034671748965649, 0.0052991891939023232 },
+      { 0.44296532825103435, 0.057034671748965649, 0.057034671748965649, 0.0052991891939023232 },
+      { 0.21073223335640306, 0.21073223335640306, 0.55298166683223204, 0.0039482139243978585 },
+      { 0.21073223335640306, 0.55298166683223204, 0.21073223335640306, 0.0039482139243978585 },
+      { 0.55298166683223204, 0.21073223335640306, 0.21073223335640306, 0.0039482139243978585 },
+      { 0.025553866454961861, 0.21073223335640306, 0.55298166683223204, 0.0039482139243978585 },
+      { 0.025553866454961861, 0.55298166683223204, 0.21073223335640306, 0.0039482139243978585 },
+      { 0.21073223335640306, 0.025553866454961861, 0.55298166683223204, 0.0039482139243978585 },
+      { 0.21073223335640306, 0.55298166683223204, 0.025553866454961861, 0.0039482139243978585 },
+      { 0.55298166683223204, 0.025553866454961861, 0.21073223335640306, 0.0039482139243978585 },
+      { 0.55298166683223204, 0.21073223335640306, 0.025553866454961861, 0.0039482139243978585 },
+      { 0.025553866454961861, 0.21073223335640306, 0.21073223335640306, 0.0039482139243978585 },
+      { 0.21073223335640306, 0.025553866454961861, 0.21073223335640306, 0.0039482139243978585 },
+      { 0.21073223335640306, 0.21073223335640306, 0.025553866454961861, 0.0039482139243978585 },
+      { 0.026111684612337222, 0.21451947856758524, 0.73325715220774035, 0.0013841404063167099 },
+      { 0.026111684612337222, 0.73325715220774035, 0.21451947856758524, 0.0013841404063167099 },
+      { 0.21451947856758524, 0.026111684612337222, 0.73325715220774035, 0.0013841404063167099 },
+      { 0.21451947856758524, 0.73325715220774035, 0.026111684612337222, 0.0013841404063167099 },
+      { 0.73325715220774035, 0.026111684612337222, 0.21451947856758524, 0.0013841404063167099 },
+      { 0.73325715220774035, 0.21451947856758524, 0.026111684612337222, 0.0013841404063167099 },
+      { 0.026111684612337222, 0.026111684612337222, 0.73325715220774035, 0.0013841404063167099 },
+      { 0.026111684612337222, 0.73325715220774035, 0.026111684612337222, 0.0013841404063167099 },
+      { 0.73325715220774035, 0.026111684612337222, 0.026111684612337222, 0.0013841404063167099 },
+      { 0.026111684612337222, 0.026111684612337222, 0.21451947856758524, 0.0013841404063167099 },
+      { 0.026111684612337222, 0.21451947856758524, 0.026111684612337222, 0.0013841404063167099 },
+      { 0.21451947856758524, 0.026111684612337222, 0.026111684612337222, 0.0013841404063167099 },
+      // order 9
+      { 0.25, 0.25, 0.25, 0.0096255907208369507 },
+      { 0.034938495937859609, 0.034938495937859609, 0.89518451218642114, 0.00073010480449562168 },
+      { 0.034938495937859609, 0.89518451218642114, 0.034938495937859609, 0.00073010480449562168 },
+      { 0.89518451218642114, 0.034938495937859609, 0.034938495937859609, 0.00073010480449562168 },
+      { 0.034938495937859609, 0.034938495937859609, 0.034938495937859609, 0.00073010480449562168 },
+      { 0.31432607103711679, 0.31432607103711679, 0.31432607103711679, 0.0065459359965439048 },
+      { 0.057021786888649562, 0.31432607103711679, 0.31432607103711679, 0.0065459359965439048 },
+      { 0.31432607103711679, 0.057021786888649562, 0.31432607103711679, 0.0065459359965439048 },
+      { 0.31432607103711679, 0.31432607103711679, 0.057021786888649562, 0.0065459359965439048 },
+      { 0.15325282393868966, 0.15325282393868966, 0.54024152818393101, 0.0073986275737670387 },
+      { 0.15325282393868966, 0.54024152818393101, 0.15325282393868966, 0.0073986275737670387 },
+      { 0.54024152818393101, 0.15325282393868966, 0.15325282393868966, 0.0073986275737670387 },
+      { 0.15325282393868966, 0.15325282393868966, 0.15325282393868966, 0.0073986275737670387 },
+      { 0.089427631888452166, 0.41057236811154785, 0.41057236811154785, 0.0051777848120120396 },
+      { 0.41057236811154785, 0.089427631888452166, 0.41057236811154785, 0.0051777848120120396 },
+      { 0.41057236811154785, 0.41057236811154785, 0.089427631888452166, 0.0051777848120120396 },
+      { 0.089427631888452166, 0.089427631888452166, 0.41057236811154785, 0.0051777848120120396 },
+      { 0.089427631888452166, 0.41057236811154785, 0.089427631888452166, 0.0051777848120120396 },
+      { 0.41057236811154785, 0.089427631888452166, 0.089427631888452166, 0.0051777848120120396 },
+      { 0.010071139653703542, 0.48992886034629646, 0.48992886034629646, 0.0006890457594628921 },
+      { 0.48992886034629646, 0.010071139653703542, 0.48992886034629646, 0.0006890457594628921 },
+      { 0.48992886034629646, 0.48992886034629646, 0.010071139653703542, 0.0006890457594628921 },
+      { 0.010071139653703542, 0.010071139653703542, 0.48992886034629646, 0.0006890457594628921 },
+      { 0.010071139653703542, 0.48992886034629646, 0.010071139653703542, 0.0006890457594628921 },
+      { 0.48992886034629646, 0.010071139653703542, 0.010071139653703542, 0.0006890457594628921 },
+      { 0.040392064069416693, 0.18294626026132219, 0.73626961159984439, 0.0020763048556453768 },
+      { 0.040392064069416693, 0.73626961159984439, 0.18294626026132219, 0.0020763048556453768 },
+      { 0.18294626026132219, 0.040392064069416693, 0.73626961159984439, 0.0020763048556453768 },
+      { 0.18294626026132219, 0.73626961159984439, 0.040392064069416693, 0.0020763048556453768 },
+      { 0.73626961159984439, 0.040392064069416693, 0.18294626026132219, 0.0020763048556453768 },
+      { 0.73626961159984439, 0.18294626026132219, 0.040392064069416693, 0.0020763048556453768 },
+      { 0.040392064069416693, 0.040392064069416693, 0.73626961159984439, 0.0020763048556453768 },
+      { 0.040392064069416693, 0.73626961159984439, 0.040392064069416693, 0.0020763048556453768 },
+      { 0.73626961159984439, 0.040392064069416693, 0.040392064069416693, 0.0020763048556453768 },
+      { 0.040392064069416693, 0.040392064069416693, 0.18294626026132219, 0.0020763048556453768 },
+      { 0.040392064069416693, 0.18294626026132219, 0.040392064069416693, 0.0020763048556453768 },
+      { 0.18294626026132219, 0.040392064069416693, 0.040392064069416693, 0.0020763048556453768 },
+      { 0.14243401922542023, 0.28450563183907573, 0.56235066715029258, 0.0015927400312503893 },
+      { 0.14243401922542023, 0.56235066715029258, 0.28450563183907573, 0.0015927400312503893 },
+      { 0.28450563183907573, 0.14243401922542023, 0.56235066715029258, 0.0015927400312503893 },
+      { 0.28450563183907573, 0.56235066715029258, 0.14243401922542023, 0.0015927400312503893 },
+      { 0.56235066715029258, 0.14243401922542023, 0.28450563183907573, 0.0015927400312503893 },
+      { 0.56235066715029258, 0.28450563183907573, 0.14243401922542023, 0.0015927400312503893 },
+      { 0.010709681785211497, 0.28450563183907573, 0.56235066715029258, 0.0015927400312503893 },
+      { 0.010709681785211497, 0.56235066715029258, 0.28450563183907573, 0.0015927400312503893 },
+      { 0.28450563183907573, 0.010709681785211497, 0.56235066715029258, 0.0015927400312503893 },
+      { 0.28450563183907573, 0.56235066715029258, 0.010709681785211497, 0.0015927400312503893 },
+      { 0.56235066715029258, 0.010709681785211497, 0.28450563183907573, 0.0015927400312503893 },
+      { 0.56235066715029258, 0.28450563183907573, 0.010709681785211497, 0.0015927400312503893 },
+      { 0.010709681785211497, 0.14243401922542023, 0.56235066715029258, 0.0015927400312503893 },
+      { 0.010709681785211497, 0.56235066715029258, 0.14243401922542023, 0.0015927400312503893 },
+      { 0.14243401922542023, 0.010709681785211497, 0.56235066715029258, 0.0015927400312503893 },
+      { 0.14243401922542023, 0.56235066715029258, 0.010709681785211497, 0.0015927400312503893 },
+      { 0.56235066715029258, 0.010709681785211497, 0.14243401922542023, 0.0015927400312503893 },
+      { 0.56235066715029258, 0.14243401922542023, 0.010709681785211497, 0.0015927400312503893 },
+      { 0.010709681785211497, 0.14243401922542023, 0.28450563183907573, 0.0015927400312503893 },
+      { 0.010709681785211497, 0.28450563183907573, 0.14243401922542023, 0.0015927400312503893 },
+      { 0.14243401922542023, 0.010709681785211497, 0.28450563183907573, 0.0015927400312503893 },
+      { 0.14243401922542023, 0.28450563183907573, 0.010709681785211497, 0.0015927400312503893 },
+      { 0.28450563183907573, 0.010709681785211497, 0.14243401922542023, 0.0015927400312503893 },
+      { 0.28450563183907573, 0.14243401922542023, 0.010709681785211497, 0.0015927400312503893 },
+      // order 10
+      { 0.25, 0.25, 0.25, 0.0085743195190500516 },
+      { 0.023229023144883107, 0.023229023144883107, 0.93031293056535069, 0.00024512369483312282 },
+      { 0.023229023144883107, 0.93031293056535069, 0.023229023144883107, 0.00024512369483312282 },
+      { 0.93031293056535069, 0.023229023144883107, 0.023229023144883107, 0.00024512369483312282 },
+      { 0.023229023144883107, 0.023229023144883107, 0.023229023144883107, 0.00024512369483312282 },
+      { 0.11693993856673922, 0.26712254504083693, 0.4989975778256846, 0.0040703141215879275 },
+      { 0.11693993856673922, 0.4989975778256846, 0.26712254504083693, 0.0040703141215879275 },
+      { 0.26712254504083693, 0.11693993856673922, 0.4989975778256846, 0.0040703141215879275 },
+      { 0.26712254504083693, 0.4989975778256846, 0.11693993856673922, 0.0040703141215879275 },
+      { 0.4989975778256846, 0.11693993856673922, 0.26712254504083693, 0.0040703141215879275 },
+      { 0.4989975778256846, 0.26712254504083693, 0.11693993856673922, 0.0040703141215879275 },
+      { 0.11693993856673922, 0.11693993856673922, 0.4989975778256846, 0.0040703141215879275 },
+      { 0.11693993856673922, 0.4989975778256846, 0.11693993856673922, 0.0040703141215879275 },
+      { 0.4989975778256846, 0.11693993856673922, 0.11693993856673922, 0.0040703141215879275 },
+      { 0.11693993856673922, 0.11693993856673922, 0.26712254504083693, 0.0040703141215879275 },
+      { 0.11693993856673922, 0.26712254504083693, 0.11693993856673922, 0.0040703141215879275 },
+      { 0.26712254504083693, 0.11693993856673922, 0.11693993856673922, 0.0040703141215879275 },
+      { 0.1114300084741668, 0.1114300084741668, 0.71570511391603009, 0.00070533720007271642 },
+      { 0.1114300084741668, 0.71570511391603009, 0.1114300084741668, 0.00070533720007271642 },
+      { 0.71570511391603009, 0.1114300084741668, 0.1114300084741668, 0.00070533720007271642 },
+      { 0.061434869135636339, 0.1114300084741668, 0.71570511391603009, 0.00070533720007271642 },
+      { 0.061434869135636339, 0.71570511391603009, 0.1114300084741668, 0.00070533720007271642 },
+      { 0.1114300084741668, 0.061434869135636339, 0.71570511391603009, 0.00070533720007271642 },
+      { 0.1114300084741668, 0.71570511391603009, 0.061434869135636339, 0.00070533720007271642 },
+      { 0.71570511391603009, 0.061434869135636339, 0.1114300084741668, 0.00070533720007271642 },
+      { 0.71570511391603009, 0.1114300084741668, 0.061434869135636339, 0.00070533720007271642 },
+      { 0.061434869135636339, 0.1114300084741668, 0.1114300084741668, 0.00070533720007271642 },
+      { 0.1114300084741668, 0.061434869135636339, 0.1114300084741668, 0.00070533720007271642 },
+      { 0.1114300084741668, 0.1114300084741668, 0.061434869135636339, 0.00070533720007271642 },
+      { 0.026889434657654188, 0.14010875283001534, 0.80611237785467627, 0.00083879720426817742 },
+      { 0.026889434657654188, 0.80611237785467627, 0.14010875283001534, 0.00083879720426817742 },
+      { 0.14010875283001534, 0.026889434657654188, 0.80611237785467627, 0.00083879720426817742 },
+      { 0.14010875283001534, 0.80611237785467627, 0.026889434657654188, 0.00083879720426817742 },
+      { 0.80611237785467627, 0.026889434657654188, 0.14010875283001534, 0.00083879720426817742 },
+      { 0.80611237785467627, 0.14010875283001534, 0.026889434657654188, 0.00083879720426817742 },
+      { 0.026889434657654188, 0.026889434657654188, 0.80611237785467627, 0.00083879720426817742 },
+      { 0.026889434657654188, 0.80611237785467627, 0.026889434657654188, 0.00083879720426817742 },
+      { 0.80611237785467627, 0.026889434657654188, 0.026889434657654188, 0.00083879720426817742 },
+      { 0.026889434657654188, 0.026889434657654188, 0.14010875283001534, 0.00083879720426817742 },
+      { 0.026889434657654188, 0.14010875283001534, 0.026889434657654188, 0.00083879720426817742 },
+      { 0.14010875283001534, 0.026889434657654188, 0.026889434657654188, 0.00083879720426817742 },
+      { 0.16910505830772482, 0.41097020263724471, 0.41097020263724471, 0.0015454250480386612 },
+      { 0.41097020263724471, 0.16910505830772482, 0.41097020263724471, 0.0015454250480386612 },
+      { 0.41097020263724471, 0.41097020263724471, 0.16910505830772482, 0.0015454250480386612 },
+      { 0.0089545364177857634, 0.41097020263724471, 0.41097020263724471, 0.0015454250480386612 },
+      { 0.41097020263724471, 0.0089545364177857634, 0.41097020263724471, 0.0015454250480386612 },
+      { 0.41097020263724471, 0.41097020263724471, 0.0089545364177857634, 0.0015454250480386612 },
+      { 0.0089545364177857634, 0.16910505830772482, 0.41097020263724471, 0.0015454250480386612 },
+      { 0.0089545364177857634, 0.41097020263724471, 0.16910505830772482, 0.0015454250480386612 },
+      { 0.16910505830772482, 0.0089545364177857634, 0.41097020263724471, 0.0015454250480386612 },
+      { 0.16910505830772482, 0.41097020263724471, 0.0089545364177857634, 0.0015454250480386612 },
+      { 0.41097020263724471, 0.0089545364177857634, 0.16910505830772482, 0.0015454250480386612 },
+      { 0.41097020263724471, 0.16910505830772482, 0.0089545364177857634, 0.0015454250480386612 },
+      { 0.033941965797062136, 0.34341215145795811, 0.58870391694791757, 0.0017461610725512577 },
+      { 0.033941965797062136, 0.58870391694791757, 0.34341215145795811, 0.0017461610725512577 },
+      { 0.34341215145795811, 0.033941965797062136, 0.58870391694791757, 0.0017461610725512577 },
+      { 0.34341215145795811, 0.58870391694791757, 0.033941965797062136, 0.0017461610725512577 },
+      { 0.58870391694791757, 0.033941965797062136, 0.34341215145795811, 0.0017461610725512577 },
+      { 0.58870391694791757, 0.34341215145795811, 0.033941965797062136, 0.0017461610725512577 },
+      { 0.033941965797062136, 0.033941965797062136, 0.58870391694791757, 0.0017461610725512577 },
+      { 0.033941965797062136, 0.58870391694791757, 0.033941965797062136, 0.0017461610725512577 },
+      { 0.58870391694791757, 0.033941965797062136, 0.033941965797062136, 0.0017461610725512577 },
+      { 0.033941965797062136, 0.033941965797062136, 0.34341215145795811, 0.0017461610725512577 },
+      { 0.033941965797062136, 0.34341215145795811, 0.033941965797062136, 0.0017461610725512577 },
+      { 0.34341215145795811, 0.033941965797062136, 0.033941965797062136, 0.0017461610725512577 },
+      { 0.17365254267688127, 0.17365254267688127, 0.63544280281771437, 0.0017943789427587685 },
+      { 0.17365254267688127, 0.63544280281771437, 0.17365254267688127, 0.0017943789427587685 },
+      { 0.63544280281771437, 0.17365254267688127, 0.17365254267688127, 0.0017943789427587685 },
+      { 0.017252111828523167, 0.17365254267688127, 0.63544280281771437, 0.0017943789427587685 },
+      { 0.017252111828523167, 0.63544280281771437, 0.17365254267688127, 0.0017943789427587685 },
+      { 0.17365254267688127, 0.017252111828523167, 0.63544280281771437, 0.0017943789427587685 },
+      { 0.17365254267688127, 0.63544280281771437, 0.017252111828523167, 0.0017943789427587685 },
+      { 0.63544280281771437, 0.017252111828523167, 0.17365254267688127, 0.0017943789427587685 },
+      { 0.63544280281771437, 0.17365254267688127, 0.017252111828523167, 0.0017943789427587685 },
+      { 0.017252111828523167, 0.17365254267688127, 0.17365254267688127, 0.0017943789427587685 },
+      { 0.17365254267688127, 0.017252111828523167, 0.17365254267688127, 0.0017943789427587685 },
+      { 0.17365254267688127, 0.17365254267688127, 0.017252111828523167, 0.0017943789427587685 },
+      { 0.2266745510031962, 0.35368177545833002, 0.35368177545833002, 0.0023922407747461686 },
+      { 0.35368177545833002, 0.2266745510031962, 0.35368177545833002, 0.0023922407747461686 },
+      { 0.35368177545833002, 0.35368177545833002, 0.2266745510031962, 0.0023922407747461686 },
+      { 0.065961898080143772, 0.35368177545833002, 0.35368177545833002, 0.0023922407747461686 },
+      { 0.35368177545833002, 0.065961898080143772, 0.35368177545833002, 0.0023922407747461686 },
+      { 0.35368177545833002, 0.35368177545833002, 0.065961898080143772, 0.0023922407747461686 },
+      { 0.065961898080143772, 0.2266745510031962, 0.35368177545833002, 0.0023922407747461686 },
+      { 0.065961898080143772, 0.35368177545833002, 0.2266745510031962, 0.0023922407747461686 },
+      { 0.2266745510031962, 0.065961898080143772, 0.35368177545833002, 0.0023922407747461686 },
+      { 0.2266745510031962, 0.35368177545833002, 0.065961898080143772, 0.0023922407747461686 },
+      { 0.35368177545833002, 0.065961898080143772, 0.2266745510031962, 0.0023922407747461686 },
+      { 0.35368177545833002, 0.2266745510031962, 0.065961898080143772, 0.0023922407747461686 },
+    };
+  };
+
+  template< class T >
+  constexpr int StaticTetrahedronQuadratureTable< T >::orders[];
+  template< class T >
+  constexpr int StaticTetrahedronQuadratureTable< T >::sizes[];
+  template< class T >
+  constexpr int StaticTetrahedronQuadratureTable< T >::offsets[];
+  template< class T >
+  constexpr double StaticTetrahedronQuadratureTable< T >::data[][ 4 ];
+
+} // namespace Impl
+
+} // namespace Dune
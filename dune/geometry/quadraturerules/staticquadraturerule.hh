@@ -0,0 +1,268 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#ifndef DUNE_GEOMETRY_QUADRATURERULES_STATICQUADRATURERULE_HH
+#define DUNE_GEOMETRY_QUADRATURERULES_STATICQUADRATURERULE_HH
+
+/** \file
+ *  \brief Quadrature rules whose points and weights are known at compile time
+ */
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <dune/common/fvector.hh>
+
+#include <dune/geometry/type.hh>
+
+#define DUNE_INCLUDING_IMPLEMENTATION
+#include "staticquadrature_imp.hh"
+
+namespace Dune
+{
+
+  // StaticQuadraturePoint
+  // ---------------------
+
+  /** \brief A quadrature point of a StaticQuadratureRule
+   *  \ingroup Quadrature
+   *
+   *  In contrast to QuadraturePoint, this is a literal type, so the points
+   *  of a StaticQuadratureRule can be evaluated at compile time.
+   */
+  template< class ct, int dim >
+  class StaticQuadraturePoint
+  {
+  public:
+    //! dimension of the integration domain
+    enum { dimension = dim };
+
+    //! number type used for coordinates and weights
+    typedef ct Field;
+
+    //! type used for the position of a quadrature point
+    typedef FieldVector< ct, dim > Vector;
+
+    constexpr StaticQuadraturePoint ( const std::array< ct, dim > &coordinates, const ct &weight )
+      : coordinates_( coordinates ), weight_( weight )
+    {}
+
+    //! return local coordinates of integration point
+    Vector position () const
+    {
+      Vector x;
+      for( int j = 0; j < dim; ++j )
+        x[ j ] = coordinates_[ j ];
+      return x;
+    }
+
+    //! return the j-th local coordinate of integration point
+    constexpr const ct &coordinate ( int j ) const { return coordinates_[ j ]; }
+
+    //! return weight associated with integration point
+    constexpr const ct &weight () const { return weight_; }
+
+  private:
+    std::array< ct, dim > coordinates_;
+    ct weight_;
+  };
+
+
+
+  namespace Impl
+  {
+
+    constexpr std::size_t staticPower ( std::size_t base, int exponent )
+    {
+      return (exponent == 0 ? 1 : base*staticPower( base, exponent-1 ));
+    }
+
+    // tensor products of the one-dimensional Gauss-Legendre rules, in the
+    // same order as built by TensorProductQuadratureRule
+    template< class ct, int dim, int p >
+    struct StaticCubeQuadrature
+    {
+      typedef StaticGaussLegendreTable<> Table;
+
+      static const int points1D = p/2 + 1;
+      static_assert( points1D <= Table::size, "StaticQuadratureRule: order not tabulated for cubes" );
+
+      static const int order = 2*points1D - 1;
+      static const std::size_t size = staticPower( points1D, dim );
+
+      static constexpr int index ( std::size_t i, int j )
+      {
+        return Table::offset( points1D ) + int( (i / staticPower( points1D, dim-1-j )) % points1D );
+      }
+
+      static constexpr ct coordinate ( std::size_t i, int j )
+      {
+        return ct( Table::points[ index( i, j ) ] );
+      }
+
+      static constexpr ct weight ( std::size_t i )
+      {
+        ct w = ct( Table::weights[ index( i, 0 ) ] );
+        for( int j = 1; j < dim; ++j )
+          w *= ct( Table::weights[ index( i, j ) ] );
+        return w;
+      }
+    };
+
+    template< int dim >
+    struct StaticSimplexTable;
+
+    template<>
+    struct StaticSimplexTable< 2 >
+    {
+      typedef StaticTriangleQuadratureTable<> Type;
+    };
+
+    template<>
+    struct StaticSimplexTable< 3 >
+    {
+      typedef StaticTetrahedronQuadratureTable<> Type;
+    };
+
+    // index of the first tabulated rule of at least order p
+    template< class Table >
+    constexpr int staticSimplexRule ( int p )
+    {
+      int k = 0;
+      while( Table::orders[ k ] < p )
+        ++k;
+      return k;
+    }
+
+    // the tabulated rules of SimplexQuadratureRule
+    template< class ct, int dim, int p >
+    struct StaticSimplexQuadrature
+    {
+      typedef typename StaticSimplexTable< dim >::Type Table;
+
+      static_assert( p <= Table::orders[ Table::size-1 ], "StaticQuadratureRule: order not tabulated for simplices" );
+
+      static constexpr int rule () { return staticSimplexRule< Table >( p ); }
+
+      static const int order = Table::orders[ staticSimplexRule< Table >( p ) ];
+      static const std::size_t size = Table::sizes[ staticSimplexRule< Table >( p ) ];
+
+      static constexpr ct coordinate ( std::size_t i, int j )
+      {
+        return ct( Table::data[ Table::offsets[ rule() ] + i ][ j ] );
+      }
+
+      static constexpr ct weight ( std::size_t i )
+      {
+        return ct( Table::data[ Table::offsets[ rule() ] + i ][ dim ] );
+      }
+    };
+
+    template< class ct, int dim, unsigned int topologyId, int p >
+    using StaticQuadrature
+      = typename std::conditional< (dim == 1) || (topologyId == (1u << dim) - 1u),
+                                   StaticCubeQuadrature< ct, dim, p >,
+                                   StaticSimplexQuadrature< ct, dim, p > >::type;
+
+    template< class ct, int dim, class Quadrature, std::size_t i, std::size_t... j >
+    constexpr StaticQuadraturePoint< ct, dim > staticQuadraturePoint ( std::index_sequence< j... > )
+    {
+      return StaticQuadraturePoint< ct, dim >( {{ Quadrature::coordinate( i, j )... }}, Quadrature::weight( i ) );
+    }
+
+    template< class ct, int dim, class Quadrature, std::size_t... i >
+    constexpr std::array< StaticQuadraturePoint< ct, dim >, sizeof...( i ) >
+    staticQuadraturePoints ( std::index_sequence< i... > )
+    {
+      return {{ staticQuadraturePoint< ct, dim, Quadrature, i >( std::make_index_sequence< dim >() )... }};
+    }
+
+  } // namespace Impl
+
+
+
+  // StaticQuadratureRule
+  // --------------------
+
+  /** \brief Gauss-Legendre quadrature rule for a reference element and order
+   *         fixed at compile time
+   *  \ingroup Quadrature
+   *
+   *  The points and weights are the ones of
+   *  QuadratureRules< ct, dim >::rule( GeometryType( topologyId, dim ), p ),
+   *  in the same order, but they are stored in a constexpr std::array. Loops
+   *  over the rule therefore have a trip count known at compile time and
+   *  need no lookup in the QuadratureRules singleton, so the compiler can
+   *  unroll them and fold the points and weights into the code.
+   *
+   *  The points and weights are tabulated as double, just as the dynamic
+   *  rules for fundamental types are.  For float and long double they
+   *  therefore coincide with the dynamic rules, but they are not more
+   *  accurate than double.  Other number types, whose dynamic rules are
+   *  computed to their full precision, are not supported.
+   *
+   *  Rules are available for cubes (up to order 31) and for triangles and
+   *  tetrahedra (up to the order of SimplexQuadratureRule). The geometry type
+   *  is given by its topology id, e.g.,
+   *  \code
+   *  StaticQuadratureRule< double, 2, GeometryTypes::triangle.id(), 4 >
+   *  \endcode
+   *
+   *  \tparam  ct          number type used for coordinates and weights
+   *  \tparam  dim         dimension of the reference element
+   *  \tparam  topologyId  topology id of the reference element
+   *  \tparam  p           requested order of the rule
+   */
+  template< class ct, int dim, unsigned int topologyId, int p >
+  class StaticQuadratureRule
+  {
+    static_assert( dim >= 1, "StaticQuadratureRule: dimension must be positive" );
+    static_assert( std::is_floating_point< ct >::value,
+                   "StaticQuadratureRule: the tables are only accurate to double, ct must be a floating point type" );
+    static_assert( (dim == 1) || (topologyId == 0u) || (topologyId == (1u << dim) - 1u),
+                   "StaticQuadratureRule is only available for cubes and simplices" );
+
+    typedef Impl::StaticQuadrature< ct, dim, topologyId, p > Quadrature;
+
+  public:
+    //! The space dimension
+    enum { d = dim };
+
+    //! The type used for coordinates
+    typedef ct CoordType;
+
+    //! The type of the quadrature points
+    typedef StaticQuadraturePoint< ct, dim > QuadraturePoint;
+
+    //! The type of the container of quadrature points
+    typedef std::array< QuadraturePoint, Quadrature::size > Points;
+
+    typedef typename Points::const_iterator iterator;
+
+    //! the points of the rule
+    static constexpr Points points
+      = Impl::staticQuadraturePoints< ct, dim, Quadrature >( std::make_index_sequence< Quadrature::size >() );
+
+    //! return the order actually delivered by the rule (at least p)
+    static constexpr int order () { return Quadrature::order; }
+
+    //! return type of element
+    static constexpr GeometryType type () { return GeometryType( topologyId, dim ); }
+
+    //! return number of quadrature points
+    static constexpr std::size_t size () { return Quadrature::size; }
+
+    //! return the i-th quadrature point
+    constexpr const QuadraturePoint &operator[] ( std::size_t i ) const { return points[ i ]; }
+
+    iterator begin () const { return points.begin(); }
+    iterator end () const { return points.end(); }
+  };
+
+  template< class ct, int dim, unsigned int topologyId, int p >
+  constexpr typename StaticQuadratureRule< ct, dim, topologyId, p >::Points StaticQuadratureRule< ct, dim, topologyId, p >::points;
+
+} // namespace Dune
+
+#endif // #ifndef DUNE_GEOMETRY_QUADRATURERULES_STATICQUADRATURERULE_HH
@@ -145,13 +145,31 @@ namespace Dune
       unsigned order = QuadratureRules<ctype,dim-1>::maxOrder(baseType, qt);
       if (isPrism)
         order = std::min
-          (order, QuadratureRules<ctype,1>::maxOrder(GeometryTypes::line, qt));
+          (order, maxTabulatedOrder1D(qt));
       else
         order = std::min
-          (order, QuadratureRules<ctype,1>::maxOrder(GeometryTypes::line, qt)-(dim-1));
+          (order, maxTabulatedOrder1D(qt)-(dim-1));
       return order;
     }
 
+    // The products only advertise the orders of the tabulated one-dimensional
+    // rules; the generated higher orders are available for lines only.
+    static unsigned maxTabulatedOrder1D(QuadratureType::Enum qt)
+    {
+      switch (qt) {
+      case QuadratureType::GaussLegendre :
+        return GaussQuadratureRule1D<ctype>::highest_tabulated_order;
+      case QuadratureType::GaussJacobi_1_0 :
+        return Jacobi1QuadratureRule1D<ctype>::highest_tabulated_order;
+      case QuadratureType::GaussJacobi_2_0 :
+        return Jacobi2QuadratureRule1D<ctype>::highest_tabulated_order;
+      case QuadratureType::GaussLobatto :
+        return GaussLobattoQuadratureRule1D<ctype>::highest_tabulated_order;
+      default :
+        DUNE_THROW(Exception, "Unknown QuadratureType");
+      }
+    }
+
   };
 
 }
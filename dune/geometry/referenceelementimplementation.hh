@@ -59,7 +59,31 @@ namespace Dune
       using Dune::Impl::numTopologies;
 
       /** \brief Compute the number of subentities of a given codimension */
-      unsigned int size ( unsigned int topologyId, int dim, int codim );
+      inline constexpr unsigned int size ( unsigned int topologyId, int dim, int codim )
+      {
+        assert( (dim >= 0) && (topologyId < numTopologies( dim )) );
+        assert( (0 <= codim) && (codim <= dim) );
+
+        if( codim > 0 )
+          {
+            const unsigned int baseId = baseTopologyId( topologyId, dim );
+            const unsigned int m = size( baseId, dim-1, codim-1 );
+
+            if( isPrism( topologyId, dim ) )
+              {
+                const unsigned int n = (codim < dim ? size( baseId, dim-1, codim ) : 0);
+                return n + 2*m;
+              }
+            else
+              {
+                assert( isPyramid( topologyId, dim ) );
+                const unsigned int n = (codim < dim ? size( baseId, dim-1, codim ) : 1);
+                return m+n;
+              }
+          }
+        else
+          return 1;
+      }
 
 
 
@@ -70,15 +94,124 @@ namespace Dune
        * \param codim Codimension of the subentity that we are interested in
        * \param i Number of the subentity that we are interested in
        */
-      unsigned int subTopologyId ( unsigned int topologyId, int dim, int codim, unsigned int i );
+      inline constexpr unsigned int subTopologyId ( unsigned int topologyId, int dim, int codim, unsigned int i )
+      {
+        assert( i < size( topologyId, dim, codim ) );
+        const int mydim = dim - codim;
+
+        if( codim > 0 )
+          {
+            const unsigned int baseId = baseTopologyId( topologyId, dim );
+            const unsigned int m = size( baseId, dim-1, codim-1 );
+
+            if( isPrism( topologyId, dim ) )
+              {
+                const unsigned int n = (codim < dim ? size( baseId, dim-1, codim ) : 0);
+                if( i < n )
+                  return subTopologyId( baseId, dim-1, codim, i ) | ((unsigned int)prismConstruction << (mydim - 1));
+                else
+                  return subTopologyId( baseId, dim-1, codim-1, (i < n+m ? i-n : i-(n+m)) );
+              }
+            else
+              {
+                assert( isPyramid( topologyId, dim ) );
+                if( i < m )
+                  return subTopologyId( baseId, dim-1, codim-1, i );
+                else if( codim < dim )
+                  return subTopologyId( baseId, dim-1, codim, i-m ) | ((unsigned int)pyramidConstruction << (mydim - 1));
+                else
+                  return 0u;
+              }
+          }
+        else
+          return topologyId;
+      }
 
 
 
       // subTopologyNumbering
       // --------------------
 
-      void subTopologyNumbering ( unsigned int topologyId, int dim, int codim, unsigned int i, int subcodim,
-                                  unsigned int *beginOut, unsigned int *endOut );
+      inline constexpr void subTopologyNumbering ( unsigned int topologyId, int dim, int codim, unsigned int i, int subcodim,
+                                  unsigned int *beginOut, unsigned int *endOut )
+      {
+        assert( (codim >= 0) && (subcodim >= 0) && (codim + subcodim <= dim) );
+        assert( i < size( topologyId, dim, codim ) );
+        assert( (endOut - beginOut) == size( subTopologyId( topologyId, dim, codim, i ), dim-codim, subcodim ) );
+
+        if( codim == 0 )
+          {
+            for( unsigned int j = 0; (beginOut + j) != endOut; ++j )
+              *(beginOut + j) = j;
+          }
+        else if( subcodim == 0 )
+          {
+            assert( endOut == beginOut + 1 );
+            *beginOut = i;
+          }
+        else
+          {
+            const unsigned int baseId = baseTopologyId( topologyId, dim );
+
+            const unsigned int m = size( baseId, dim-1, codim-1 );
+
+            const unsigned int mb = size( baseId, dim-1, codim+subcodim-1 );
+            const unsigned int nb = (codim + subcodim < dim ? size( baseId, dim-1, codim+subcodim ) : 0);
+
+            if( isPrism( topologyId, dim ) )
+              {
+                const unsigned int n = size( baseId, dim-1, codim );
+                if( i < n )
+                  {
+                    const unsigned int subId = subTopologyId( baseId, dim-1, codim, i );
+
+                    unsigned int *beginBase = beginOut;
+                    if( codim + subcodim < dim )
+                      {
+                        beginBase = beginOut + size( subId, dim-codim-1, subcodim );
+                        subTopologyNumbering( baseId, dim-1, codim, i, subcodim, beginOut, beginBase );
+                      }
+
+                    const unsigned int ms = size( subId, dim-codim-1, subcodim-1 );
+                    subTopologyNumbering( baseId, dim-1, codim, i, subcodim-1, beginBase, beginBase+ms );
+                    for( unsigned int j = 0; j < ms; ++j )
+                      {
+                        *(beginBase+j) += nb;
+                        *(beginBase+j+ms) = *(beginBase+j) + mb;
+                      }
+                  }
+                else
+                  {
+                    const unsigned int s = (i < n+m ? 0 : 1);
+                    subTopologyNumbering( baseId, dim-1, codim-1, i-(n+s*m), subcodim, beginOut, endOut );
+                    for( unsigned int *it = beginOut; it != endOut; ++it )
+                      *it += nb + s*mb;
+                  }
+              }
+            else
+              {
+                assert( isPyramid( topologyId, dim ) );
+
+                if( i < m )
+                  subTopologyNumbering( baseId, dim-1, codim-1, i, subcodim, beginOut, endOut );
+                else
+                  {
+                    const unsigned int subId = subTopologyId( baseId, dim-1, codim, i-m );
+                    const unsigned int ms = size( subId, dim-codim-1, subcodim-1 );
+
+                    subTopologyNumbering( baseId, dim-1, codim, i-m, subcodim-1, beginOut, beginOut+ms );
+                    if( codim+subcodim < dim )
+                      {
+                        subTopologyNumbering( baseId, dim-1, codim, i-m, subcodim, beginOut+ms, endOut );
+                        for( unsigned int *it = beginOut + ms; it != endOut; ++it )
+                          *it += mb;
+                      }
+                    else
+                      *(beginOut + ms) = mb;
+                  }
+              }
+          }
+      }
 
 
 
@@ -148,7 +281,18 @@ namespace Dune
       // referenceVolume
       // ---------------
 
-      unsigned long referenceVolumeInverse ( unsigned int topologyId, int dim );
+      inline constexpr unsigned long referenceVolumeInverse ( unsigned int topologyId, int dim )
+      {
+        assert( (dim >= 0) && (topologyId < numTopologies( dim )) );
+
+        if( dim > 0 )
+          {
+            unsigned int baseValue = referenceVolumeInverse( baseTopologyId( topologyId, dim ), dim-1 );
+            return (isPrism( topologyId, dim ) ? baseValue : baseValue * (unsigned long)dim);
+          }
+        else
+          return 1;
+      }
 
       template< class ct >
       inline ct referenceVolume ( unsigned int topologyId, int dim )
@@ -419,7 +563,7 @@ namespace Dune
       int size ( int c ) const
       {
         assert( (c >= 0) && (c <= dim) );
-        return info_[ c ].size();
+        return codimOffset_[ c+1 ] - codimOffset_[ c ];
       }
 
       /** \brief number of subentities of codimension cc of subentity (i,c)
@@ -436,7 +580,7 @@ namespace Dune
       int size ( int i, int c, int cc ) const
       {
         assert( (i >= 0) && (i < size( c )) );
-        return info_[ c ][ i ].size( cc );
+        return info( i, c ).size( cc );
       }
 
       /** \brief obtain number of ii-th subentity with codim cc of (i,c)
@@ -455,7 +599,7 @@ namespace Dune
       int subEntity ( int i, int c, int ii, int cc ) const
       {
         assert( (i >= 0) && (i < size( c )) );
-        return info_[ c ][ i ].number( ii, cc );
+        return numbering_[ info( i, c ).offset( ii, cc ) ];
       }
 
       /** \brief Obtain the range of numbers of subentities with codim cc of (i,c)
@@ -476,7 +620,7 @@ namespace Dune
       auto subEntities ( int i, int c, int cc ) const
       {
         assert( (i >= 0) && (i < size( c )) );
-        return info_[ c ][ i ].numbers( cc );
+        return info( i, c ).numbers( numbering_.data(), cc );
       }
 
       /** \brief obtain the type of subentity (i,c)
@@ -490,7 +634,7 @@ namespace Dune
       const GeometryType &type ( int i, int c ) const
       {
         assert( (i >= 0) && (i < size( c )) );
-        return info_[ c ][ i ].type();
+        return info( i, c ).type();
       }
 
       /** \brief obtain the type of this reference element */
@@ -565,13 +709,16 @@ namespace Dune
       {
         assert( topologyId < Impl::numTopologies( dim ) );
 
-        // set up subentities
+        // set up subentities, storing all numberings in one contiguous array
+        codimOffset_[ 0 ] = 0;
+        for( int codim = 0; codim <= dim; ++codim )
+          codimOffset_[ codim+1 ] = codimOffset_[ codim ] + Impl::size( topologyId, dim, codim );
+        info_.resize( codimOffset_[ dim+1 ] );
+        numbering_.clear();
         for( int codim = 0; codim <= dim; ++codim )
           {
-            const unsigned int size = Impl::size( topologyId, dim, codim );
-            info_[ codim ].resize( size );
-            for( unsigned int i = 0; i < size; ++i )
-              info_[ codim ][ i ].initialize( topologyId, codim, i );
+            for( int i = 0; i < size( codim ); ++i )
+              info_[ codimOffset_[ codim ] + i ].initialize( topologyId, codim, i, numbering_ );
           }
 
         // compute corners
@@ -623,7 +770,19 @@ namespace Dune
       /** \brief Stores all subentities of all codimensions */
       GeometryTable geometries_;
 
-      std::vector< SubEntityInfo > info_[ dim+1 ];
+      const SubEntityInfo &info ( int i, int c ) const
+      {
+        return info_[ codimOffset_[ c ] + i ];
+      }
+
+      /** \brief offsets of the subentities of each codimension into info_ */
+      std::array< unsigned int, dim+2 > codimOffset_;
+
+      /** \brief subentities of all codimensions, ordered by codimension */
+      std::vector< SubEntityInfo > info_;
+
+      /** \brief numberings of the sub-subentities of all subentities */
+      std::vector< unsigned int > numbering_;
     };
 
     /** \brief topological information about the subentities of a reference element */
@@ -683,91 +842,56 @@ namespace Dune
 
       using NumberRange = typename Dune::IteratorRange<const unsigned int*>;
 
-      SubEntityInfo ()
-        : numbering_( nullptr )
-      {
-        std::fill( offset_.begin(), offset_.end(), 0 );
-      }
-
-      SubEntityInfo ( const SubEntityInfo &other )
-        : offset_( other.offset_ ),
-          type_( other.type_ ),
-          containsSubentity_( other.containsSubentity_ )
-      {
-        numbering_ = allocate();
-        std::copy( other.numbering_, other.numbering_ + capacity(), numbering_ );
-      }
-
-      ~SubEntityInfo () { deallocate( numbering_ ); }
-
-      const SubEntityInfo &operator= ( const SubEntityInfo &other )
-      {
-        type_ = other.type_;
-        offset_ = other.offset_;
-
-        deallocate( numbering_ );
-        numbering_ = allocate();
-        std::copy( other.numbering_, other.numbering_ + capacity(), numbering_ );
-
-        containsSubentity_ = other.containsSubentity_;
-
-        return *this;
-      }
-
       int size ( int cc ) const
       {
         assert( (cc >= 0) && (cc <= dim) );
         return (offset_[ cc+1 ] - offset_[ cc ]);
       }
 
-      int number ( int ii, int cc ) const
+      //! position of the number of sub-subentity (ii,cc) in the numbering array
+      unsigned int offset ( int ii, int cc ) const
       {
         assert( (ii >= 0) && (ii < size( cc )) );
-        return numbering_[ offset_[ cc ] + ii ];
+        return offset_[ cc ] + ii;
       }
 
-      auto numbers ( int cc ) const
+      auto numbers ( const unsigned int *numbering, int cc ) const
       {
-        return SubEntityRange( numbering_ + offset_[ cc ], numbering_ + offset_[ cc+1 ], containsSubentity_[cc]);
+        return SubEntityRange( numbering + offset_[ cc ], numbering + offset_[ cc+1 ], containsSubentity_[cc]);
       }
 
       const GeometryType &type () const { return type_; }
 
-      void initialize ( unsigned int topologyId, int codim, unsigned int i )
+      void initialize ( unsigned int topologyId, int codim, unsigned int i, std::vector< unsigned int > &numbering )
       {
         const unsigned int subId = Impl::subTopologyId( topologyId, dim, codim, i );
         type_ = GeometryType( subId, dim-codim );
 
-        // compute offsets
+        // compute offsets, relative to the end of the numbering array
+        const unsigned int first = numbering.size();
         for( int cc = 0; cc <= codim; ++cc )
-          offset_[ cc ] = 0;
+          offset_[ cc ] = first;
         for( int cc = codim; cc <= dim; ++cc )
           offset_[ cc+1 ] = offset_[ cc ] + Impl::size( subId, dim-codim, cc-codim );
 
         // compute subnumbering
-        deallocate( numbering_ );
-        numbering_ = allocate();
+        numbering.resize( offset_[ dim+1 ] );
         for( int cc = codim; cc <= dim; ++cc )
-          Impl::subTopologyNumbering( topologyId, dim, codim, i, cc-codim, numbering_+offset_[ cc ], numbering_+offset_[ cc+1 ] );
+          Impl::subTopologyNumbering( topologyId, dim, codim, i, cc-codim, numbering.data()+offset_[ cc ], numbering.data()+offset_[ cc+1 ] );
 
         // initialize containsSubentity lookup-table
         for(std::size_t cc=0; cc<= dim; ++cc)
         {
           containsSubentity_[cc].reset();
-          for(std::size_t i=0; i<std::size_t(size(cc)); ++i)
-            containsSubentity_[cc][number(i,cc)] = true;
+          for(std::size_t j=offset_[ cc ]; j<offset_[ cc+1 ]; ++j)
+            containsSubentity_[cc][numbering[j]] = true;
         }
       }
 
     protected:
       int codim () const { return dim - type().dim(); }
 
-      unsigned int *allocate () { return (capacity() != 0 ? new unsigned int[ capacity() ] : nullptr); }
-      void deallocate ( unsigned int *ptr ) { delete[] ptr; }
-      unsigned int capacity () const { return offset_[ dim+1 ]; }
-
     private:
-      unsigned int *numbering_;
       std::array< unsigned int, dim+2 > offset_;
       GeometryType type_;
       std::array< SubEntityFlags, dim+1> containsSubentity_;
@@ -278,6 +278,68 @@ namespace Dune
     {
       return RefinementImp::eEnd(tag.intervals());
     }
+
+    /*!
+     * \brief Write the coordinates of all vertices into an array
+     *
+     * \param tag    RefinementIntervals object returned by either refinementIntervals() or refinementLevels()
+     * \param coords Array of at least nVertices(tag) entries; coords[i] receives the
+     *               coordinates of the vertex with index i
+     */
+    static void fillVertices(Dune::RefinementIntervals tag, CoordVector *coords)
+    {
+      RefinementImp::fillVertices(tag.intervals(), coords);
+    }
+    /*!
+     * \brief Write the vertex indices of all elements into an array
+     *
+     * \param tag          RefinementIntervals object returned by either refinementIntervals() or refinementLevels()
+     * \param connectivity Array of at least nElements(tag)*IndexVector::dimension entries;
+     *                     the vertex indices of the element with index i are stored
+     *                     starting at connectivity[i*IndexVector::dimension]
+     */
+    static void fillConnectivity(Dune::RefinementIntervals tag, int *connectivity)
+    {
+      RefinementImp::fillConnectivity(tag.intervals(), connectivity);
+    }
+
+    /*!
+     * \brief Get the number of vertices without duplicates
+     *
+     * Only provided by the triangulations of prisms and pyramids, whose
+     * vertices shared by several Kuhn simplices are counted only once.
+     *
+     * \param tag RefinementIntervals object returned by either refinementIntervals() or refinementLevels()
+     */
+    static int nConformingVertices(Dune::RefinementIntervals tag)
+    {
+      return RefinementImp::nConformingVertices(tag.intervals());
+    }
+    /*!
+     * \brief Write the coordinates of all vertices without duplicates into an array
+     *
+     * \param tag    RefinementIntervals object returned by either refinementIntervals() or refinementLevels()
+     * \param coords Array of at least nConformingVertices(tag) entries
+     *
+     * \sa nConformingVertices()
+     */
+    static void fillConformingVertices(Dune::RefinementIntervals tag, CoordVector *coords)
+    {
+      RefinementImp::fillConformingVertices(tag.intervals(), coords);
+    }
+    /*!
+     * \brief Write the vertex indices of all elements in the numbering without duplicates
+     *
+     * \param tag          RefinementIntervals object returned by either refinementIntervals() or refinementLevels()
+     * \param connectivity Array of at least nElements(tag)*IndexVector::dimension entries;
+     *                     the indices refer to the array of fillConformingVertices()
+     *
+     * \sa nConformingVertices()
+     */
+    static void fillConformingConnectivity(Dune::RefinementIntervals tag, int *connectivity)
+    {
+      RefinementImp::fillConformingConnectivity(tag.intervals(), connectivity);
+    }
   };
 
   /*! \} */
@@ -37,6 +37,7 @@
  * name RefinementSubEntityIteratorSpecial.
  */
 
+#include <array>
 #include <cassert>
 
 #include <dune/common/fvector.hh>
@@ -91,6 +92,9 @@ namespace Dune
         static unsigned nElements(unsigned nIntervals);
         static ElementIterator eBegin(unsigned nIntervals);
         static ElementIterator eEnd(unsigned nIntervals);
+
+        static void fillVertices(unsigned nIntervals, CoordVector *coords);
+        static void fillConnectivity(unsigned nIntervals, int *connectivity);
       };
 
       template<int dimension, class CoordType>
@@ -153,6 +157,60 @@ namespace Dune
         return ElementIterator(nElements(nIntervals),nIntervals);
       }
 
+      template<int dimension, class CoordType>
+      void
+      RefinementImp<dimension, CoordType>::
+      fillVertices(unsigned nIntervals, CoordVector *coords)
+      {
+        // run through the vertex index tuples in lexicographic order
+        std::array<unsigned int, dimension> v;
+        v.fill(0u);
+        const unsigned int n = nVertices(nIntervals);
+        for (unsigned int i = 0; i < n; ++i)
+        {
+          for (int d = 0; d < dimension; ++d)
+            coords[i][d] = v[d]*1.0 / nIntervals;
+          for (int d = 0; (d < dimension) && (++v[d] > nIntervals); ++d)
+            v[d] = 0;
+        }
+      }
+
+      template<int dimension, class CoordType>
+      void
+      RefinementImp<dimension, CoordType>::
+      fillConnectivity(unsigned nIntervals, int *connectivity)
+      {
+        enum { nIndices = (1 << dimension) };
+
+        // offsets of the cell corners relative to the first corner
+        std::array<int, nIndices> offset;
+        offset.fill(0);
+        for (int i = 0; i < nIndices; ++i)
+        {
+          int base = 1;
+          for (int d = 0; d < dimension; ++d)
+          {
+            offset[i] += ((i >> d) & 1) * base;
+            base *= nIntervals+1;
+          }
+        }
+
+        // run through the cell index tuples in lexicographic order
+        std::array<unsigned int, dimension> e;
+        e.fill(0u);
+        const unsigned int n = nElements(nIntervals);
+        for (unsigned int i = 0; i < n; ++i)
+        {
+          int first = 0;
+          for (int d = dimension-1; d >= 0; --d)
+            first = first * (nIntervals+1) + e[d];
+          for (int j = 0; j < nIndices; ++j)
+            connectivity[i*nIndices + j] = first + offset[j];
+          for (int d = 0; (d < dimension) && (++e[d] >= nIntervals); ++d)
+            e[d] = 0;
+        }
+      }
+
       //
       // The iterators
       //
@@ -82,6 +82,9 @@ namespace Dune
         static int nElements(int nIntervals);
         static ElementIterator eBegin(int nIntervals);
         static ElementIterator eEnd(int nIntervals);
+
+        static void fillVertices(int nIntervals, CoordVector *coords);
+        static void fillConnectivity(int nIntervals, int *connectivity);
       private:
         friend class RefinementIteratorSpecial<dimension, CoordType, 0>;
         friend class RefinementIteratorSpecial<dimension, CoordType, dimension>;
@@ -145,6 +148,26 @@ namespace Dune
         return ElementIterator(nIntervals, true);
       }
 
+      template<int dimension, class CoordType>
+      void
+      RefinementImp<dimension, CoordType>::
+      fillVertices(int nIntervals, CoordVector *coords)
+      {
+        const int nKuhnSimplices = Factorial<dimension>::factorial;
+        Simplex::fillKuhnVertices(nKuhnSimplices, nIntervals, coords,
+                                  [] (int k) { return k; },
+                                  [] (const CoordVector &point) { return point; });
+      }
+
+      template<int dimension, class CoordType>
+      void
+      RefinementImp<dimension, CoordType>::
+      fillConnectivity(int nIntervals, int *connectivity)
+      {
+        const int nKuhnSimplices = Factorial<dimension>::factorial;
+        Simplex::fillKuhnConnectivity<dimension, CoordType>(nKuhnSimplices, nIntervals, connectivity);
+      }
+
       // //////////////
       //
       // The iterator
@@ -3,6 +3,9 @@
 #ifndef DUNE_GEOMETRY_REFINEMENT_PRISMTRIANGULATION_CC
 #define DUNE_GEOMETRY_REFINEMENT_PRISMTRIANGULATION_CC
 
+#include <cmath>
+#include <vector>
+
 #include <dune/common/fvector.hh>
 #include <dune/common/typetraits.hh>
 
@@ -59,6 +62,9 @@ namespace Dune
        *
        * Note that the virtual vertices of two intersecting simplices might have copies, i.e.
        * by running over all vertices using the VertexIterator you might run over some twice.
+       *
+       * The conforming variants number every vertex only once, see
+       * Simplex::fillConformingKuhnConnectivity().
        */
       template<int dimension_, class CoordType>
       class RefinementImp
@@ -83,6 +89,14 @@ namespace Dune
         static ElementIterator eBegin(int nIntervals);
         static ElementIterator eEnd(int nIntervals);
 
+        static void fillVertices(int nIntervals, CoordVector *coords);
+        static void fillConnectivity(int nIntervals, int *connectivity);
+
+        static int nConformingVertices(int nIntervals);
+        static int conformingIndex(int nIntervals, const CoordVector &coords);
+        static void fillConformingVertices(int nIntervals, CoordVector *coords);
+        static void fillConformingConnectivity(int nIntervals, int *connectivity);
+
       private:
         friend class RefinementIteratorSpecial<dimension, CoordType, 0>;
         friend class RefinementIteratorSpecial<dimension, CoordType, dimension>;
@@ -146,6 +160,74 @@ namespace Dune
         return ElementIterator(nIntervals, true);
       }
 
+      template<int dimension, class CoordType>
+      void
+      RefinementImp<dimension, CoordType>::
+      fillVertices(int nIntervals, CoordVector *coords)
+      {
+        const int nKuhnSimplices = 3;
+        // while k runs from 0,1,2 the actual permutations we need are 0,2,3
+        Simplex::fillKuhnVertices(nKuhnSimplices, nIntervals, coords,
+                                  [] (int k) { return (k + 2) % 4; },
+                                  transformCoordinate<dimension, CoordType>);
+      }
+
+      template<int dimension, class CoordType>
+      void
+      RefinementImp<dimension, CoordType>::
+      fillConnectivity(int nIntervals, int *connectivity)
+      {
+        const int nKuhnSimplices = 3;
+        Simplex::fillKuhnConnectivity<dimension, CoordType>(nKuhnSimplices, nIntervals, connectivity);
+      }
+
+      template<int dimension, class CoordType>
+      int
+      RefinementImp<dimension, CoordType>::
+      nConformingVertices(int nIntervals)
+      {
+        // the lattice points of the refined triangle in each of the nIntervals+1 layers
+        return (nIntervals+1)*(nIntervals+2)/2 * (nIntervals+1);
+      }
+
+      template<int dimension, class CoordType>
+      int
+      RefinementImp<dimension, CoordType>::
+      conformingIndex(int nIntervals, const CoordVector &coords)
+      {
+        const int i = static_cast<int>(std::lround(coords[0]*nIntervals));
+        const int j = static_cast<int>(std::lround(coords[1]*nIntervals));
+        const int k = static_cast<int>(std::lround(coords[2]*nIntervals));
+        // row j of a layer holds the nIntervals+1-j points with i <= nIntervals-j
+        const int nLayerVertices = (nIntervals+1)*(nIntervals+2)/2;
+        return k*nLayerVertices + j*(nIntervals+1) - j*(j-1)/2 + i;
+      }
+
+      template<int dimension, class CoordType>
+      void
+      RefinementImp<dimension, CoordType>::
+      fillConformingVertices(int nIntervals, CoordVector *coords)
+      {
+        // enumerate the lattice in the order of conformingIndex()
+        for (int k = 0; k <= nIntervals; ++k)
+          for (int j = 0; j <= nIntervals; ++j)
+            for (int i = 0; i + j <= nIntervals; ++i)
+            {
+              (*coords)[0] = CoordType(i) / nIntervals;
+              (*coords)[1] = CoordType(j) / nIntervals;
+              (*coords)[2] = CoordType(k) / nIntervals;
+              ++coords;
+            }
+      }
+
+      template<int dimension, class CoordType>
+      void
+      RefinementImp<dimension, CoordType>::
+      fillConformingConnectivity(int nIntervals, int *connectivity)
+      {
+        Simplex::fillConformingKuhnConnectivity<RefinementImp>(nIntervals, connectivity);
+      }
+
       // //////////////
       //
       // The iterator
@@ -3,6 +3,9 @@
 #ifndef DUNE_GEOMETRY_REFINEMENT_PYRAMIDTRIANGULATION_CC
 #define DUNE_GEOMETRY_REFINEMENT_PYRAMIDTRIANGULATION_CC
 
+#include <cmath>
+#include <vector>
+
 #include <dune/common/fvector.hh>
 #include <dune/common/typetraits.hh>
 
@@ -60,6 +63,9 @@ namespace Dune
        *
        * Note that the virtual vertices of two intersecting simplices might have copies, i.e.
        * by running over all vertices using the VertexIterator you might run over some twice.
+       *
+       * The conforming variants number every vertex only once, see
+       * Simplex::fillConformingKuhnConnectivity().
        */
       template<int dimension_, class CoordType>
       class RefinementImp
@@ -84,6 +90,14 @@ namespace Dune
         static ElementIterator eBegin(int nIntervals);
         static ElementIterator eEnd(int nIntervals);
 
+        static void fillVertices(int nIntervals, CoordVector *coords);
+        static void fillConnectivity(int nIntervals, int *connectivity);
+
+        static int nConformingVertices(int nIntervals);
+        static int conformingIndex(int nIntervals, const CoordVector &coords);
+        static void fillConformingVertices(int nIntervals, CoordVector *coords);
+        static void fillConformingConnectivity(int nIntervals, int *connectivity);
+
       private:
         friend class RefinementIteratorSpecial<dimension, CoordType, 0>;
         friend class RefinementIteratorSpecial<dimension, CoordType, dimension>;
@@ -149,6 +163,72 @@ namespace Dune
         return ElementIterator(nIntervals, true);
       }
 
+      template<int dimension, class CoordType>
+      void
+      RefinementImp<dimension, CoordType>::
+      fillVertices(int nIntervals, CoordVector *coords)
+      {
+        Simplex::fillKuhnVertices(nKuhnSimplices, nIntervals, coords,
+                                  [] (int k) { return k; },
+                                  transformCoordinate<dimension, CoordType>);
+      }
+
+      template<int dimension, class CoordType>
+      void
+      RefinementImp<dimension, CoordType>::
+      fillConnectivity(int nIntervals, int *connectivity)
+      {
+        Simplex::fillKuhnConnectivity<dimension, CoordType>(nKuhnSimplices, nIntervals, connectivity);
+      }
+
+      template<int dimension, class CoordType>
+      int
+      RefinementImp<dimension, CoordType>::
+      nConformingVertices(int nIntervals)
+      {
+        // layer k of the lattice is a square with nIntervals+1-k points per side
+        return (nIntervals+1)*(nIntervals+2)*(2*nIntervals+3)/6;
+      }
+
+      template<int dimension, class CoordType>
+      int
+      RefinementImp<dimension, CoordType>::
+      conformingIndex(int nIntervals, const CoordVector &coords)
+      {
+        const int i = static_cast<int>(std::lround(coords[0]*nIntervals));
+        const int j = static_cast<int>(std::lround(coords[1]*nIntervals));
+        const int k = static_cast<int>(std::lround(coords[2]*nIntervals));
+        // the layers below k hold (nIntervals+1)^2 + ... + (nIntervals+2-k)^2 points
+        const int m = nIntervals+1-k;
+        const int below = nConformingVertices(nIntervals) - m*(m+1)*(2*m+1)/6;
+        return below + j*m + i;
+      }
+
+      template<int dimension, class CoordType>
+      void
+      RefinementImp<dimension, CoordType>::
+      fillConformingVertices(int nIntervals, CoordVector *coords)
+      {
+        // enumerate the lattice in the order of conformingIndex()
+        for (int k = 0; k <= nIntervals; ++k)
+          for (int j = 0; j + k <= nIntervals; ++j)
+            for (int i = 0; i + k <= nIntervals; ++i)
+            {
+              (*coords)[0] = CoordType(i) / nIntervals;
+              (*coords)[1] = CoordType(j) / nIntervals;
+              (*coords)[2] = CoordType(k) / nIntervals;
+              ++coords;
+            }
+      }
+
+      template<int dimension, class CoordType>
+      void
+      RefinementImp<dimension, CoordType>::
+      fillConformingConnectivity(int nIntervals, int *connectivity)
+      {
+        Simplex::fillConformingKuhnConnectivity<RefinementImp>(nIntervals, connectivity);
+      }
+
       // //////////////
       //
       // The iterator
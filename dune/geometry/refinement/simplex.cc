@@ -247,8 +247,14 @@
  */
 
 #include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
 
 #include <dune/common/fvector.hh>
+#include <dune/common/iteratorfacades.hh>
 #include <dune/common/power.hh>
 
 #include <dune/geometry/multilineargeometry.hh>
@@ -411,6 +417,73 @@ namespace Dune {
       }
 
 
+      /*! @brief Kuhn simplices of a cube of the Kuhn0 grid which lie
+                 within the Kuhn0 simplex
+
+         Whether the Kuhn simplex with a given origin lies within the Kuhn0
+         simplex only depends on which consecutive coordinates of the
+         origin coincide: if origin[i-1] == origin[i], the direction i-1
+         has to come before the direction i in the permutation.  We encode
+         this in a tie pattern with bit i-1 set iff origin[i-1] ==
+         origin[i], and tabulate the valid Kuhn indices for each pattern in
+         increasing order.
+       */
+      template<int dimension>
+      class KuhnSimplexTable
+      {
+      public:
+        enum { nPatterns = (dimension > 1) ? (1 << (dimension-1)) : 1 };
+        enum { nKuhnSimplices = Factorial<dimension>::factorial };
+
+        static const KuhnSimplexTable &instance()
+        {
+          static const KuhnSimplexTable table;
+          return table;
+        }
+
+        //! tie pattern of an origin
+        static int pattern(const FieldVector<int, dimension> &origin)
+        {
+          int pattern = 0;
+          for(int i = 1; i < dimension; ++i)
+            if(origin[i] == origin[i-1])
+              pattern |= (1 << (i-1));
+          return pattern;
+        }
+
+        //! number of valid Kuhn simplices for a tie pattern
+        int size(int pattern) const { return size_[pattern]; }
+
+        //! Kuhn index of the valid Kuhn simplex with the given rank
+        int kuhnIndex(int pattern, int rank) const { return kuhnIndex_[pattern][rank]; }
+
+      private:
+        KuhnSimplexTable()
+        {
+          for(int pattern = 0; pattern < nPatterns; ++pattern)
+          {
+            size_[pattern] = 0;
+            for(int k = 0; k < nKuhnSimplices; ++k)
+            {
+              FieldVector<int, dimension> perm = getPermutation<dimension>(k);
+              std::array<int, dimension> position;
+              for(int i = 0; i < dimension; ++i)
+                position[perm[i]] = i;
+
+              bool valid = true;
+              for(int i = 1; i < dimension; ++i)
+                if(((pattern >> (i-1)) & 1) && (position[i] < position[i-1]))
+                  valid = false;
+              if(valid)
+                kuhnIndex_[pattern][size_[pattern]++] = k;
+            }
+          }
+        }
+
+        int size_[nPatterns];
+        int kuhnIndex_[nPatterns][nKuhnSimplices];
+      };
+
       //@} <!-- Group utilities -->
 
       // /////////////////////////////////////////
@@ -439,6 +512,9 @@ namespace Dune {
         static int nElements(int nIntervals);
         static ElementIterator eBegin(int nIntervals);
         static ElementIterator eEnd(int nIntervals);
+
+        static void fillVertices(int nIntervals, CoordVector *coords);
+        static void fillConnectivity(int nIntervals, int *connectivity);
       };
 
       template<int dimension, class CoordType>
@@ -498,6 +574,108 @@ namespace Dune {
         return ElementIterator(nIntervals, true);
       }
 
+      template<int dimension, class CoordType>
+      void
+      RefinementImp<dimension, CoordType>::
+      fillVertices(int nIntervals, CoordVector *coords)
+      {
+        const VertexIterator end = vEnd(nIntervals);
+        for (VertexIterator it = vBegin(nIntervals); it != end; ++it)
+          coords[it.index()] = it.coords();
+      }
+
+      template<int dimension, class CoordType>
+      void
+      RefinementImp<dimension, CoordType>::
+      fillConnectivity(int nIntervals, int *connectivity)
+      {
+        const ElementIterator end = eEnd(nIntervals);
+        for (ElementIterator it = eBegin(nIntervals); it != end; ++it)
+        {
+          const IndexVector indices = it.vertexIndices();
+          std::copy(indices.begin(), indices.end(), connectivity + it.index()*(dimension+1));
+        }
+      }
+
+      /*! @brief Fill the vertices of a refinement made of refined Kuhn simplices
+
+         The vertices of the k-th Kuhn simplex form the k-th block of
+         RefinementImp::nVertices(nIntervals) vertices.  The reference
+         simplex is refined only once, into the block of the last Kuhn
+         simplex, and mapped into all Kuhn simplices from there.
+
+         @tparam dimension   Dimension of the simplices
+         @tparam CoordType   The C++ type of the coordinates
+         @tparam Permutation Callable mapping the number k of a Kuhn simplex to
+                             the index of its permutation, see getPermutation()
+         @tparam Transform   Callable mapping a point of the Kuhn simplices to
+                             the refined element
+       */
+      template<int dimension, class CoordType, class Permutation, class Transform>
+      void fillKuhnVertices(int nKuhnSimplices, int nIntervals, FieldVector<CoordType, dimension> *coords,
+                            Permutation permutation, Transform transform)
+      {
+        typedef RefinementImp<dimension, CoordType> BackendRefinement;
+        const int nBackendVertices = BackendRefinement::nVertices(nIntervals);
+        const int last = (nKuhnSimplices-1) * nBackendVertices;
+        BackendRefinement::fillVertices(nIntervals, coords + last);
+        for (int k = 0; k < nKuhnSimplices; ++k)
+        {
+          const FieldVector<int, dimension> perm = getPermutation<dimension>(permutation(k));
+          for (int i = 0; i < nBackendVertices; ++i)
+            coords[k*nBackendVertices + i] = transform(referenceToKuhn(coords[last + i], perm));
+        }
+      }
+
+      /*! @brief Fill the connectivity of a refinement made of refined Kuhn simplices
+
+         The Kuhn simplices share the connectivity of the refined reference
+         simplex up to the offset of their vertex block, see
+         fillKuhnVertices().
+
+         @tparam dimension Dimension of the simplices
+         @tparam CoordType The C++ type of the coordinates
+       */
+      template<int dimension, class CoordType>
+      void fillKuhnConnectivity(int nKuhnSimplices, int nIntervals, int *connectivity)
+      {
+        typedef RefinementImp<dimension, CoordType> BackendRefinement;
+        const int nBackendVertices = BackendRefinement::nVertices(nIntervals);
+        const int nBackendIndices = BackendRefinement::nElements(nIntervals) * (dimension+1);
+        BackendRefinement::fillConnectivity(nIntervals, connectivity);
+        for (int k = 1; k < nKuhnSimplices; ++k)
+          for (int i = 0; i < nBackendIndices; ++i)
+            connectivity[k*nBackendIndices + i] = connectivity[i] + k*nBackendVertices;
+      }
+
+      /*! @brief Fill the connectivity of a refinement made of refined Kuhn
+                 simplices, numbering every vertex only once
+
+         The vertex blocks of the Kuhn simplices, see fillKuhnVertices(),
+         contain copies of the vertices on the faces the Kuhn simplices
+         share.  All refined vertices are points of the lattice with spacing
+         1/nIntervals, so the vertices are renumbered by their lattice
+         index Refinement::conformingIndex().  This index enumerates the
+         Refinement::nConformingVertices() distinct vertices in the order of
+         Refinement::fillConformingVertices().
+
+         @tparam Refinement The refinement into Kuhn simplices
+       */
+      template<class Refinement>
+      void fillConformingKuhnConnectivity(int nIntervals, int *connectivity)
+      {
+        std::vector<typename Refinement::CoordVector> coords(Refinement::nVertices(nIntervals));
+        Refinement::fillVertices(nIntervals, coords.data());
+        std::vector<int> conforming(coords.size());
+        for (std::size_t i = 0; i < coords.size(); ++i)
+          conforming[i] = Refinement::conformingIndex(nIntervals, coords[i]);
+
+        const int nIndices = Refinement::nElements(nIntervals) * (Refinement::dimension+1);
+        Refinement::fillConnectivity(nIntervals, connectivity);
+        for (int i = 0; i < nIndices; ++i)
+          connectivity[i] = conforming[connectivity[i]];
+      }
+
       // //////////////
       //
       // The iterator
@@ -611,6 +789,9 @@ namespace Dune {
         RefinementIteratorSpecial(int nIntervals, bool end = false);
 
         void increment();
+        void decrement();
+        void advance(int n);
+        int distanceTo(const This &other) const;
         bool equals(const This &other) const;
 
         IndexVector vertexIndices() const;
@@ -621,13 +802,16 @@ namespace Dune {
 
       private:
         CoordVector global(const CoordVector &local) const;
+        void setIndex(int index);
 
       protected:
         typedef FieldVector<int, dimension> Vertex;
-        enum { nKuhnIntervals = Factorial<dimension>::factorial };
+        typedef KuhnSimplexTable<dimension> KuhnTable;
 
         Vertex origin;
         int kuhnIndex;
+        // position of kuhnIndex among the valid Kuhn simplices of origin
+        int kuhnRank;
         int size;
         int index_;
       };
@@ -635,7 +819,7 @@ namespace Dune {
       template<int dimension, class CoordType>
       RefinementIteratorSpecial<dimension, CoordType, 0>::
       RefinementIteratorSpecial(int nIntervals, bool end)
-        : kuhnIndex(0), size(nIntervals), index_(0)
+        : kuhnIndex(0), kuhnRank(0), size(nIntervals), index_(0)
       {
         for(int i = 0; i < dimension; ++i)
           origin[i] = 0;
@@ -654,36 +838,137 @@ namespace Dune {
 
         ++index_;
 
-        while(1) {
-          ++kuhnIndex;
-          if(kuhnIndex == nKuhnIntervals) {
-            kuhnIndex = 0;
-            // increment origin
-            for(int i = dimension - 1; i >= 0; --i) {
-              ++origin[i];
-              if(i == 0 || origin[i] <= origin[i-1])
-                break;
-              else
-                origin[i] = 0;
-            }
+        const KuhnTable &table = KuhnTable::instance();
+        if(++kuhnRank < table.size(KuhnTable::pattern(origin))) {
+          kuhnIndex = table.kuhnIndex(KuhnTable::pattern(origin), kuhnRank);
+          return;
+        }
+
+        // increment origin
+        for(int i = dimension - 1; i >= 0; --i) {
+          ++origin[i];
+          if(i == 0 || origin[i] <= origin[i-1])
+            break;
+          else
+            origin[i] = 0;
+        }
+        kuhnRank = 0;
+        kuhnIndex = table.kuhnIndex(KuhnTable::pattern(origin), kuhnRank);
+      }
+
+      template<int dimension, class CoordType>
+      void
+      RefinementIteratorSpecial<dimension, CoordType, 0>::
+      decrement()
+      {
+        assert(index_ > 0);
+
+        --index_;
+
+        const KuhnTable &table = KuhnTable::instance();
+        if(kuhnRank > 0) {
+          kuhnIndex = table.kuhnIndex(KuhnTable::pattern(origin), --kuhnRank);
+          return;
+        }
+
+        // decrement origin: lower the last nonzero coordinate and raise
+        // all following ones as far as possible
+        int i = dimension - 1;
+        while(i > 0 && origin[i] == 0)
+          --i;
+        --origin[i];
+        for(int j = i+1; j < dimension; ++j)
+          origin[j] = origin[i];
+        kuhnRank = table.size(KuhnTable::pattern(origin)) - 1;
+        kuhnIndex = table.kuhnIndex(KuhnTable::pattern(origin), kuhnRank);
+      }
+
+      template<int dimension, class CoordType>
+      void
+      RefinementIteratorSpecial<dimension, CoordType, 0>::
+      advance(int n)
+      {
+        setIndex(index_ + n);
+      }
+
+      template<int dimension, class CoordType>
+      int
+      RefinementIteratorSpecial<dimension, CoordType, 0>::
+      distanceTo(const This &other) const
+      {
+        assert(size == other.size);
+        return other.index_ - index_;
+      }
+
+      /*
+       * The elements are ordered lexicographically by their origin, and
+       * by Kuhn index for the same origin.  An origin has
+       * dimension!/(r_1! ... r_k!) valid Kuhn simplices, where r_1, ..., r_k
+       * are the lengths of the runs of equal coordinates.  Hence, if the
+       * first i coordinates of the origin are fixed, ending in a run of
+       * length t, the number of elements whose next coordinate is smaller
+       * than c is K*c^r with r = dimension-i and K = dimension!/(f*t!*r!),
+       * where f is the product of the factorials of the completed runs.
+       * This determines the origin coordinate by coordinate; the remainder
+       * is the rank among the valid Kuhn simplices of the origin.
+       */
+      template<int dimension, class CoordType>
+      void
+      RefinementIteratorSpecial<dimension, CoordType, 0>::
+      setIndex(int index)
+      {
+        assert(index >= 0 && index <= Refinement::nElements(size));
+
+        index_ = index;
+        kuhnRank = 0;
+        kuhnIndex = 0;
+        for(int i = 0; i < dimension; ++i)
+          origin[i] = 0;
+        if(index == Refinement::nElements(size)) {
+          origin[0] = size;
+          return;
+        }
+
+        int remainder = index;
+        int completed = 1; // product of the factorials of the completed runs
+        int run = 0;       // length of the current run of equal coordinates
+        int bound = size-1; // upper bound for the next coordinate
+        for(int i = 0; i < dimension; ++i) {
+          const int r = dimension - i;
+          const int K = factorial(dimension) / (completed * factorial(run) * factorial(r));
+
+          // find the largest c <= bound with K*c^r <= remainder
+          int lower = 0, upper = bound;
+          while(lower < upper) {
+            const int c = (lower + upper + 1) / 2;
+            int count = K;
+            for(int j = 0; j < r; ++j)
+              count *= c;
+            if(count <= remainder)
+              lower = c;
+            else
+              upper = c - 1;
           }
 
-          // test whether the current simplex has any corner outside the kuhn0 simplex
-          FieldVector<int, dimension> perm = getPermutation<dimension>(kuhnIndex);
-          Vertex corner = origin;
-          bool outside = false;
-          for(int i = 0; i < dimension; ++i) {
-            // next corner
-            ++corner[perm[i]];
-            if(perm[i] > 0)
-              if(corner[perm[i]] > corner[perm[i]-1]) {
-                outside = true;
-                break;
-              }
+          int count = K;
+          for(int j = 0; j < r; ++j)
+            count *= lower;
+          remainder -= count;
+
+          origin[i] = lower;
+          if(i > 0 && lower == bound)
+            ++run;
+          else {
+            completed *= factorial(run);
+            run = 1;
+            bound = lower;
           }
-          if(!outside)
-            return;
         }
+
+        const KuhnTable &table = KuhnTable::instance();
+        assert(remainder < table.size(KuhnTable::pattern(origin)));
+        kuhnRank = remainder;
+        kuhnIndex = table.kuhnIndex(KuhnTable::pattern(origin), kuhnRank);
       }
 
       template<int dimension, class CoordType>
@@ -758,10 +1043,13 @@ namespace Dune {
 
       // common
 
+      // The element iterator is random access, the vertex iterator is not
       template<int dimension, class CoordType>
       template<int codimension>
       class RefinementImp<dimension, CoordType>::Codim<codimension>::SubEntityIterator
-        : public ForwardIteratorFacade<typename RefinementImp<dimension, CoordType>::template Codim<codimension>::SubEntityIterator, int>,
+        : public std::conditional<codimension == 0,
+              RandomAccessIteratorFacade<typename RefinementImp<dimension, CoordType>::template Codim<codimension>::SubEntityIterator, int>,
+              ForwardIteratorFacade<typename RefinementImp<dimension, CoordType>::template Codim<codimension>::SubEntityIterator, int> >::type,
           public RefinementIteratorSpecial<dimension, CoordType, codimension>
       {
       public:
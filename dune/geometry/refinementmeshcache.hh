@@ -0,0 +1,300 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#ifndef DUNE_GEOMETRY_REFINEMENTMESHCACHE_HH
+#define DUNE_GEOMETRY_REFINEMENTMESHCACHE_HH
+
+/*!
+ * \file
+ *
+ * \brief A cache of refined reference elements
+ */
+
+#include <cassert>
+#include <cstddef>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <dune/common/fvector.hh>
+#include <dune/common/visibility.hh>
+
+#include <dune/geometry/multilineargeometry.hh>
+#include <dune/geometry/type.hh>
+#include <dune/geometry/typeindex.hh>
+#include <dune/geometry/virtualrefinement.hh>
+
+namespace Dune
+{
+  /*!
+   * \addtogroup VirtualRefinement
+   * \{
+   */
+
+  // RefinementMesh
+  // --------------
+
+  /*!
+   * \brief Immutable refinement of a reference element
+   *
+   * Holds everything the iterators of VirtualRefinement would compute for
+   * the given geometry type, coerceTo and RefinementIntervals: the
+   * coordinates of all vertices, the vertex indices of all elements and
+   * the geometries of all elements.  Vertices and elements are numbered
+   * as by the iterators.
+   *
+   * \tparam dimension The dimension of the element to refine
+   * \tparam CoordType The C++ type of the coordinates
+   */
+  template<int dimension, class CoordType>
+  class RefinementMesh
+  {
+  public:
+    //! The CoordVector of the refinement
+    typedef FieldVector<CoordType, dimension> CoordVector;
+    //! The type of the element geometries
+    typedef MultiLinearGeometry<CoordType, dimension, dimension> Geometry;
+
+    /*!
+     * \brief Refine a reference element
+     *
+     * \param type     The geometry type of the element to refine
+     * \param coerceTo The geometry type of the subelements
+     * \param tag      RefinementIntervals object returned by either
+     *                 refinementIntervals() or refinementLevels()
+     */
+    RefinementMesh(GeometryType type, GeometryType coerceTo, Dune::RefinementIntervals tag)
+      : type_(type), coerceTo_(coerceTo), intervals_(tag.intervals())
+    {
+      corners_ = buildRefinement<dimension, CoordType>(type, coerceTo).mesh(tag, vertices_, connectivity_);
+
+      std::vector<CoordVector> corners(corners_);
+      geometries_.reserve(nElements());
+      for(int e = 0; e < nElements(); ++e)
+      {
+        for(int c = 0; c < corners_; ++c)
+          corners[c] = vertices_[connectivity_[e*corners_ + c]];
+        geometries_.emplace_back(coerceTo, corners);
+      }
+    }
+
+    //! The geometry type of the refined element
+    GeometryType type() const { return type_; }
+    //! The geometry type of the subelements
+    GeometryType coerceTo() const { return coerceTo_; }
+    //! The number of intervals per axis
+    int intervals() const { return intervals_; }
+
+    //! Get the number of vertices
+    int nVertices() const { return vertices_.size(); }
+    //! Get the number of elements
+    int nElements() const { return connectivity_.size() / corners_; }
+    //! Get the number of corners per element
+    int corners() const { return corners_; }
+
+    //! Coordinates of vertex i
+    const CoordVector &vertex(int i) const
+    {
+      assert((i >= 0) && (i < nVertices()));
+      return vertices_[i];
+    }
+    //! Coordinates of all vertices, indexed by the vertex index
+    const std::vector<CoordVector> &vertices() const { return vertices_; }
+
+    //! Pointer to the corners() vertex indices of element e
+    const int *vertexIndices(int e) const
+    {
+      assert((e >= 0) && (e < nElements()));
+      return connectivity_.data() + e*corners_;
+    }
+    //! Vertex indices of all elements, see VirtualRefinement::mesh()
+    const std::vector<int> &connectivity() const { return connectivity_; }
+
+    //! Geometry of element e
+    const Geometry &geometry(int e) const
+    {
+      assert((e >= 0) && (e < nElements()));
+      return geometries_[e];
+    }
+
+    //! Approximate number of bytes held by this object
+    std::size_t memory() const
+    {
+      return sizeof(*this)
+             + vertices_.capacity()*sizeof(CoordVector)
+             + connectivity_.capacity()*sizeof(int)
+             + geometries_.capacity()*(sizeof(Geometry) + corners_*sizeof(CoordVector));
+    }
+
+  private:
+    GeometryType type_;
+    GeometryType coerceTo_;
+    int intervals_;
+    int corners_;
+    std::vector<CoordVector> vertices_;
+    std::vector<int> connectivity_;
+    std::vector<Geometry> geometries_;
+  };
+
+
+
+  // RefinementMeshCache
+  // -------------------
+
+  /*!
+   * \brief A thread-safe, memory-bounded cache of refined reference elements
+   *
+   * The meshes are keyed by the geometry type, coerceTo and the number of
+   * intervals.  They are handed out as shared pointers to immutable
+   * objects, so a mesh stays valid as long as it is used, even if the cache
+   * drops it in the meantime.  When the meshes held by the cache exceed
+   * capacity() bytes, the least recently used ones are dropped.
+   *
+   * \code
+   * auto mesh = RefinementMeshCache<3, double>::mesh(type, coerceTo, refinementLevels(4));
+   * for(int e = 0; e < mesh->nElements(); ++e)
+   *   output(mesh->geometry(e), mesh->vertexIndices(e));
+   * \endcode
+   *
+   * \tparam dimension The dimension of the element to refine
+   * \tparam CoordType The C++ type of the coordinates
+   */
+  template<int dimension, class CoordType>
+  class RefinementMeshCache
+  {
+  public:
+    //! The type of the cached meshes
+    typedef Dune::RefinementMesh<dimension, CoordType> RefinementMesh;
+    //! Shared pointer to a cached mesh
+    typedef std::shared_ptr<const RefinementMesh> MeshPointer;
+
+    //! Default capacity in bytes
+    static const std::size_t defaultCapacity = std::size_t(64) << 20;
+
+    /*!
+     * \brief Get the refinement of a reference element
+     *
+     * The mesh is created on first use, outside the lock, so threads
+     * creating different meshes do not wait for each other.
+     */
+    static MeshPointer mesh(GeometryType type, GeometryType coerceTo, Dune::RefinementIntervals tag)
+    {
+      return instance()._mesh(type, coerceTo, tag);
+    }
+
+    //! Maximal number of bytes held by the cache
+    static std::size_t capacity()
+    {
+      RefinementMeshCache &cache = instance();
+      std::lock_guard<std::mutex> guard(cache.mutex_);
+      return cache.capacity_;
+    }
+
+    //! Change the capacity, dropping meshes if necessary
+    static void setCapacity(std::size_t bytes)
+    {
+      RefinementMeshCache &cache = instance();
+      std::lock_guard<std::mutex> guard(cache.mutex_);
+      cache.capacity_ = bytes;
+      cache.shrink();
+    }
+
+    //! Number of bytes currently held by the cache
+    static std::size_t memory()
+    {
+      RefinementMeshCache &cache = instance();
+      std::lock_guard<std::mutex> guard(cache.mutex_);
+      return cache.memory_;
+    }
+
+    //! Drop all meshes
+    static void clear()
+    {
+      RefinementMeshCache &cache = instance();
+      std::lock_guard<std::mutex> guard(cache.mutex_);
+      cache.entries_.clear();
+      cache.index_.clear();
+      cache.memory_ = 0;
+    }
+
+  private:
+    typedef std::tuple<std::size_t, std::size_t, int> Key;
+    typedef std::pair<Key, MeshPointer> Entry;
+    typedef std::list<Entry> EntryList; // most recently used first
+
+    static Key key(GeometryType type, GeometryType coerceTo, Dune::RefinementIntervals tag)
+    {
+      return Key(LocalGeometryTypeIndex::index(type), LocalGeometryTypeIndex::index(coerceTo), tag.intervals());
+    }
+
+    MeshPointer _mesh(GeometryType type, GeometryType coerceTo, Dune::RefinementIntervals tag)
+    {
+      assert((type.dim() == dimension) && (coerceTo.dim() == dimension));
+
+      const Key k = key(type, coerceTo, tag);
+      {
+        std::lock_guard<std::mutex> guard(mutex_);
+        MeshPointer mesh = find(k);
+        if(mesh)
+          return mesh;
+      }
+
+      MeshPointer mesh = std::make_shared<const RefinementMesh>(type, coerceTo, tag);
+
+      std::lock_guard<std::mutex> guard(mutex_);
+      // another thread may have been faster
+      MeshPointer other = find(k);
+      if(other)
+        return other;
+
+      entries_.emplace_front(k, mesh);
+      index_.emplace(k, entries_.begin());
+      memory_ += mesh->memory();
+      shrink();
+      return mesh;
+    }
+
+    // look up a mesh and mark it as most recently used; the mutex has to be held
+    MeshPointer find(const Key &k)
+    {
+      auto it = index_.find(k);
+      if(it == index_.end())
+        return MeshPointer();
+      entries_.splice(entries_.begin(), entries_, it->second);
+      return it->second->second;
+    }
+
+    // drop the least recently used meshes until the capacity is met; the mutex has to be held
+    void shrink()
+    {
+      while((memory_ > capacity_) && !entries_.empty())
+      {
+        memory_ -= entries_.back().second->memory();
+        index_.erase(entries_.back().first);
+        entries_.pop_back();
+      }
+    }
+
+    DUNE_EXPORT static RefinementMeshCache &instance()
+    {
+      static RefinementMeshCache instance;
+      return instance;
+    }
+
+    RefinementMeshCache() : capacity_(defaultCapacity), memory_(0) {}
+
+    std::mutex mutex_;
+    std::size_t capacity_;
+    std::size_t memory_;
+    EntryList entries_;
+    std::map<Key, typename EntryList::iterator> index_;
+  };
+
+  /*! \} */
+
+} // namespace Dune
+
+#endif // DUNE_GEOMETRY_REFINEMENTMESHCACHE_HH
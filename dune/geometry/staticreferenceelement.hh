@@ -0,0 +1,292 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#ifndef DUNE_GEOMETRY_STATICREFERENCEELEMENT_HH
+#define DUNE_GEOMETRY_STATICREFERENCEELEMENT_HH
+
+#include <cassert>
+#include <limits>
+
+#include <dune/common/fvector.hh>
+
+#include <dune/geometry/referenceelementimplementation.hh>
+#include <dune/geometry/type.hh>
+
+namespace Dune
+{
+
+  namespace Geo
+  {
+
+    namespace Impl
+    {
+
+      // StaticReferenceElementTables
+      // ----------------------------
+
+      inline constexpr unsigned int staticPower ( unsigned int base, int exponent )
+      {
+        unsigned int result = 1;
+        for( int k = 0; k < exponent; ++k )
+          result *= base;
+        return result;
+      }
+
+      /** \brief compile-time tables of the reference element with a given topology
+       *
+       *  The layout coincides with the one of ReferenceElementImplementation:
+       *  the subentities are ordered by codimension and the numberings of all
+       *  their sub-subentities are stored in one array.
+       */
+      template< class ctype, int dim, unsigned int topologyId >
+      struct StaticReferenceElementTables
+      {
+        // upper bounds: sum_c binomial(dim,c) 2^c = 3^dim subentities,
+        // each with at most 3^(dim-c) sub-subentities
+        static constexpr unsigned int maxSubEntities = staticPower( 3, dim );
+        static constexpr unsigned int maxNumbering = staticPower( 5, dim );
+        static constexpr int rows = (dim > 0 ? dim : 1);
+
+        unsigned int codimOffset[ dim+2 ];
+        unsigned int offset[ maxSubEntities ][ dim+2 ];
+        unsigned int subTopologyId[ maxSubEntities ];
+        unsigned int numbering[ maxNumbering ];
+        ctype position[ maxSubEntities ][ rows ];
+        ctype normal[ 2*rows ][ rows ];
+        ctype volume;
+
+        constexpr StaticReferenceElementTables ()
+          : codimOffset{}, offset{}, subTopologyId{}, numbering{}, position{}, normal{}, volume( 0 )
+        {
+          static_assert( topologyId < Dune::Impl::numTopologies( dim ), "Invalid topology id." );
+
+          // subentities and their numberings
+          codimOffset[ 0 ] = 0;
+          for( int codim = 0; codim <= dim; ++codim )
+            codimOffset[ codim+1 ] = codimOffset[ codim ] + size( topologyId, dim, codim );
+
+          unsigned int next = 0;
+          for( int codim = 0; codim <= dim; ++codim )
+          {
+            for( unsigned int i = 0; i < codimOffset[ codim+1 ] - codimOffset[ codim ]; ++i )
+            {
+              const unsigned int k = codimOffset[ codim ] + i;
+              const unsigned int subId = Impl::subTopologyId( topologyId, dim, codim, i );
+              subTopologyId[ k ] = subId;
+              for( int cc = 0; cc <= codim; ++cc )
+                offset[ k ][ cc ] = next;
+              for( int cc = codim; cc <= dim; ++cc )
+                offset[ k ][ cc+1 ] = offset[ k ][ cc ] + size( subId, dim-codim, cc-codim );
+              for( int cc = codim; cc <= dim; ++cc )
+                subTopologyNumbering( topologyId, dim, codim, i, cc-codim, numbering + offset[ k ][ cc ], numbering + offset[ k ][ cc+1 ] );
+              next = offset[ k ][ dim+1 ];
+            }
+          }
+
+          // corners, built up along the construction of the topology
+          ctype (*corners)[ rows ] = position + codimOffset[ dim ];
+          unsigned int numCorners = 1;
+          for( int d = 1; d <= dim; ++d )
+          {
+            if( isPrism( baseTopologyId( topologyId, dim, dim-d ), d ) )
+            {
+              for( unsigned int j = 0; j < numCorners; ++j )
+              {
+                for( int l = 0; l < dim; ++l )
+                  corners[ numCorners+j ][ l ] = corners[ j ][ l ];
+                corners[ numCorners+j ][ d-1 ] = ctype( 1 );
+              }
+              numCorners *= 2;
+            }
+            else
+            {
+              corners[ numCorners ][ d-1 ] = ctype( 1 );
+              numCorners += 1;
+            }
+          }
+
+          // barycenters of the remaining subentities
+          for( unsigned int k = 0; k < codimOffset[ dim ]; ++k )
+          {
+            const unsigned int numSubCorners = offset[ k ][ dim+1 ] - offset[ k ][ dim ];
+            for( unsigned int j = 0; j < numSubCorners; ++j )
+              for( int l = 0; l < dim; ++l )
+                position[ k ][ l ] += corners[ numbering[ offset[ k ][ dim ] + j ] ][ l ];
+            for( int l = 0; l < dim; ++l )
+              position[ k ][ l ] /= ctype( numSubCorners );
+          }
+
+          volume = ctype( 1 ) / ctype( referenceVolumeInverse( topologyId, dim ) );
+
+          // integration outer normals; the origin of a face is its first corner
+          if( dim > 0 )
+            integrationOuterNormals( topologyId, dim, codimOffset[ 1 ], normal );
+        }
+
+      private:
+        constexpr unsigned int integrationOuterNormals ( unsigned int id, int d, unsigned int firstFace, ctype (*normals)[ rows ] )
+        {
+          if( d > 1 )
+          {
+            const unsigned int baseId = baseTopologyId( id, d );
+            if( isPrism( id, d ) )
+            {
+              const unsigned int numBaseFaces = integrationOuterNormals( baseId, d-1, firstFace, normals );
+              for( unsigned int i = 0; i < 2; ++i )
+              {
+                for( int l = 0; l < dim; ++l )
+                  normals[ numBaseFaces+i ][ l ] = ctype( 0 );
+                normals[ numBaseFaces+i ][ d-1 ] = ctype( 2*int( i )-1 );
+              }
+              return numBaseFaces+2;
+            }
+            else
+            {
+              for( int l = 0; l < dim; ++l )
+                normals[ 0 ][ l ] = ctype( 0 );
+              normals[ 0 ][ d-1 ] = ctype( -1 );
+
+              const unsigned int numBaseFaces = integrationOuterNormals( baseId, d-1, firstFace+1, normals+1 );
+              for( unsigned int i = 1; i <= numBaseFaces; ++i )
+              {
+                const ctype *origin = position[ codimOffset[ dim ] + numbering[ offset[ firstFace+i ][ dim ] ] ];
+                ctype dot( 0 );
+                for( int l = 0; l < dim; ++l )
+                  dot += normals[ i ][ l ] * origin[ l ];
+                normals[ i ][ d-1 ] = dot;
+              }
+              return numBaseFaces+1;
+            }
+          }
+          else
+          {
+            for( unsigned int i = 0; i < 2; ++i )
+            {
+              for( int l = 0; l < dim; ++l )
+                normals[ i ][ l ] = ctype( 0 );
+              normals[ i ][ 0 ] = ctype( 2*int( i )-1 );
+            }
+            return 2;
+          }
+        }
+      };
+
+    } // namespace Impl
+
+
+
+    // StaticReferenceElement
+    // ----------------------
+
+    /** \brief reference element for a topology known at compile time
+     *
+     *  This class provides the topological and geometric queries of the
+     *  reference elements (see ReferenceElementImplementation) for a topology
+     *  id given as template parameter.  All data are computed by the compiler,
+     *  so size(), subEntity(), type() and volume() are constant expressions,
+     *  and position() and integrationOuterNormal() read from constant tables.
+     *  When the arguments are known at compile time, too, the compiler can
+     *  eliminate the lookups altogether.
+     *
+     *  The coordinate type must be a literal type, e.g., double.  For a
+     *  GeometryType gt known at compile time, use
+     *  \code
+     *  StaticReferenceElement< double, gt.dim(), gt.id() >
+     *  \endcode
+     *
+     *  \tparam  ctype_      coordinate type
+     *  \tparam  dim         dimension of the reference element
+     *  \tparam  topologyId  topology id of the reference element
+     */
+    template< class ctype_, int dim, unsigned int topologyId >
+    class StaticReferenceElement
+    {
+      typedef Impl::StaticReferenceElementTables< ctype_, dim, topologyId > Tables;
+
+    public:
+      //! The coordinate field type.
+      using ctype = ctype_;
+
+      //! The coordinate type.
+      using Coordinate = Dune::FieldVector< ctype, dim >;
+
+      //! The dimension of the reference element.
+      static constexpr int dimension = dim;
+
+      /** \brief number of subentities of codimension c */
+      static constexpr int size ( int c )
+      {
+        assert( (c >= 0) && (c <= dim) );
+        return tables_.codimOffset[ c+1 ] - tables_.codimOffset[ c ];
+      }
+
+      /** \brief number of subentities of codimension cc of subentity (i,c) */
+      static constexpr int size ( int i, int c, int cc )
+      {
+        assert( (i >= 0) && (i < size( c )) );
+        assert( (cc >= 0) && (cc <= dim) );
+        return tables_.offset[ tables_.codimOffset[ c ] + i ][ cc+1 ] - tables_.offset[ tables_.codimOffset[ c ] + i ][ cc ];
+      }
+
+      /** \brief obtain number of ii-th subentity with codim cc of (i,c) */
+      static constexpr int subEntity ( int i, int c, int ii, int cc )
+      {
+        assert( (i >= 0) && (i < size( c )) );
+        assert( (ii >= 0) && (ii < size( i, c, cc )) );
+        return tables_.numbering[ tables_.offset[ tables_.codimOffset[ c ] + i ][ cc ] + ii ];
+      }
+
+      /** \brief obtain the type of subentity (i,c) */
+      static constexpr GeometryType type ( int i, int c )
+      {
+        assert( (i >= 0) && (i < size( c )) );
+        return GeometryType( tables_.subTopologyId[ tables_.codimOffset[ c ] + i ], dim-c );
+      }
+
+      /** \brief obtain the type of this reference element */
+      static constexpr GeometryType type () { return GeometryType( topologyId, dim ); }
+
+      /** \brief obtain the volume of the reference element */
+      static constexpr ctype volume () { return tables_.volume; }
+
+      /** \brief position of the barycenter of entity (i,c) */
+      static Coordinate position ( int i, int c )
+      {
+        assert( (i >= 0) && (i < size( c )) );
+        const ctype *x = tables_.position[ tables_.codimOffset[ c ] + i ];
+        Coordinate result;
+        for( int k = 0; k < dim; ++k )
+          result[ k ] = x[ k ];
+        return result;
+      }
+
+      /** \brief obtain the integration outer normal of the reference element */
+      static Coordinate integrationOuterNormal ( int face )
+      {
+        assert( (face >= 0) && (face < size( 1 )) );
+        Coordinate result;
+        for( int k = 0; k < dim; ++k )
+          result[ k ] = tables_.normal[ face ][ k ];
+        return result;
+      }
+
+      /** \brief check if a coordinate is in the reference element */
+      static bool checkInside ( const Coordinate &local )
+      {
+        const ctype tolerance = ctype( 64 ) * std::numeric_limits< ctype >::epsilon();
+        return Impl::template checkInside< ctype, dim >( topologyId, dim, local, tolerance );
+      }
+
+    private:
+      static constexpr Tables tables_ = Tables();
+    };
+
+    template< class ctype, int dim, unsigned int topologyId >
+    constexpr typename StaticReferenceElement< ctype, dim, topologyId >::Tables StaticReferenceElement< ctype, dim, topologyId >::tables_;
+
+  } // namespace Geo
+
+  using Geo::StaticReferenceElement;
+
+} // namespace Dune
+
+#endif // #ifndef DUNE_GEOMETRY_STATICREFERENCEELEMENT_HH
@@ -0,0 +1,95 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <dune/geometry/generalvertexorder.hh>
+#include <dune/geometry/referenceelements.hh>
+#include <dune/geometry/type.hh>
+
+bool success = true;
+
+// the quadratic definition of reduceOrder
+std::vector<std::size_t> referenceOrder(const std::vector<int>& ids)
+{
+  std::vector<std::size_t> order;
+  for (int id : ids)
+    order.push_back(std::count_if(ids.begin(), ids.end(), [&](int v) { return v < id; }));
+  return order;
+}
+
+void checkReduceOrder(std::mt19937& gen)
+{
+  // short and long ranges, with and without repeated ids
+  for (std::size_t n : {0, 1, 2, 3, 4, 5, 6, 8, 9, 27, 100})
+    for (int range : {3, 1000})
+    {
+      std::uniform_int_distribution<int> dist(0, range);
+      std::vector<int> ids(n);
+      for (int& id : ids)
+        id = dist(gen);
+
+      std::vector<std::size_t> order(n);
+      Dune::reduceOrder(ids.begin(), ids.end(), order.begin());
+      if (order != referenceOrder(ids))
+      {
+        std::cerr << "Error: reduceOrder of " << n << " ids differs from the definition" << std::endl;
+        success = false;
+      }
+    }
+}
+
+template<std::size_t dim>
+void checkGeneralVertexOrder(const Dune::GeometryType& gt, std::mt19937& gen)
+{
+  auto refElem = Dune::ReferenceElements<double, dim>::general(gt);
+
+  std::vector<int> ids(refElem.size(dim));
+  std::iota(ids.begin(), ids.end(), 0);
+  std::shuffle(ids.begin(), ids.end(), gen);
+
+  Dune::GeneralVertexOrder<dim, unsigned> vertexOrder(gt, ids.begin(), ids.end());
+
+  std::vector<unsigned> order;
+  for (int codim = 0; codim <= int(dim); ++codim)
+    for (int i = 0; i < refElem.size(codim); ++i)
+    {
+      std::vector<int> subIds;
+      for (int k = 0; k < refElem.size(i, codim, dim); ++k)
+        subIds.push_back(ids[refElem.subEntity(i, codim, k, dim)]);
+      const std::vector<std::size_t> expected = referenceOrder(subIds);
+
+      vertexOrder.getReduced(codim, i, order);
+      if (!std::equal(order.begin(), order.end(), expected.begin(), expected.end()))
+      {
+        std::cerr << "Error: reduced order of subentity " << i << " of codim " << codim
+                  << " of " << gt << " is wrong" << std::endl;
+        success = false;
+      }
+    }
+}
+
+int main()
+{
+  std::mt19937 gen(42);
+
+  checkReduceOrder(gen);
+
+  checkGeneralVertexOrder<1>(Dune::GeometryTypes::line, gen);
+  checkGeneralVertexOrder<2>(Dune::GeometryTypes::triangle, gen);
+  checkGeneralVertexOrder<2>(Dune::GeometryTypes::quadrilateral, gen);
+  checkGeneralVertexOrder<3>(Dune::GeometryTypes::tetrahedron, gen);
+  checkGeneralVertexOrder<3>(Dune::GeometryTypes::pyramid, gen);
+  checkGeneralVertexOrder<3>(Dune::GeometryTypes::prism, gen);
+  checkGeneralVertexOrder<3>(Dune::GeometryTypes::hexahedron, gen);
+
+  return success ? 0 : 1;
+}
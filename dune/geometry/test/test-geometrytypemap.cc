@@ -0,0 +1,87 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cstddef>
+#include <iostream>
+#include <unordered_map>
+
+#include <dune/common/exceptions.hh>
+
+#include <dune/geometry/geometrytypemap.hh>
+#include <dune/geometry/type.hh>
+#include <dune/geometry/typeindex.hh>
+
+bool success = true;
+
+void check(bool condition, const char* what)
+{
+  if (!condition)
+  {
+    std::cerr << "Error: " << what << std::endl;
+    success = false;
+  }
+}
+
+int main()
+{
+  const int maxdim = 4;
+
+  // the packed representation is constexpr and lossless
+  static_assert(Dune::GeometryType::fromPacked(Dune::GeometryTypes::prism.toPacked()) == Dune::GeometryTypes::prism,
+                "packing a prism has to be lossless");
+
+  std::hash<Dune::GeometryType> hash;
+  for (int dim = 0; dim <= maxdim; ++dim)
+    for (std::size_t i = 0; i < Dune::LocalGeometryTypeIndex::size(dim); ++i)
+    {
+      const Dune::GeometryType gt = Dune::LocalGeometryTypeIndex::type(dim, i);
+      const Dune::GeometryType unpacked = Dune::GeometryType::fromPacked(gt.toPacked());
+      check(unpacked == gt && unpacked.dim() == gt.dim() && unpacked.id() == gt.id(),
+            "packed geometry type does not unpack to itself");
+
+      // equal types have to hash equally, also if the ignored lowest bit of the id differs
+      if (!gt.isNone())
+        check(hash(gt) == hash(Dune::GeometryType(gt.id() | 1, dim)),
+              "equal geometry types hash differently");
+    }
+
+  // std::unordered_map works out of the box
+  std::unordered_map<Dune::GeometryType, int> unorderedMap;
+  unorderedMap[Dune::GeometryTypes::triangle] = 3;
+  unorderedMap[Dune::GeometryTypes::quadrilateral] = 4;
+  check(unorderedMap.at(Dune::GeometryTypes::simplex(2)) == 3, "std::unordered_map lookup failed");
+
+  // every geometry type up to maxdim gets its own slot in the flat map
+  Dune::GeometryTypeMap<int, maxdim> map;
+  check(map.empty() && map.find(Dune::GeometryTypes::tetrahedron) == nullptr, "new map is not empty");
+  for (int dim = 0; dim <= maxdim; ++dim)
+    for (std::size_t i = 0; i < Dune::LocalGeometryTypeIndex::size(dim); ++i)
+      map[Dune::LocalGeometryTypeIndex::type(dim, i)] = int(Dune::GlobalGeometryTypeIndex::index(Dune::LocalGeometryTypeIndex::type(dim, i)));
+  check(map.size() == map.capacity(), "map does not hold all geometry types");
+
+  std::size_t visited = 0;
+  map.forEach([&](const Dune::GeometryType& gt, int value) {
+      check(std::size_t(value) == Dune::GlobalGeometryTypeIndex::index(gt), "forEach passes the wrong type");
+      ++visited;
+    });
+  check(visited == map.size(), "forEach misses types");
+
+  check(map.erase(Dune::GeometryTypes::prism) == 1 && map.count(Dune::GeometryTypes::prism) == 0
+        && map.erase(Dune::GeometryTypes::prism) == 0, "erase failed");
+  bool caught = false;
+  try {
+    map.at(Dune::GeometryTypes::prism);
+  }
+  catch (const Dune::RangeError&) {
+    caught = true;
+  }
+  check(caught, "at() of a missing type does not throw");
+
+  map.clear();
+  check(map.empty() && map.count(Dune::GeometryTypes::hexahedron) == 0, "clear failed");
+
+  return success ? 0 : 1;
+}
@@ -2,7 +2,11 @@
 // vi: set et ts=4 sw=2 sts=2:
 #include <config.h>
 
+#include <cmath>
 #include <functional>
+#include <iostream>
+#include <limits>
+#include <utility>
 #include <vector>
 
 #include <dune/common/fvector.hh>
@@ -25,6 +29,42 @@ struct ReferenceWrapperGeometryTraits :
   };
 };
 
+template<class ct>
+struct EagerCachingGeometryTraits :
+  public ReferenceWrapperGeometryTraits<ct>
+{
+  static const bool eagerCaching = true;
+};
+
+template<class ct>
+struct CompactGeometryTraits :
+  public Dune::MultiLinearGeometryTraits<ct>
+{
+  static const bool eagerCaching = true;
+};
+
+// traits not deriving from MultiLinearGeometryTraits, without the optional members
+template<class ct>
+struct MinimalGeometryTraits
+{
+  typedef Dune::Impl::FieldMatrixHelper< ct > MatrixHelper;
+
+  static ct tolerance () { return ct( 16 ) * std::numeric_limits< ct >::epsilon(); }
+
+  template< int mydim, int cdim >
+  struct CornerStorage
+  {
+    typedef std::vector< Dune::FieldVector< ct, cdim > > Type;
+  };
+
+  template< int dim >
+  struct hasSingleGeometryType
+  {
+    static const bool v = false;
+    static const unsigned int topologyId = ~0u;
+  };
+};
+
 template< class ctype, int mydim, int cdim >
 static Dune::FieldVector< ctype, cdim >
 map ( const Dune::FieldMatrix< ctype, mydim, mydim > &A,
@@ -47,6 +87,154 @@ map ( const Dune::FieldMatrix< ctype, mydim, mydim > &A,
 }
 
 
+template< class Geometry >
+static bool checkBatchedEvaluation ( const Geometry &geometry,
+                                     const std::vector< typename Geometry::LocalCoordinate > &points )
+{
+  typedef typename Geometry::ctype ctype;
+  const ctype epsilon = ctype( 1e5 )*std::numeric_limits< ctype >::epsilon();
+
+  bool pass = true;
+
+  const std::size_t n = points.size();
+  std::vector< typename Geometry::GlobalCoordinate > y( n ), y2( n );
+  std::vector< typename Geometry::JacobianTransposed > jt( n ), jt2( n );
+  std::vector< ctype > mu( n ), mu2( n );
+  geometry.global( points, y.begin() );
+  geometry.jacobianTransposed( points, jt.begin() );
+  geometry.integrationElement( points, mu.begin() );
+  geometry.evaluate( points, y2.begin(), jt2.begin(), mu2.begin() );
+
+  for( std::size_t q = 0; q < n; ++q )
+  {
+    const auto yq = geometry.global( points[ q ] );
+    if( ((y[ q ] - yq).two_norm() > epsilon) || ((y2[ q ] - yq).two_norm() > epsilon) )
+    {
+      std::cerr << "Error: batched global differs at " << points[ q ] << " (" << y[ q ]
+                << ", should be " << yq << ")." << std::endl;
+      pass = false;
+    }
+
+    const typename Geometry::JacobianTransposed jtq = geometry.jacobianTransposed( points[ q ] );
+    for( int i = 0; i < Geometry::mydimension; ++i )
+    {
+      if( ((jt[ q ][ i ] - jtq[ i ]).two_norm() > epsilon) || ((jt2[ q ][ i ] - jtq[ i ]).two_norm() > epsilon) )
+      {
+        std::cerr << "Error: batched jacobianTransposed[ " << i << " ] differs at " << points[ q ]
+                  << " (" << jt[ q ][ i ] << ", should be " << jtq[ i ] << ")." << std::endl;
+        pass = false;
+      }
+    }
+
+    const ctype muq = geometry.integrationElement( points[ q ] );
+    if( (std::abs( mu[ q ] - muq ) > epsilon) || (std::abs( mu2[ q ] - muq ) > epsilon) )
+    {
+      std::cerr << "Error: batched integrationElement differs at " << points[ q ] << " (" << mu[ q ]
+                << ", should be " << muq << ")." << std::endl;
+      pass = false;
+    }
+  }
+
+  return pass;
+}
+
+template< class Geometry >
+static bool checkBatchedLocal ( const Geometry &geometry,
+                                const std::vector< typename Geometry::LocalCoordinate > &points )
+{
+  typedef typename Geometry::ctype ctype;
+  const ctype epsilon = ctype( 1e5 )*std::numeric_limits< ctype >::epsilon();
+
+  bool pass = true;
+
+  const std::size_t n = points.size();
+  std::vector< typename Geometry::GlobalCoordinate > y( n );
+  for( std::size_t q = 0; q < n; ++q )
+    y[ q ] = geometry.global( points[ q ] );
+  std::vector< typename Geometry::LocalCoordinate > x( n );
+  geometry.local( y, x.begin() );
+
+  for( std::size_t q = 0; q < n; ++q )
+  {
+    const auto xq = geometry.local( y[ q ] );
+    if( ((x[ q ] - xq).two_norm() > epsilon) || ((x[ q ] - points[ q ]).two_norm() > epsilon) )
+    {
+      std::cerr << "Error: batched local differs at " << y[ q ] << " (" << x[ q ]
+                << ", should be " << xq << ")." << std::endl;
+      pass = false;
+    }
+  }
+
+  return pass;
+}
+
+template< class Geometry, class RefElement >
+static bool checkContains ( const Geometry &geometry, const RefElement &refElement )
+{
+  typedef typename Geometry::ctype ctype;
+  typedef typename Geometry::LocalCoordinate LocalCoordinate;
+  const ctype epsilon = ctype( 1e5 )*std::numeric_limits< ctype >::epsilon();
+  const int mydim = Geometry::mydimension;
+
+  bool pass = true;
+  const LocalCoordinate &center = refElement.position( 0, 0 );
+  for( int c = 0; c < refElement.size( mydim ); ++c )
+  {
+    // a point half-way to the corner is inside, a point beyond the corner is outside
+    for( ctype t : { ctype( 0.5 ), ctype( 1 ), ctype( 1.5 ) } )
+    {
+      LocalCoordinate x = center;
+      x.axpy( t, refElement.position( c, mydim ) - center );
+      LocalCoordinate local( -1 );
+      const bool inside = geometry.contains( geometry.global( x ), local );
+      if( inside != ((t <= ctype( 1 )) || (mydim == 0)) )
+      {
+        std::cerr << "Error: contains( global( " << x << " ) ) returned " << inside << "." << std::endl;
+        pass = false;
+      }
+      if( inside && ((local - x).two_norm() > epsilon) )
+      {
+        std::cerr << "Error: contains( global( " << x << " ) ) returned wrong local coordinate "
+                  << local << "." << std::endl;
+        pass = false;
+      }
+    }
+  }
+  return pass;
+}
+
+template< class ctype, int mydim, int cdim, class Traits >
+static bool testBatchedEvaluation ( Dune::Transitional::ReferenceElement< ctype, Dune::Dim<mydim> > refElement,
+                                    const std::vector< Dune::FieldVector< ctype, cdim > > &corners,
+                                    const Traits &traits )
+{
+  // corners and some convex combinations of them, more than one batch
+  const int numCorners = refElement.size( mydim );
+  std::vector< Dune::FieldVector< ctype, mydim > > points;
+  for( int i = 0; i < numCorners; ++i )
+    points.push_back( refElement.position( i, mydim ) );
+  for( int k = 0; k < 37; ++k )
+  {
+    Dune::FieldVector< ctype, mydim > x( 0 );
+    ctype sum( 0 );
+    for( int i = 0; i < numCorners; ++i )
+    {
+      const ctype w( 1 + (k*(i+3)) % 7 );
+      x.axpy( w, refElement.position( i, mydim ) );
+      sum += w;
+    }
+    x /= sum;
+    points.push_back( x );
+  }
+
+  bool pass = true;
+  pass &= checkBatchedEvaluation( Dune::MultiLinearGeometry< ctype, mydim, cdim, Traits >( refElement, corners ), points );
+  pass &= checkBatchedEvaluation( Dune::CachedMultiLinearGeometry< ctype, mydim, cdim, Traits >( refElement, corners ), points );
+  pass &= checkBatchedLocal( Dune::MultiLinearGeometry< ctype, mydim, cdim, Traits >( refElement, corners ), points );
+  pass &= checkBatchedLocal( Dune::CachedMultiLinearGeometry< ctype, mydim, cdim, Traits >( refElement, corners ), points );
+  return pass;
+}
+
 template< class ctype, int mydim, int cdim, class Traits >
 static bool testMultiLinearGeometry ( Dune::Transitional::ReferenceElement< ctype, Dune::Dim<mydim> > refElement,
                                       const Dune::FieldMatrix< ctype, mydim, mydim > &A,
@@ -159,6 +347,26 @@ static bool testMultiLinearGeometry ( Dune::Transitional::ReferenceElement< ctyp
   }
 
   pass &= checkGeometry( geometry );
+  pass &= checkGeometry( Dune::CachedMultiLinearGeometry< ctype, mydim, cdim, Traits >( refElement, corners ) );
+  pass &= checkContains( geometry, refElement );
+  pass &= checkContains( Dune::CachedMultiLinearGeometry< ctype, mydim, cdim, Traits >( refElement, corners ), refElement );
+  pass &= checkContains( Dune::AffineGeometry< ctype, mydim, cdim >( refElement, corners[ 0 ], JT ), refElement );
+  {
+    std::vector< Dune::FieldVector< ctype, mydim > > points;
+    for( int c = 0; c < numCorners; ++c )
+      points.push_back( refElement.position( c, mydim ) );
+    points.push_back( localCenter );
+    pass &= checkBatchedLocal( Dune::AffineGeometry< ctype, mydim, cdim >( refElement, corners[ 0 ], JT ), points );
+  }
+
+  pass &= testBatchedEvaluation< ctype, mydim, cdim >( refElement, corners, traits );
+
+  // perturb the corners to obtain a non-affine geometry
+  for( int i = 0; i < numCorners; ++i )
+    for( int j = 0; j < cdim; ++j )
+      corners[ i ][ j ] += ctype( (3*i + j) % 5 ) / ctype( 20 );
+  pass &= testBatchedEvaluation< ctype, mydim, cdim >( refElement, corners, traits );
+  pass &= checkContains( Geometry( refElement, corners ), refElement );
 
   return pass;
 }
@@ -283,6 +491,163 @@ static bool testNonLinearGeometry(const Traits &traits)
     }
   }
 
+  /* Test tryLocal() */
+  {
+    const Vector global = geometry.global({0.25, 0.75});
+    const auto result = geometry.tryLocal(global);
+    if (!result.converged || !result.inside) {
+      std::cerr << "tryLocal failed inside reference element: converged = "
+                << result.converged << ", inside = " << result.inside << std::endl;
+      pass = false;
+    }
+  }
+  {
+    const auto result = geometry.tryLocal({-2, 0});
+    if (!result.converged || result.inside) {
+      std::cerr << "tryLocal failed outside reference element: converged = "
+                << result.converged << ", inside = " << result.inside << std::endl;
+      pass = false;
+    }
+  }
+
+  /* Test that local() terminates for points far outside a distorted element */
+  {
+    std::vector<Vector> distorted = {{0,0},
+                                     {1,0},
+                                     {0,1},
+                                     {-0.9,-0.9}};
+    const Geometry geometry2(reference, distorted);
+    for (const Vector &global : std::vector<Vector>{{1e6, -1e6}, {-3, 5}, {0.5, -20}}) {
+      const auto result = geometry2.tryLocal(global);
+      if (result.iterations > Dune::Impl::NewtonMaxIterations<ctype, Traits>::get() || result.inside) {
+        std::cerr << "tryLocal failed far outside distorted element: "
+                  << result.iterations << " iterations, inside = "
+                  << result.inside << std::endl;
+        pass = false;
+      }
+    }
+  }
+
+  std::cout << (pass ? "passed" : "failed") << std::endl;
+  return pass;
+}
+
+template< class Geometry, class CompactGeometry >
+static bool compareCompactStorage ( const Geometry &geometry, const CompactGeometry &compact, const char *name )
+{
+  typedef typename Geometry::ctype ctype;
+  const int mydim = Geometry::mydimension;
+  const ctype epsilon( ctype( 16 ) * std::numeric_limits< ctype >::epsilon() );
+  const auto refElement = Dune::referenceElement( geometry );
+
+  bool pass = true;
+  if( (compact.affine() != geometry.affine()) || (compact.type() != geometry.type()) || (compact.corners() != geometry.corners()) )
+  {
+    std::cerr << "Error: " << name << ": compact storage describes a different geometry." << std::endl;
+    pass = false;
+  }
+  if( std::abs( compact.volume() - geometry.volume() ) > epsilon )
+  {
+    std::cerr << "Error: " << name << ": compact storage has volume " << compact.volume()
+              << ", should be " << geometry.volume() << "." << std::endl;
+    pass = false;
+  }
+
+  std::vector< typename Geometry::LocalCoordinate > points;
+  for( int i = 0; i < refElement.size( mydim ); ++i )
+  {
+    points.push_back( refElement.position( i, mydim ) );
+    if( (compact.corner( i ) - geometry.corner( i )).two_norm() > epsilon )
+    {
+      std::cerr << "Error: " << name << ": compact storage has corner( " << i << " ) = "
+                << compact.corner( i ) << ", should be " << geometry.corner( i ) << "." << std::endl;
+      pass = false;
+    }
+  }
+  points.push_back( refElement.position( 0, 0 ) );
+
+  for( const auto &x : points )
+  {
+    const auto y = geometry.global( x );
+    if( (compact.global( x ) - y).two_norm() > epsilon )
+    {
+      std::cerr << "Error: " << name << ": compact storage has global( " << x << " ) = "
+                << compact.global( x ) << ", should be " << y << "." << std::endl;
+      pass = false;
+    }
+    if( (compact.local( y ) - geometry.local( y )).two_norm() > epsilon )
+    {
+      std::cerr << "Error: " << name << ": compact storage has local( " << y << " ) = "
+                << compact.local( y ) << ", should be " << geometry.local( y ) << "." << std::endl;
+      pass = false;
+    }
+    if( std::abs( compact.integrationElement( x ) - geometry.integrationElement( x ) ) > epsilon )
+    {
+      std::cerr << "Error: " << name << ": compact storage has integrationElement( " << x << " ) = "
+                << compact.integrationElement( x ) << ", should be " << geometry.integrationElement( x ) << "." << std::endl;
+      pass = false;
+    }
+    auto jt = compact.jacobianTransposed( x );
+    jt -= geometry.jacobianTransposed( x );
+    auto jit = compact.jacobianInverseTransposed( x );
+    jit -= geometry.jacobianInverseTransposed( x );
+    if( (jt.frobenius_norm() > epsilon) || (jit.frobenius_norm() > epsilon) )
+    {
+      std::cerr << "Error: " << name << ": compact storage has a different Jacobian in " << x << "." << std::endl;
+      pass = false;
+    }
+    if( compact.contains( y ) != geometry.contains( y ) )
+    {
+      std::cerr << "Error: " << name << ": compact storage has contains( " << y << " ) = "
+                << compact.contains( y ) << ", should be " << geometry.contains( y ) << "." << std::endl;
+      pass = false;
+    }
+  }
+  return pass;
+}
+
+template< class ctype >
+static bool testCompactStorage ()
+{
+  typedef Dune::FieldVector< ctype, 3 > Vector;
+  typedef Dune::CachedMultiLinearGeometry< ctype, 2, 3 > Geometry;
+  typedef Dune::CachedMultiLinearGeometry< ctype, 2, 3, EagerCachingGeometryTraits< ctype > > RefWrapGeometry;
+  typedef Dune::CachedMultiLinearGeometry< ctype, 2, 3, CompactGeometryTraits< ctype > > CompactGeometry;
+
+  bool pass = true;
+  std::cout << "Checking compact storage of CachedMultiLinearGeometry: ";
+
+  // the compact storage drops the corners of affine mappings, so it is
+  // smaller than the lazy one and independent of the corner storage
+  if( (sizeof( CompactGeometry ) >= sizeof( Geometry )) || (sizeof( RefWrapGeometry ) != sizeof( CompactGeometry )) )
+  {
+    std::cerr << "Error: sizeof compact CachedMultiLinearGeometry is " << sizeof( CompactGeometry )
+              << ", lazy one is " << sizeof( Geometry ) << "." << std::endl;
+    pass = false;
+  }
+
+  const std::vector< Vector > triangle = { { 1, 0, 0 }, { 2, 1, 0 }, { 1, 1, 1 } };
+  const std::vector< Vector > quadrilateral = { { 0, 0, 0 }, { 2, 0, 1 }, { 0, 1, 0 }, { 1, 1, 2 } };
+  const std::vector< Vector > parallelogram = { { 0, 0, 0 }, { 2, 0, 1 }, { 1, 1, 0 }, { 3, 1, 1 } };
+  for( const auto &element : { std::make_pair( Dune::GeometryTypes::triangle, triangle ),
+                               std::make_pair( Dune::GeometryTypes::quadrilateral, quadrilateral ),
+                               std::make_pair( Dune::GeometryTypes::quadrilateral, parallelogram ) } )
+  {
+    const Geometry geometry( element.first, element.second );
+    CompactGeometry compact( element.first, element.second );
+    pass &= compareCompactStorage( geometry, compact, "constructed" );
+
+    const CompactGeometry copy( compact );
+    pass &= compareCompactStorage( geometry, copy, "copied" );
+    CompactGeometry assigned( Dune::GeometryTypes::triangle, triangle );
+    assigned = copy;
+    pass &= compareCompactStorage( geometry, assigned, "assigned" );
+    const CompactGeometry moved( std::move( compact ) );
+    pass &= compareCompactStorage( geometry, moved, "moved" );
+    compact = moved;
+    pass &= compareCompactStorage( geometry, compact, "assigned after move" );
+  }
+
   std::cout << (pass ? "passed" : "failed") << std::endl;
   return pass;
 }
@@ -373,6 +738,17 @@ int main ( int argc, char **argv )
   pass &= testMultiLinearGeometry< double >
     ( ReferenceWrapperGeometryTraits< double >{} );
 
+  std::cout << ">>> Checking ctype = double with eager caching and "
+            << "reference_wrapped corner storage" << std::endl;
+  pass &= testMultiLinearGeometry< double >
+    ( EagerCachingGeometryTraits< double >{} );
+
+  std::cout << ">>> Checking ctype = double with minimal traits" << std::endl;
+  pass &= testMultiLinearGeometry< double >
+    ( MinimalGeometryTraits< double >{} );
+
+  pass &= testCompactStorage< double >();
+
   // std::cout << ">>> Checking ctype = float" << std::endl;
   // pass &= testMultiLinearGeometry< float >
   //   ( Dune::MultiLinearGeometryTraits< float >{} );
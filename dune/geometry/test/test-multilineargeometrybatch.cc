@@ -0,0 +1,129 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#include <config.h>
+
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <dune/common/fmatrix.hh>
+#include <dune/common/fvector.hh>
+
+#include <dune/geometry/multilineargeometry.hh>
+#include <dune/geometry/multilineargeometrybatch.hh>
+#include <dune/geometry/referenceelements.hh>
+#include <dune/geometry/type.hh>
+
+template< class ctype, int mydim, int cdim, int lanes >
+static bool testBatch ( const Dune::GeometryType &type )
+{
+  typedef Dune::MultiLinearGeometry< ctype, mydim, cdim > Geometry;
+  typedef Dune::MultiLinearGeometryBatch< ctype, mydim, cdim, lanes > Batch;
+
+  const ctype epsilon = ctype( 1e5 )*std::numeric_limits< ctype >::epsilon();
+  bool pass = true;
+
+  std::cout << "Checking geometry batch (type = " << type << ", cdim = " << cdim << ", lanes = " << lanes << "): ";
+
+  auto refElement = Dune::referenceElement< ctype, mydim >( type );
+  const int numCorners = refElement.size( mydim );
+
+  // scaled and perturbed copies of the reference element, one per lane
+  Batch batch( refElement );
+  std::vector< Geometry > geometries;
+  for( int l = 0; l < lanes; ++l )
+  {
+    std::vector< Dune::FieldVector< ctype, cdim > > corners( numCorners );
+    for( int c = 0; c < numCorners; ++c )
+    {
+      const auto &x = refElement.position( c, mydim );
+      for( int i = 0; i < cdim; ++i )
+        corners[ c ][ i ] = ctype( l+1 )*(i < mydim ? x[ i ] : ctype( 0 )) + ctype( (3*c + i + l) % 5 ) / ctype( 20 );
+    }
+    batch.setCorners( l, corners );
+    geometries.emplace_back( refElement, corners );
+  }
+
+  if( (batch.type() != type) || (batch.corners() != numCorners) )
+  {
+    std::cerr << "Error: wrong type or number of corners." << std::endl;
+    pass = false;
+  }
+
+  // evaluate in the corners and the barycenter of the reference element
+  std::vector< Dune::FieldVector< ctype, mydim > > points;
+  points.push_back( refElement.position( 0, 0 ) );
+  for( int c = 0; c < numCorners; ++c )
+    points.push_back( ctype( 0.5 )*(refElement.position( c, mydim ) + refElement.position( 0, 0 )) );
+
+  for( const auto &x : points )
+  {
+    const auto y = batch.global( x );
+    const auto jt = batch.jacobianTransposed( x );
+    const auto jit = batch.jacobianInverseTransposed( x );
+    const auto mu = batch.integrationElement( x );
+
+    for( int l = 0; l < lanes; ++l )
+    {
+      const Geometry &geometry = geometries[ l ];
+
+      const auto yl = geometry.global( x );
+      for( int i = 0; i < cdim; ++i )
+        if( std::abs( y[ i ][ l ] - yl[ i ] ) > epsilon )
+        {
+          std::cerr << "Error: global in lane " << l << " wrong at " << x << "." << std::endl;
+          pass = false;
+        }
+
+      const typename Geometry::JacobianTransposed jtl = geometry.jacobianTransposed( x );
+      for( int j = 0; j < mydim; ++j )
+        for( int i = 0; i < cdim; ++i )
+          if( std::abs( jt[ j ][ i ][ l ] - jtl[ j ][ i ] ) > epsilon )
+          {
+            std::cerr << "Error: jacobianTransposed in lane " << l << " wrong at " << x << "." << std::endl;
+            pass = false;
+          }
+
+      const typename Geometry::JacobianInverseTransposed jitl = geometry.jacobianInverseTransposed( x );
+      for( int i = 0; i < cdim; ++i )
+        for( int j = 0; j < mydim; ++j )
+          if( std::abs( jit[ i ][ j ][ l ] - jitl[ i ][ j ] ) > epsilon )
+          {
+            std::cerr << "Error: jacobianInverseTransposed in lane " << l << " wrong at " << x << "." << std::endl;
+            pass = false;
+          }
+
+      if( std::abs( mu[ l ] - geometry.integrationElement( x ) ) > epsilon )
+      {
+        std::cerr << "Error: integrationElement in lane " << l << " wrong at " << x << " (" << mu[ l ]
+                  << ", should be " << geometry.integrationElement( x ) << ")." << std::endl;
+        pass = false;
+      }
+    }
+  }
+
+  std::cout << (pass ? "passed" : "failed") << std::endl;
+  return pass;
+}
+
+int main ( int argc, char **argv )
+{
+  bool pass = true;
+
+  pass &= testBatch< double, 0, 1, 4 >( Dune::GeometryTypes::vertex );
+  pass &= testBatch< double, 1, 1, 4 >( Dune::GeometryTypes::line );
+  pass &= testBatch< double, 1, 2, 4 >( Dune::GeometryTypes::line );
+  pass &= testBatch< double, 2, 2, 4 >( Dune::GeometryTypes::triangle );
+  pass &= testBatch< double, 2, 2, 8 >( Dune::GeometryTypes::quadrilateral );
+  pass &= testBatch< double, 2, 3, 4 >( Dune::GeometryTypes::triangle );
+  pass &= testBatch< double, 2, 3, 4 >( Dune::GeometryTypes::quadrilateral );
+  pass &= testBatch< double, 3, 3, 4 >( Dune::GeometryTypes::tetrahedron );
+  pass &= testBatch< double, 3, 3, 4 >( Dune::GeometryTypes::pyramid );
+  pass &= testBatch< double, 3, 3, 4 >( Dune::GeometryTypes::prism );
+  pass &= testBatch< double, 3, 3, 8 >( Dune::GeometryTypes::hexahedron );
+  pass &= testBatch< double, 3, 4, 2 >( Dune::GeometryTypes::hexahedron );
+  pass &= testBatch< float, 2, 2, 8 >( Dune::GeometryTypes::quadrilateral );
+
+  return (pass ? 0 : 1);
+}
@@ -0,0 +1,156 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#include <config.h>
+
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <dune/common/fmatrix.hh>
+#include <dune/common/fvector.hh>
+
+#include <dune/geometry/multilineargeometry.hh>
+#include <dune/geometry/multilinearshapefunctiontable.hh>
+#include <dune/geometry/quadraturerules.hh>
+#include <dune/geometry/referenceelements.hh>
+#include <dune/geometry/type.hh>
+
+template< class ctype, int mydim, int cdim >
+static bool testTable ( const Dune::GeometryType &type, int p, Dune::QuadratureType::Enum qt )
+{
+  typedef Dune::MultiLinearGeometry< ctype, mydim, cdim > Geometry;
+  typedef Dune::MultiLinearShapeFunctionTable< ctype, mydim > Table;
+
+  const ctype epsilon = ctype( 1e3 )*std::numeric_limits< ctype >::epsilon();
+  bool pass = true;
+
+  const auto &rule = Dune::QuadratureRules< ctype, mydim >::rule( type, p, qt );
+  const Table &table = Dune::MultiLinearShapeFunctionTables< ctype, mydim >::table( type, p, qt );
+
+  if( &table != &Dune::MultiLinearShapeFunctionTables< ctype, mydim >::table( type, p, qt ) )
+  {
+    std::cerr << "Error: table for " << type << ", order " << p << " is not cached." << std::endl;
+    pass = false;
+  }
+
+  auto refElement = Dune::referenceElement< ctype, mydim >( type );
+  if( (table.size() != rule.size()) || (table.corners() != refElement.size( mydim )) )
+  {
+    std::cerr << "Error: table for " << type << ", order " << p << " has wrong size ("
+              << table.size() << " x " << table.corners() << ")." << std::endl;
+    return false;
+  }
+
+  // partition of unity
+  for( std::size_t q = 0; q < table.size(); ++q )
+  {
+    ctype sum( 0 );
+    Dune::FieldVector< ctype, mydim > dsum( 0 );
+    for( int c = 0; c < table.corners(); ++c )
+    {
+      sum += table.value( q, c );
+      for( int j = 0; j < mydim; ++j )
+        dsum[ j ] += table.derivative( q, j, c );
+    }
+    if( (std::abs( sum - ctype( 1 ) ) > epsilon) || (dsum.infinity_norm() > epsilon) )
+    {
+      std::cerr << "Error: shape functions for " << type << " do not form a partition of unity in "
+                << rule[ q ].position() << "." << std::endl;
+      pass = false;
+    }
+  }
+
+  // compare against a non-affine geometry
+  std::vector< Dune::FieldVector< ctype, cdim > > corners( table.corners() );
+  for( int c = 0; c < table.corners(); ++c )
+  {
+    const auto &x = refElement.position( c, mydim );
+    for( int i = 0; i < cdim; ++i )
+      corners[ c ][ i ] = (i < mydim ? x[ i ] : ctype( 0 )) + ctype( (3*c + i) % 5 ) / ctype( 20 );
+  }
+  const Geometry geometry( refElement, corners );
+
+  std::vector< typename Geometry::GlobalCoordinate > y( table.size() );
+  std::vector< typename Geometry::JacobianTransposed > jt( table.size() );
+  table.global( corners, y.begin() );
+  table.jacobianTransposed( corners, jt.begin() );
+  for( std::size_t q = 0; q < table.size(); ++q )
+  {
+    const auto &x = rule[ q ].position();
+    if( (y[ q ] - geometry.global( x )).two_norm() > epsilon )
+    {
+      std::cerr << "Error: tabulated global for " << type << " wrong in " << x << " (" << y[ q ]
+                << ", should be " << geometry.global( x ) << ")." << std::endl;
+      pass = false;
+    }
+    const typename Geometry::JacobianTransposed jtq = geometry.jacobianTransposed( x );
+    for( int j = 0; j < mydim; ++j )
+    {
+      if( (jt[ q ][ j ] - jtq[ j ]).two_norm() > epsilon )
+      {
+        std::cerr << "Error: tabulated jacobianTransposed[ " << j << " ] for " << type << " wrong in "
+                  << x << " (" << jt[ q ][ j ] << ", should be " << jtq[ j ] << ")." << std::endl;
+        pass = false;
+      }
+    }
+  }
+
+  return pass;
+}
+
+template< class ctype, int mydim, int cdim >
+static bool testTables ( const Dune::GeometryType &type )
+{
+  bool pass = true;
+  const int maxOrder = std::min( 6u, Dune::QuadratureRules< ctype, mydim >::maxOrder( type ) );
+  for( int p = 0; p <= maxOrder; ++p )
+    pass &= testTable< ctype, mydim, cdim >( type, p, Dune::QuadratureType::GaussLegendre );
+  return pass;
+}
+
+template< class ctype, int mydim >
+static bool testOutOfRange ( const Dune::GeometryType &type )
+{
+  typedef Dune::MultiLinearShapeFunctionTables< ctype, mydim > Tables;
+
+  bool pass = true;
+  const int maxOrder = Dune::QuadratureRules< ctype, mydim >::maxOrder( type );
+  for( int p : { -1, maxOrder+1 } )
+  {
+    try
+    {
+      Tables::table( type, p );
+      std::cerr << "Error: table for " << type << ", order " << p << " did not throw." << std::endl;
+      pass = false;
+    }
+    catch( const Dune::QuadratureOrderOutOfRange & )
+    {}
+  }
+  return pass;
+}
+
+int main ( int argc, char **argv )
+{
+  bool pass = true;
+
+  pass &= testTables< double, 0, 2 >( Dune::GeometryTypes::vertex );
+  pass &= testTables< double, 1, 1 >( Dune::GeometryTypes::line );
+  pass &= testTables< double, 1, 3 >( Dune::GeometryTypes::line );
+  pass &= testTables< double, 2, 2 >( Dune::GeometryTypes::triangle );
+  pass &= testTables< double, 2, 2 >( Dune::GeometryTypes::quadrilateral );
+  pass &= testTables< double, 2, 3 >( Dune::GeometryTypes::quadrilateral );
+  pass &= testTables< double, 3, 3 >( Dune::GeometryTypes::tetrahedron );
+  pass &= testTables< double, 3, 3 >( Dune::GeometryTypes::pyramid );
+  pass &= testTables< double, 3, 3 >( Dune::GeometryTypes::prism );
+  pass &= testTables< double, 3, 3 >( Dune::GeometryTypes::hexahedron );
+
+  pass &= testTable< double, 2, 2 >( Dune::GeometryTypes::quadrilateral, 3, Dune::QuadratureType::GaussLobatto );
+
+  pass &= testOutOfRange< double, 2 >( Dune::GeometryTypes::triangle );
+  pass &= testOutOfRange< double, 3 >( Dune::GeometryTypes::hexahedron );
+
+  return (pass ? 0 : 1);
+}
@@ -2,14 +2,20 @@
 // vi: set et ts=4 sw=2 sts=2:
 
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
 #include <limits>
 #include <iostream>
+#include <utility>
+#include <vector>
 
 #include <config.h>
 
 #include <dune/geometry/referenceelements.hh>
 #include <dune/geometry/quadraturerules.hh>
 #include <dune/geometry/quadraturerules/compositequadraturerule.hh>
+#include <dune/geometry/quadraturerules/staticquadraturerule.hh>
 #include <dune/geometry/refinement.hh>
 
 bool success = true;
@@ -155,6 +161,38 @@ void checkWeights(const QuadratureRule &quad)
   }
 }
 
+template<class QuadratureRule, class QuadratureRuleSoA>
+void checkSoA(const QuadratureRule &quad, const QuadratureRuleSoA &soa)
+{
+  const int dim = QuadratureRule::d;
+  const std::size_t alignment = QuadratureRuleSoA::alignment;
+  bool pass = (soa.size() == quad.size())
+              && (soa.paddedSize() >= soa.size())
+              && (soa.paddedSize() % QuadratureRuleSoA::blockSize == 0);
+  for (int k = 0; pass && (k < dim); ++k)
+  {
+    pass &= (reinterpret_cast<std::uintptr_t>(soa.position(k)) % alignment == 0);
+    for (std::size_t i = 0; i < soa.size(); ++i)
+      pass &= (soa.position(k)[i] == quad[i].position()[k]);
+    for (std::size_t i = soa.size(); i < soa.paddedSize(); ++i)
+      pass &= (soa.position(k)[i] == 0);
+  }
+  if (pass)
+  {
+    pass &= (reinterpret_cast<std::uintptr_t>(soa.weight()) % alignment == 0);
+    for (std::size_t i = 0; i < soa.size(); ++i)
+      pass &= (soa.weight()[i] == quad[i].weight());
+    for (std::size_t i = soa.size(); i < soa.paddedSize(); ++i)
+      pass &= (soa.weight()[i] == 0);
+  }
+  if (!pass)
+  {
+    std::cerr << "Error: Structure-of-arrays view of quadrature for " << quad.type()
+              << " and order=" << quad.order() << " does not match the rule" << std::endl;
+    success = false;
+  }
+}
+
 template<class ctype, int dim>
 void check(Dune::GeometryType type,
            unsigned int maxOrder,
@@ -175,6 +213,7 @@ void check(Dune::GeometryType type,
     }
     checkWeights(quad);
     checkQuadrature(quad);
+    checkSoA(quad, Dune::QuadratureRules<ctype,dim>::soa(type, p, qt));
   }
   if (dim>0 && (dim>3 || type.isCube() || type.isSimplex()))
   {
@@ -183,6 +222,339 @@ void check(Dune::GeometryType type,
   }
 }
 
+template<class ctype, int dim>
+void checkPrepopulate(int maxOrder,
+                      Dune::QuadratureType::Enum qt = Dune::QuadratureType::GaussLegendre)
+{
+  typedef Dune::QuadratureRules<ctype, dim> Rules;
+
+  Rules::prepopulate(maxOrder, qt);
+  for (std::size_t i = 0; i < Dune::LocalGeometryTypeIndex::size(dim); ++i)
+  {
+    const Dune::GeometryType type = Dune::LocalGeometryTypeIndex::type(dim, i);
+    if (type.isNone())
+      continue;
+    const int order = std::min(maxOrder, int(Rules::maxOrder(type, qt)));
+    for (int p = 0; p <= order; ++p)
+    {
+      const auto &quad = Rules::rule(type, p, qt);
+      if (&quad != &Rules::rule(type, p, qt) || quad.type() != type || quad.order() < p)
+      {
+        std::cerr << "Error: Prepopulated quadrature for " << type
+                  << " and order=" << p << " is not unique or wrong." << std::endl;
+        success = false;
+      }
+    }
+  }
+}
+
+// exact integral of the monomial x^alpha over the simplex, prism or pyramid
+template<class ctype, int dim>
+ctype monomialIntegral(const Dune::GeometryType &t, const std::array<int, dim> &alpha)
+{
+  // alpha_1! ... alpha_n! / (|alpha| + n)! over the n-dimensional simplex
+  auto simplexIntegral = [] (const int *a, int n) {
+    ctype exact = 1;
+    int m = 0;
+    for (int j = 0; j < n; ++j)
+      for (int k = 1; k <= a[j]; ++k)
+        exact *= ctype(k) / ctype(++m);
+    for (int k = 1; k <= n; ++k)
+      exact /= ctype(++m);
+    return exact;
+  };
+
+  if (t.isPrism())
+    return simplexIntegral(alpha.data(), 2) / ctype(alpha[2] + 1);
+
+  if (t.isPyramid())
+  {
+    // integrate (1-z)^(alpha_0+alpha_1+2) z^alpha_2 / ((alpha_0+1) (alpha_1+1)) over [0,1]
+    const std::array<int, 2> beta = {{ alpha[0] + alpha[1] + 2, alpha[2] }};
+    return simplexIntegral(beta.data(), 2) * ctype(beta[0] + beta[1] + 2)
+           / ctype((alpha[0] + 1) * (alpha[1] + 1));
+  }
+
+  return simplexIntegral(alpha.data(), dim);
+}
+
+// integrate all monomials up to the order of the rules of the given type
+template<class ctype, int dim>
+void checkMonomials(const Dune::GeometryType &t, int maxOrder)
+{
+  for (int p = 0; p <= maxOrder; ++p)
+  {
+    const Dune::QuadratureRule<ctype,dim> &quad = Dune::QuadratureRules<ctype,dim>::rule(t, p);
+    const int order = quad.order();
+
+    // all exponents alpha with |alpha| <= order
+    std::array<int, dim> alpha;
+    alpha.fill(0);
+    while (true)
+    {
+      const ctype exact = monomialIntegral<ctype,dim>(t, alpha);
+
+      ctype integral = 0;
+      for (const auto &qp : quad)
+      {
+        ctype value = qp.weight();
+        for (int j = 0; j < dim; ++j)
+          value *= std::pow(qp.position()[j], alpha[j]);
+        integral += value;
+      }
+      if (std::abs(integral - exact) > 1e-12*exact)
+      {
+        std::cerr << "Error: Quadrature for " << t << " and order=" << order
+                  << " fails to integrate the monomial with exponents";
+        for (int j = 0; j < dim; ++j)
+          std::cerr << " " << alpha[j];
+        std::cerr << " (relative error " << std::abs(integral - exact) / exact << ")" << std::endl;
+        success = false;
+        break;
+      }
+
+      // next exponent
+      int j = 0;
+      for (; j < dim; ++j)
+      {
+        ++alpha[j];
+        int sum = 0;
+        for (int k = 0; k < dim; ++k)
+          sum += alpha[k];
+        if (sum <= order)
+          break;
+        alpha[j] = 0;
+      }
+      if (j == dim)
+        break;
+    }
+  }
+}
+
+// compare the generated one-dimensional rules against the tabulated ones
+template<class ctype>
+void checkGeneratedRule(const std::vector< Dune::FieldVector<ctype,1> > &points,
+                        const std::vector< ctype > &weights,
+                        const Dune::QuadratureRule<ctype,1> &quad, int p)
+{
+  std::vector< std::pair<ctype, ctype> > generated, tabulated;
+  for (std::size_t i = 0; i < points.size(); ++i)
+    generated.emplace_back(points[i][0], weights[i]);
+  for (const auto &qp : quad)
+    tabulated.emplace_back(qp.position()[0], qp.weight());
+  std::sort(generated.begin(), generated.end());
+  std::sort(tabulated.begin(), tabulated.end());
+
+  const ctype epsilon = 64*std::numeric_limits<ctype>::epsilon();
+  bool equal = (generated.size() == tabulated.size());
+  for (std::size_t i = 0; equal && (i < generated.size()); ++i)
+    equal = (std::abs(generated[i].first - tabulated[i].first) <= epsilon)
+            && (std::abs(generated[i].second - tabulated[i].second) <= epsilon);
+  if (!equal)
+  {
+    std::cerr << "Error: Generated " << quad.type() << " quadrature of order " << p
+              << " does not match the tabulated rule" << std::endl;
+    success = false;
+  }
+}
+
+// integrate all monomials up to the order of a high order one-dimensional
+// rule; exact is the integral of x^k against the weight function
+template<class ctype, class Exact>
+void checkHighOrderRule(const Dune::QuadratureRule<ctype,1> &quad, int p, Exact &&exact)
+{
+  if (quad.order() < p)
+  {
+    std::cerr << "Error: Requested quadrature of order " << p
+              << ", got order " << quad.order() << std::endl;
+    success = false;
+    return;
+  }
+  for (int k = 0; k <= quad.order(); ++k)
+  {
+    ctype integral = 0;
+    for (const auto &qp : quad)
+      integral += qp.weight()*std::pow(qp.position()[0], k);
+    const ctype relativeError = std::abs(integral - exact(k)) / std::abs(exact(k));
+    if (relativeError > 1e-12)
+    {
+      std::cerr << "Error: High order quadrature of order " << quad.order()
+                << " fails to integrate x^" << k << " (relative error "
+                << relativeError << ")" << std::endl;
+      success = false;
+      return;
+    }
+  }
+}
+
+template<class ctype>
+void checkGaussJacobi()
+{
+  typedef Dune::QuadratureRules<ctype,1> Rules;
+  const Dune::GeometryType line = Dune::GeometryTypes::line;
+
+  // the generator reproduces the tables
+  const Dune::QuadratureType::Enum types[] = {
+    Dune::QuadratureType::GaussLegendre,
+    Dune::QuadratureType::GaussJacobi_1_0,
+    Dune::QuadratureType::GaussJacobi_2_0
+  };
+  for (int alpha = 0; alpha <= 2; ++alpha)
+  {
+    for (int p = 0; p <= 61; ++p)
+    {
+      const Dune::GaussJacobiQuadratureRule1D<ctype> quad(p, alpha, 0);
+      std::vector< Dune::FieldVector<ctype,1> > points;
+      std::vector< ctype > weights;
+      for (const auto &qp : quad)
+      {
+        points.push_back(qp.position());
+        weights.push_back(qp.weight());
+      }
+      checkGeneratedRule(points, weights, Rules::rule(line, p, types[alpha]), p);
+    }
+  }
+  for (int p = 0; p <= 31; ++p)
+  {
+    std::vector< Dune::FieldVector<ctype,1> > points;
+    std::vector< ctype > weights;
+    const auto &quad = Rules::rule(line, p, Dune::QuadratureType::GaussLobatto);
+    Dune::Impl::GaussJacobiGenerator::gaussLobatto(quad.size(), points, weights);
+    checkGeneratedRule(points, weights, quad, p);
+  }
+
+  // orders beyond the tables
+  for (int p = 62; p <= 151; p += 7)
+  {
+    checkHighOrderRule(Rules::rule(line, p, Dune::QuadratureType::GaussLegendre), p,
+                       [] (int k) { return ctype(1) / ctype(k+1); });
+    checkHighOrderRule(Rules::rule(line, p, Dune::QuadratureType::GaussJacobi_1_0), p,
+                       [] (int k) { return ctype(2) / ctype((k+1)*(k+2)); });
+    checkHighOrderRule(Rules::rule(line, p, Dune::QuadratureType::GaussJacobi_2_0), p,
+                       [] (int k) { return ctype(8) / ctype((k+1)*(k+2)*(k+3)); });
+    checkHighOrderRule(Rules::rule(line, p, Dune::QuadratureType::GaussLobatto), p,
+                       [] (int k) { return ctype(1) / ctype(k+1); });
+  }
+  if (&Rules::rule(line, 151) != &Rules::rule(line, 151))
+  {
+    std::cerr << "Error: Generated quadrature rules are not cached" << std::endl;
+    success = false;
+  }
+
+  // non-integer parameters: weight function 2^(alpha+beta) (1-x)^alpha x^beta
+  const Dune::GaussJacobiQuadratureRule1D<ctype> quad(91, 0.5, 1.5);
+  checkHighOrderRule(quad, 91, [] (int k) {
+      return std::pow(ctype(2), ctype(2)) * std::exp(std::lgamma(ctype(1.5)) + std::lgamma(ctype(k+2.5)) - std::lgamma(ctype(k+4)));
+    });
+}
+
+// the generated orders are advertised for lines only, the products of the
+// one-dimensional rules keep the tabulated bound
+template<class ctype>
+void checkMaxOrder()
+{
+  const unsigned int lineOrder = Dune::QuadratureRules<ctype,1>::maxOrder(Dune::GeometryTypes::line);
+  const unsigned int cubeOrder = Dune::QuadratureRules<ctype,3>::maxOrder(Dune::GeometryTypes::hexahedron);
+  const unsigned int simplexOrder = Dune::QuadratureRules<ctype,3>::maxOrder(Dune::GeometryTypes::tetrahedron);
+  if ((lineOrder != unsigned(Dune::GaussQuadratureRule1D<ctype>::highest_order))
+      || (cubeOrder != unsigned(Dune::GaussQuadratureRule1D<ctype>::highest_tabulated_order))
+      || (simplexOrder != unsigned(Dune::GaussQuadratureRule1D<ctype>::highest_tabulated_order-2)))
+  {
+    std::cerr << "Error: Wrong maxOrder: " << lineOrder << " for lines, " << cubeOrder
+              << " for hexahedra, " << simplexOrder << " for tetrahedra" << std::endl;
+    success = false;
+  }
+
+  try
+  {
+    Dune::QuadratureRules<ctype,3>::rule(Dune::GeometryTypes::hexahedron, cubeOrder+1);
+    std::cerr << "Error: QuadratureRule of order " << cubeOrder+1
+              << " above maxOrder for hexahedra did not throw" << std::endl;
+    success = false;
+  }
+  catch (const Dune::QuadratureOrderOutOfRange &)
+  {}
+}
+
+// the static rules coincide with the dynamic ones
+template<class ctype, int dim, unsigned int topologyId, int p>
+void checkStaticRule()
+{
+  typedef Dune::StaticQuadratureRule<ctype, dim, topologyId, p> StaticRule;
+  const Dune::QuadratureRule<ctype, dim> &quad
+    = Dune::QuadratureRules<ctype, dim>::rule(StaticRule::type(), p);
+
+  const StaticRule staticQuad;
+  // TensorProductQuadratureRule reports the requested instead of the delivered order
+  bool equal = (StaticRule::order() >= std::max(p, quad.order())) && (StaticRule::size() == quad.size());
+  for (std::size_t i = 0; equal && (i < quad.size()); ++i)
+  {
+    equal = (staticQuad[i].weight() == quad[i].weight());
+    for (int j = 0; j < dim; ++j)
+      equal &= (staticQuad[i].coordinate(j) == quad[i].position()[j]);
+  }
+  if (!equal)
+  {
+    std::cerr << "Error: StaticQuadratureRule for " << StaticRule::type() << " and order=" << p
+              << " does not match QuadratureRules" << std::endl;
+    success = false;
+  }
+}
+
+template<class ctype, int dim, unsigned int topologyId, int p>
+constexpr ctype staticWeightSum(std::size_t i = 0)
+{
+  typedef Dune::StaticQuadratureRule<ctype, dim, topologyId, p> StaticRule;
+  return (i < StaticRule::size() ? StaticRule::points[i].weight() + staticWeightSum<ctype, dim, topologyId, p>(i+1) : ctype(0));
+}
+
+void checkStaticRules()
+{
+  using Dune::GeometryTypes::line;
+  using Dune::GeometryTypes::triangle;
+  using Dune::GeometryTypes::quadrilateral;
+  using Dune::GeometryTypes::tetrahedron;
+  using Dune::GeometryTypes::hexahedron;
+
+  static_assert(Dune::StaticQuadratureRule<double, 2, quadrilateral.id(), 3>::size() == 4,
+                "StaticQuadratureRule size is not known at compile time");
+  static_assert(Dune::StaticQuadratureRule<double, 2, triangle.id(), 6>::order() == 7,
+                "StaticQuadratureRule order is not known at compile time");
+  static_assert(Dune::StaticQuadratureRule<double, 1, line.id(), 0>::points[0].coordinate(0) == 0.5,
+                "StaticQuadratureRule points are not known at compile time");
+  constexpr double volume = staticWeightSum<double, 3, hexahedron.id(), 5>();
+  if (std::abs(volume - 1.0) > 8*std::numeric_limits<double>::epsilon())
+  {
+    std::cerr << "Error: weights of StaticQuadratureRule do not sum up to 1" << std::endl;
+    success = false;
+  }
+
+  checkStaticRule<double, 1, line.id(), 0>();
+  checkStaticRule<double, 1, line.id(), 17>();
+  checkStaticRule<double, 1, line.id(), 31>();
+  checkStaticRule<float, 1, line.id(), 12>();
+  checkStaticRule<double, 2, quadrilateral.id(), 4>();
+  checkStaticRule<double, 2, quadrilateral.id(), 31>();
+  checkStaticRule<double, 3, hexahedron.id(), 7>();
+  checkStaticRule<double, 4, Dune::GeometryTypes::cube(4).id(), 3>();
+  checkStaticRule<double, 2, triangle.id(), 0>();
+  checkStaticRule<double, 2, triangle.id(), 3>();
+  checkStaticRule<double, 2, triangle.id(), 6>();
+  checkStaticRule<double, 2, triangle.id(), 12>();
+  checkStaticRule<double, 2, triangle.id(), 20>();
+  checkStaticRule<float, 2, triangle.id(), 9>();
+  checkStaticRule<double, 3, tetrahedron.id(), 1>();
+  checkStaticRule<double, 3, tetrahedron.id(), 3>();
+  checkStaticRule<double, 3, tetrahedron.id(), 4>();
+  checkStaticRule<double, 3, tetrahedron.id(), 5>();
+  checkStaticRule<double, 3, tetrahedron.id(), 8>();
+  checkStaticRule<double, 3, tetrahedron.id(), 10>();
+  checkStaticRule<long double, 1, line.id(), 31>();
+  checkStaticRule<long double, 3, hexahedron.id(), 9>();
+  checkStaticRule<long double, 2, triangle.id(), 12>();
+  checkStaticRule<long double, 3, tetrahedron.id(), 8>();
+}
+
 template<class ctype, int dim>
 void checkCompositeRule(Dune::GeometryType type,
                         unsigned int maxOrder,
@@ -195,10 +567,20 @@ void checkCompositeRule(Dune::GeometryType type,
   for (unsigned int p=0; p<=maxOrder; ++p)
   {
     const BaseQuad& baseQuad = Dune::QuadratureRules<ctype,dim>::rule(type, p, qt);
-    Quad quad = Quad(baseQuad, Dune::refinementLevels(maxRefinement));
+    Quad quad = Quad(baseQuad, Dune::refinementLevels(maxRefinement), qt);
 
     checkWeights(quad);
     checkQuadrature(quad);
+
+    // the cached rule has to coincide with the one built directly
+    const Quad& cached = Dune::CompositeQuadratureRules<ctype,dim>::rule(type, p, Dune::refinementLevels(maxRefinement), qt);
+    if (&cached != &Dune::CompositeQuadratureRules<ctype,dim>::rule(type, p, Dune::refinementLevels(maxRefinement), qt)
+        || cached.size() != quad.size())
+    {
+      std::cerr << "Error: cached composite rule for " << type << " of order " << p
+                << " differs from the rule built directly" << std::endl;
+      success = false;
+    }
   }
   if (dim>0 && (dim>3 || type.isCube() || type.isSimplex()))
   {
@@ -223,9 +605,29 @@ int main (int argc, char** argv)
     check<double,3>(Dune::GeometryTypes::prism, maxOrder);
     check<double,3>(Dune::GeometryTypes::pyramid, maxOrder);
 
+    checkPrepopulate<double,1>(maxOrder);
+    checkPrepopulate<double,2>(maxOrder, Dune::QuadratureType::GaussLobatto);
+    checkPrepopulate<double,3>(std::min(maxOrder, unsigned(10)));
+
+    checkMonomials<double,2>(Dune::GeometryTypes::triangle, Dune::SimplexQuadratureRule<double,2>::highest_order);
+    checkMonomials<double,3>(Dune::GeometryTypes::tetrahedron, Dune::SimplexQuadratureRule<double,3>::highest_order);
+    checkMonomials<double,3>(Dune::GeometryTypes::prism, Dune::PrismQuadratureRule<double,3>::highest_order);
+    checkMonomials<double,3>(Dune::GeometryTypes::pyramid, Dune::PyramidQuadratureRule<double,3>::highest_order);
+
+    checkGaussJacobi<double>();
+    checkMaxOrder<double>();
+
+    checkStaticRules();
+
     unsigned int maxRefinement = 4;
 
     checkCompositeRule<double,2>(Dune::GeometryTypes::triangle, maxOrder, maxRefinement);
+    checkCompositeRule<double,2>(Dune::GeometryTypes::quadrilateral, std::min(maxOrder, unsigned(20)), maxRefinement);
+    checkCompositeRule<double,3>(Dune::GeometryTypes::tetrahedron, std::min(maxOrder, unsigned(6)), 2);
+    checkCompositeRule<double,3>(Dune::GeometryTypes::prism, std::min(maxOrder, unsigned(6)), 2);
+    checkCompositeRule<double,3>(Dune::GeometryTypes::pyramid, std::min(maxOrder, unsigned(6)), 2);
+    checkCompositeRule<double,3>(Dune::GeometryTypes::prism, std::min(maxOrder, unsigned(6)), 2,
+                                 Dune::QuadratureType::GaussLobatto);
   }
   catch( const Dune::Exception &e )
   {
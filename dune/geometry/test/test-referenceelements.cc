@@ -7,9 +7,13 @@
 
 #include <config.h>
 
+#include <cmath>
+#include <initializer_list>
 #include <iostream>
+#include <utility>
 
 #include <dune/geometry/referenceelements.hh>
+#include <dune/geometry/staticreferenceelement.hh>
 
 using namespace Dune;
 
@@ -80,6 +84,58 @@ int checkSubEntities(const RE& re)
 
 
 
+// compare a StaticReferenceElement with the corresponding dynamic reference element
+template<int dim, unsigned int topologyId>
+int checkStaticReferenceElement()
+{
+  int errors = 0;
+
+  typedef StaticReferenceElement<double, dim, topologyId> SRE;
+  const auto re = ReferenceElements<double, dim>::general(GeometryType(topologyId, dim));
+  const double epsilon = 1e-14;
+
+  test(SRE::type() == re.type());
+  test(std::abs(SRE::volume() - re.volume()) < epsilon);
+  for (int c = 0; c <= dim; ++c)
+  {
+    testcmp(SRE::size(c), re.size(c));
+    for (int i = 0; i < re.size(c); ++i)
+    {
+      test(SRE::type(i, c) == re.type(i, c));
+      test((SRE::position(i, c) - re.position(i, c)).two_norm() < epsilon);
+      for (int cc = 0; cc <= dim; ++cc)
+      {
+        testcmp(SRE::size(i, c, cc), re.size(i, c, cc));
+        for (int ii = 0; ii < re.size(i, c, cc); ++ii)
+          testcmp(SRE::subEntity(i, c, ii, cc), re.subEntity(i, c, ii, cc));
+      }
+    }
+  }
+  if (dim > 0)
+    for (int face = 0; face < re.size(1); ++face)
+      test((SRE::integrationOuterNormal(face) - re.integrationOuterNormal(face)).two_norm() < epsilon);
+
+  return errors;
+}
+
+template<int dim, unsigned int... topologyIds>
+int checkStaticReferenceElements(std::integer_sequence<unsigned int, topologyIds...>)
+{
+  int errors = 0;
+  std::initializer_list<int>{ (errors += checkStaticReferenceElement<dim, topologyIds>())... };
+  return errors;
+}
+
+// the tables of a static reference element are constant expressions
+typedef StaticReferenceElement<double, 3, GeometryTypes::tetrahedron.id()> StaticTetrahedron;
+static_assert(StaticTetrahedron::size(3) == 4, "wrong number of vertices");
+static_assert(StaticTetrahedron::size(2, 1, 3) == 3, "wrong number of vertices of face 2");
+static_assert(StaticTetrahedron::subEntity(5, 2, 1, 3) == 3, "wrong vertex of edge 5");
+static_assert(StaticTetrahedron::type(0, 1) == GeometryTypes::triangle, "wrong face type");
+static_assert(StaticTetrahedron::volume() == 1.0 / 6.0, "wrong volume");
+
+
+
 int main () try
 {
   int errors = 0;
@@ -532,6 +588,16 @@ int main () try
 
   errors += checkSubEntities(referenceHexa);
 
+  // //////////////////////////////////////////////////////////////////////////
+  //   Test the static reference elements of all topologies
+  // //////////////////////////////////////////////////////////////////////////
+
+  errors += checkStaticReferenceElements<0>(std::make_integer_sequence<unsigned int, 1>());
+  errors += checkStaticReferenceElements<1>(std::make_integer_sequence<unsigned int, 2>());
+  errors += checkStaticReferenceElements<2>(std::make_integer_sequence<unsigned int, 4>());
+  errors += checkStaticReferenceElements<3>(std::make_integer_sequence<unsigned int, 8>());
+  errors += checkStaticReferenceElements<4>(std::make_integer_sequence<unsigned int, 16>());
+
   return errors>0 ? 1 : 0;
 
 }
@@ -11,9 +11,11 @@
 #include <iostream>
 #include <ostream>
 #include <typeinfo>
+#include <vector>
 
 #include <dune/geometry/test/checkgeometry.hh>
 #include <dune/geometry/referenceelements.hh>
+#include <dune/geometry/refinementmeshcache.hh>
 #include <dune/geometry/type.hh>
 #include <dune/geometry/virtualrefinement.hh>
 
@@ -99,6 +101,61 @@ void testVirtualRefinement(int &result, const Dune::GeometryType& elementType,
       fail(result);
     }
   }
+
+  // The bulk interface has to agree with the iterators
+  std::vector<typename Refinement::CoordVector> coords;
+  typename Refinement::IndexVector connectivity;
+  const int corners = elementRefinement.mesh(tag, coords, connectivity);
+
+  collect(result, (int(coords.size()) == elementRefinement.nVertices(tag))
+                  && (int(connectivity.size()) == corners*elementRefinement.nElements(tag)));
+
+  for (vSubIt = elementRefinement.vBegin(tag); vSubIt != vSubEnd; ++vSubIt)
+  {
+    if ((coords[vSubIt.index()] - vSubIt.coords()).two_norm() > 1e-12)
+    {
+      std::cerr << "Error: Bulk coordinates of vertex " << vSubIt.index()
+                << " differ from the iterator" << std::endl;
+      fail(result);
+    }
+  }
+
+  typename Refinement::IndexVector indices;
+  for (eSubIt = elementRefinement.eBegin(tag); eSubIt != eSubEnd; ++eSubIt)
+  {
+    // a copy has to continue independently of the original
+    eIterator copy(eSubIt);
+    ++copy;
+    collect(result, (copy != eSubIt) && (copy.index() == eSubIt.index()+1));
+
+    eSubIt.vertexIndices(indices);
+    collect(result, indices == eSubIt.vertexIndices());
+    for (int i = 0; i < corners; ++i)
+    {
+      if (connectivity[eSubIt.index()*corners + i] != indices[i])
+      {
+        std::cerr << "Error: Bulk connectivity of element " << eSubIt.index()
+                  << " differs from the iterator" << std::endl;
+        fail(result);
+      }
+    }
+  }
+
+  // The cached mesh has to agree with the bulk interface
+  typedef Dune::RefinementMeshCache<dim, ct> MeshCache;
+  const typename MeshCache::MeshPointer mesh = MeshCache::mesh(elementType, coerceTo, tag);
+  collect(result, (mesh == MeshCache::mesh(elementType, coerceTo, tag))
+                  && (mesh->vertices() == coords) && (mesh->connectivity() == connectivity)
+                  && (mesh->nElements() == elementRefinement.nElements(tag)));
+  for (eSubIt = elementRefinement.eBegin(tag); eSubIt != eSubEnd; ++eSubIt)
+  {
+    if ((mesh->geometry(eSubIt.index()).center() - eSubIt.coords()).two_norm() > 1e-12)
+    {
+      std::cerr << "Error: Cached geometry of element " << eSubIt.index()
+                << " differs from the iterator" << std::endl;
+      fail(result);
+    }
+  }
 }
 
 /*!
@@ -135,6 +192,95 @@ void testStaticRefinementGeometry(int &result, Dune::RefinementIntervals tag, st
   }
 }
 
+/*!
+ * \brief Test the random access element iterator of the simplex refinement
+ */
+template <int dim>
+void testSimplexRandomAccess(int &result, Dune::RefinementIntervals tag)
+{
+  std::cout << "Checking random access simplex refinement dimension " << dim
+            << " intervals " << tag.intervals() << std::endl;
+
+  typedef Dune::RefinementImp::Simplex::RefinementImp<dim, double> Refinement;
+  typedef typename Refinement::ElementIterator eIterator;
+
+  const int n = Refinement::nElements(tag.intervals());
+  const eIterator eSubBegin = Refinement::eBegin(tag.intervals());
+  const eIterator eSubEnd   = Refinement::eEnd(tag.intervals());
+  collect(result, (eSubEnd - eSubBegin) == n);
+
+  // jumping to an element has to agree with walking there
+  eIterator eSubIt = eSubBegin;
+  for (int k = 0; k < n; ++k, ++eSubIt)
+  {
+    const eIterator jumped = eSubBegin + k;
+    if (jumped != eSubIt || jumped.index() != k
+        || jumped.vertexIndices() != eSubIt.vertexIndices())
+    {
+      std::cerr << "Error: Random access to element " << k
+                << " differs from the increment" << std::endl;
+      fail(result);
+    }
+  }
+  collect(result, eSubIt == eSubEnd);
+
+  // walking backwards has to visit the elements in reverse order
+  for (int k = n-1; k >= 0; --k)
+  {
+    --eSubIt;
+    collect(result, (eSubIt.index() == k)
+                    && (eSubIt.vertexIndices() == (eSubBegin + k).vertexIndices()));
+  }
+  collect(result, eSubIt == eSubBegin);
+}
+
+
+/*!
+ * \brief Test the duplicate-free vertex numbering of a triangulation
+ */
+template <unsigned topologyId, unsigned coerceToId>
+void testConformingRefinement(int &result, Dune::RefinementIntervals tag)
+{
+  std::cout << "Checking conforming refinement "
+            << GeometryType(topologyId, 3) << " -> "
+            << GeometryType(coerceToId, 3) << " intervals " << tag.intervals() << std::endl;
+
+  typedef Dune::StaticRefinement<topologyId, double, coerceToId, 3> Refinement;
+  typedef typename Refinement::CoordVector CoordVector;
+  const int corners = 4;
+
+  std::vector<CoordVector> coords(Refinement::nVertices(tag));
+  std::vector<int> connectivity(corners*Refinement::nElements(tag));
+  Refinement::fillVertices(tag, coords.data());
+  Refinement::fillConnectivity(tag, connectivity.data());
+
+  const int nConforming = Refinement::nConformingVertices(tag);
+  std::vector<CoordVector> conformingCoords(nConforming);
+  std::vector<int> conformingConnectivity(connectivity.size());
+  Refinement::fillConformingVertices(tag, conformingCoords.data());
+  Refinement::fillConformingConnectivity(tag, conformingConnectivity.data());
+
+  // every vertex has to be used, and the elements have to keep their corners
+  std::vector<bool> used(nConforming, false);
+  for (std::size_t i = 0; i < connectivity.size(); ++i)
+  {
+    const int v = conformingConnectivity[i];
+    if (v < 0 || v >= nConforming
+        || (conformingCoords[v] - coords[connectivity[i]]).two_norm() > 1e-12)
+    {
+      std::cerr << "Error: Conforming connectivity entry " << i
+                << " differs from the refinement" << std::endl;
+      fail(result);
+      continue;
+    }
+    used[v] = true;
+  }
+  for (int v = 0; v < nConforming; ++v)
+  {
+    collect(result, used[v]);
+    collect(result, Refinement::conformingIndex(tag.intervals(), conformingCoords[v]) == v);
+  }
+}
 
 int main(int argc, char** argv) try
 {
@@ -165,6 +311,8 @@ int main(int argc, char** argv) try
         (result, refinementLevels(refinement), "levels");
     testStaticRefinementGeometry<Line::id,double,Line::id,1>
         (result, refinementIntervals(1<<refinement), "intervals");
+    testSimplexRandomAccess<1>(result, refinementIntervals(refinement+1));
+    testSimplexRandomAccess<1>(result, refinementIntervals(1<<refinement));
   }
 
   // test triangle
@@ -177,6 +325,8 @@ int main(int argc, char** argv) try
         (result, refinementLevels(refinement), "levels");
     testStaticRefinementGeometry<Triangle::id,double,Triangle::id,2>
         (result, refinementIntervals(1<<refinement), "intervals");
+    testSimplexRandomAccess<2>(result, refinementIntervals(refinement+1));
+    testSimplexRandomAccess<2>(result, refinementIntervals(1<<refinement));
   }
 
   // test quadrilateral
@@ -213,6 +363,8 @@ int main(int argc, char** argv) try
         (result, refinementLevels(refinement), "levels");
     testStaticRefinementGeometry<Tet::id,double,Tet::id,3>
         (result, refinementIntervals(1<<refinement), "intervals");
+    testSimplexRandomAccess<3>(result, refinementIntervals(refinement+1));
+    testSimplexRandomAccess<3>(result, refinementIntervals(1<<refinement));
   }
 
   // test pyramid
@@ -226,6 +378,7 @@ int main(int argc, char** argv) try
         (result, refinementLevels(refinement), "levels");
     testStaticRefinementGeometry<Pyramid::id,double,Tet::id,3>
         (result, refinementIntervals(1<<refinement), "intervals");
+    testConformingRefinement<Pyramid::id,Tet::id>(result, refinementIntervals(refinement+1));
   }
 
   // test prism
@@ -239,6 +392,7 @@ int main(int argc, char** argv) try
         (result, refinementLevels(refinement), "levels");
     testStaticRefinementGeometry<Prism::id,double,Tet::id,3>
         (result, refinementIntervals(1<<refinement), "intervals");
+    testConformingRefinement<Prism::id,Tet::id>(result, refinementIntervals(refinement+1));
   }
 
   // test hexahedron
@@ -265,6 +419,19 @@ int main(int argc, char** argv) try
         (result, refinementIntervals(1<<refinement), "intervals");
   }
 
+  // test that the mesh cache respects its capacity
+  {
+    typedef Dune::RefinementMeshCache<3, double> MeshCache;
+    const auto mesh = MeshCache::mesh(GeometryTypes::hexahedron, GeometryTypes::hexahedron, refinementIntervals(4));
+    MeshCache::setCapacity(mesh->memory());
+    collect(result, MeshCache::memory() <= mesh->memory());
+    MeshCache::mesh(GeometryTypes::prism, GeometryTypes::tetrahedron, refinementIntervals(4));
+    collect(result, (MeshCache::memory() <= MeshCache::capacity()) && (mesh->nElements() == 64));
+    MeshCache::clear();
+    collect(result, MeshCache::memory() == 0);
+    MeshCache::setCapacity(MeshCache::defaultCapacity);
+  }
+
   return result;
 
 }
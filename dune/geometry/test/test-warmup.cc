@@ -0,0 +1,56 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#include <config.h>
+
+#include <iostream>
+#include <vector>
+
+#include <dune/geometry/quadraturerules.hh>
+#include <dune/geometry/type.hh>
+#include <dune/geometry/warmup.hh>
+
+int main ( int argc, char **argv )
+{
+  bool pass = true;
+
+  const std::vector< Dune::QuadratureType::Enum > types = { Dune::QuadratureType::GaussLegendre, Dune::QuadratureType::GaussLobatto };
+  const Dune::WarmupStatistics stats = Dune::warmup< double, 3 >( 8, types, 4 );
+  std::cout << stats << std::endl;
+
+  // dim 0: 1 rule per type, dim 1: 9 per type, dim 2 and 3: 9 per type and geometry type
+  const std::size_t expectedRules = 2*(1 + 9 + 2*9 + 4*9);
+  if( stats.quadratureRules != expectedRules )
+  {
+    std::cerr << "Error: warmup requested " << stats.quadratureRules << " quadrature rules, expected "
+              << expectedRules << "." << std::endl;
+    pass = false;
+  }
+  if( stats.referenceElements != 1 + 1 + 2 + 4 )
+  {
+    std::cerr << "Error: warmup requested " << stats.referenceElements << " reference elements." << std::endl;
+    pass = false;
+  }
+  if( (stats.threads != 4) || (stats.quadratureBytes == 0) || (stats.referenceElementBytes == 0) || (stats.seconds < 0) )
+  {
+    std::cerr << "Error: inconsistent warmup statistics." << std::endl;
+    pass = false;
+  }
+
+  // the rules must be available (and unchanged) after the warmup
+  const auto &rule = Dune::QuadratureRules< double, 3 >::rule( Dune::GeometryTypes::pyramid, 8 );
+  if( (rule.order() < 8) || (&rule != &Dune::QuadratureRules< double, 3 >::rule( Dune::GeometryTypes::pyramid, 8 )) )
+  {
+    std::cerr << "Error: rule created during warmup is not available." << std::endl;
+    pass = false;
+  }
+
+  // a second (sequential) warmup finds everything in place
+  const Dune::WarmupStatistics stats2 = Dune::warmup< double, 3 >( 8, types, 1 );
+  if( (stats2.quadratureRules != stats.quadratureRules) || (stats2.quadratureBytes != stats.quadratureBytes) )
+  {
+    std::cerr << "Error: repeated warmup yields different statistics." << std::endl;
+    pass = false;
+  }
+
+  return (pass ? 0 : 1);
+}
@@ -8,7 +8,10 @@
  */
 
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
 
+#include <functional>
 #include <string>
 
 #include <dune/common/deprecated.hh>
@@ -96,7 +99,7 @@ namespace Dune
      *
      *  \returns number of topologies for the dimension
      */
-    inline static unsigned int numTopologies ( int dim ) noexcept
+    inline static constexpr unsigned int numTopologies ( int dim ) noexcept
     {
       return (1u << dim);
     }
@@ -112,7 +115,7 @@ namespace Dune
      *  \returns true, if a pyramid construction was used to generate the
      *           codimension the topology.
      */
-    inline bool static isPyramid ( unsigned int topologyId, int dim, int codim = 0 ) noexcept
+    inline static constexpr bool isPyramid ( unsigned int topologyId, int dim, int codim = 0 ) noexcept
     {
       assert( (dim > 0) && (topologyId < numTopologies( dim )) );
       assert( (0 <= codim) && (codim < dim) );
@@ -130,7 +133,7 @@ namespace Dune
      *  \returns true, if a prism construction was used to generate the
      *           codimension the topology.
      */
-    inline static bool isPrism ( unsigned int topologyId, int dim, int codim = 0 ) noexcept
+    inline static constexpr bool isPrism ( unsigned int topologyId, int dim, int codim = 0 ) noexcept
     {
       assert( (dim > 0) && (topologyId < numTopologies( dim )) );
       assert( (0 <= codim) && (codim < dim) );
@@ -149,7 +152,7 @@ namespace Dune
      *  \returns true, if construction was used to generate the codimension the
      *           topology.
      */
-    inline static bool isTopology ( TopologyConstruction construction, unsigned int topologyId, int dim, int codim = 0 ) noexcept
+    inline static constexpr bool isTopology ( TopologyConstruction construction, unsigned int topologyId, int dim, int codim = 0 ) noexcept
     {
       assert( (dim > 0) && (topologyId < numTopologies( dim )) );
       assert( (0 <= codim) && (codim <= dim) );
@@ -163,7 +166,7 @@ namespace Dune
      *  \param[in]  codim         codimension for which the information is desired
      *                            (defaults to 1)
      */
-    inline static unsigned int baseTopologyId ( unsigned int topologyId, int dim, int codim = 1 ) noexcept
+    inline static constexpr unsigned int baseTopologyId ( unsigned int topologyId, int dim, int codim = 1 ) noexcept
     {
       assert( (dim >= 0) && (topologyId < numTopologies( dim )) );
       assert( (0 <= codim) && (codim <= dim) );
@@ -579,6 +582,24 @@ namespace Dune
       return topologyId_;
     }
 
+    /** \brief Return the type packed into 32 bits
+     *
+     *  Bits 0 to 7 hold the dimension, bit 8 the flag for type none and
+     *  bits 9 to 31 the topology id.  The encoding is lossless for all
+     *  dimensions up to 23 and can be unpacked by fromPacked().
+     */
+    constexpr std::uint32_t toPacked() const {
+      return std::uint32_t(dim_) | (std::uint32_t(none_) << 8) | (std::uint32_t(topologyId_) << 9);
+    }
+
+    /** \brief Construct a type from its packed representation
+     *
+     *  \sa toPacked()
+     */
+    static constexpr GeometryType fromPacked(std::uint32_t packed) {
+      return GeometryType(packed >> 9, packed & 0xff, (packed >> 8) & 1);
+    }
+
     /*@}*/
 
 
@@ -776,6 +797,26 @@ namespace Dune
 
 } // namespace Dune
 
+namespace std
+{
+
+  /** \brief Hash function for GeometryType, compatible with its operator==
+   *
+   *  All types none are equal and hash to the same value.  For the other
+   *  types, the lowest bit of the topology id does not take part in the
+   *  comparison and is ignored.
+   */
+  template<>
+  struct hash<Dune::GeometryType>
+  {
+    std::size_t operator()(const Dune::GeometryType& gt) const
+    {
+      return gt.isNone() ? std::size_t(0x100) : std::size_t(gt.dim() | ((gt.id() >> 1) << 9));
+    }
+  };
+
+} // namespace std
+
 // include utility header needed for deprecated makeFromVertices
 #include "utility/typefromvertexcount.hh"
 
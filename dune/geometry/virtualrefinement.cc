@@ -9,8 +9,12 @@
  * \brief This file contains the virtual wrapper around refinement.
  */
 
+#include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <new>
 #include <typeinfo>
+#include <vector>
 
 #include <dune/common/exceptions.hh>
 #include <dune/common/fvector.hh>
@@ -35,14 +39,16 @@ namespace Dune
   VirtualRefinement<dimension, CoordType>::
   vBegin(int level) const
   {
-    return VertexIterator(vBeginBack(Dune::refinementIntervals(1<<level)));
+    return vBegin(Dune::refinementIntervals(1<<level));
   }
   template<int dimension, class CoordType>
   typename VirtualRefinement<dimension, CoordType>::VertexIterator
   VirtualRefinement<dimension, CoordType>::
   vBegin(Dune::RefinementIntervals tag) const
   {
-    return VertexIterator(vBeginBack(tag));
+    VertexIterator it;
+    it.backend = vBeginBack(tag, it.storage);
+    return it;
   }
 
   template<int dimension, class CoordType>
@@ -50,14 +56,16 @@ namespace Dune
   VirtualRefinement<dimension, CoordType>::
   vEnd(int level) const
   {
-    return VertexIterator(vEndBack(Dune::refinementIntervals(1<<level)));
+    return vEnd(Dune::refinementIntervals(1<<level));
   }
   template<int dimension, class CoordType>
   typename VirtualRefinement<dimension, CoordType>::VertexIterator
   VirtualRefinement<dimension, CoordType>::
   vEnd(Dune::RefinementIntervals tag) const
   {
-    return VertexIterator(vEndBack(tag));
+    VertexIterator it;
+    it.backend = vEndBack(tag, it.storage);
+    return it;
   }
 
   template<int dimension, class CoordType>
@@ -65,14 +73,16 @@ namespace Dune
   VirtualRefinement<dimension, CoordType>::
   eBegin(int level) const
   {
-    return ElementIterator(eBeginBack(Dune::refinementIntervals(1<<level)));
+    return eBegin(Dune::refinementIntervals(1<<level));
   }
   template<int dimension, class CoordType>
   typename VirtualRefinement<dimension, CoordType>::ElementIterator
   VirtualRefinement<dimension, CoordType>::
   eBegin(Dune::RefinementIntervals tag) const
   {
-    return ElementIterator(eBeginBack(tag));
+    ElementIterator it;
+    it.backend = eBeginBack(tag, it.storage);
+    return it;
   }
 
   template<int dimension, class CoordType>
@@ -80,14 +90,16 @@ namespace Dune
   VirtualRefinement<dimension, CoordType>::
   eEnd(int level) const
   {
-    return ElementIterator(eEndBack(Dune::refinementIntervals(1<<level)));
+    return eEnd(Dune::refinementIntervals(1<<level));
   }
   template<int dimension, class CoordType>
   typename VirtualRefinement<dimension, CoordType>::ElementIterator
   VirtualRefinement<dimension, CoordType>::
   eEnd(Dune::RefinementIntervals tag) const
   {
-    return ElementIterator(eEndBack(tag));
+    ElementIterator it;
+    it.backend = eEndBack(tag, it.storage);
+    return it;
   }
 
   //
@@ -112,6 +124,8 @@ namespace Dune
     typedef typename Refinement::IndexVector IndexVector;
 
     IndexVector vertexIndices() const;
+    //! Get the vertex indices without allocating, if indices has sufficient capacity
+    void vertexIndices(IndexVector &indices) const;
   };
 
   template<int dimension, class CoordType>
@@ -119,7 +133,17 @@ namespace Dune
   VirtualRefinementSubEntityIteratorSpecial<dimension, CoordType, 0>::
   vertexIndices() const
   {
-    return static_cast<const Common *>(this)->backend->vertexIndices();
+    IndexVector indices;
+    vertexIndices(indices);
+    return indices;
+  }
+
+  template<int dimension, class CoordType>
+  void
+  VirtualRefinementSubEntityIteratorSpecial<dimension, CoordType, 0>::
+  vertexIndices(IndexVector &indices) const
+  {
+    static_cast<const Common *>(this)->backend->vertexIndices(indices);
   }
 
   // The iterator common stuff
@@ -135,7 +159,6 @@ namespace Dune
     typedef typename Refinement::template SubEntityIteratorBack<codimension> IteratorBack;
     typedef typename Refinement::CoordVector CoordVector;
 
-    SubEntityIterator(IteratorBack *backend);
     SubEntityIterator(const This &other);
     ~SubEntityIterator();
 
@@ -150,7 +173,14 @@ namespace Dune
     typename VirtualRefinement<dimension, CoordType>::template Codim<codimension>::SubEntityIterator::
     CoordVector coords() const;
   private:
+    friend class VirtualRefinement<dimension, CoordType>;
     friend class VirtualRefinementSubEntityIteratorSpecial<dimension, CoordType, codimension>;
+
+    SubEntityIterator();
+    void release();
+
+    // backend points into storage unless it was too large to fit
+    typename Refinement::IteratorStorage storage;
     IteratorBack *backend;
   };
 
@@ -158,15 +188,15 @@ namespace Dune
   template<int dimension, class CoordType>
   template<int codimension>
   VirtualRefinement<dimension, CoordType>::Codim<codimension>::SubEntityIterator::
-  SubEntityIterator(IteratorBack *backend_)
-    : backend(backend_)
+  SubEntityIterator()
+    : backend(nullptr)
   {}
 
   template<int dimension, class CoordType>
   template<int codimension>
   VirtualRefinement<dimension, CoordType>::Codim<codimension>::SubEntityIterator::
   SubEntityIterator(const This &other)
-    : backend(other.backend->clone())
+    : backend(other.backend->clone(storage))
   {}
 
   template<int dimension, class CoordType>
@@ -174,7 +204,7 @@ namespace Dune
   VirtualRefinement<dimension, CoordType>::Codim<codimension>::SubEntityIterator::
   ~SubEntityIterator()
   {
-    delete backend;
+    release();
   }
 
   template<int dimension, class CoordType>
@@ -183,8 +213,25 @@ namespace Dune
   VirtualRefinement<dimension, CoordType>::Codim<codimension>::SubEntityIterator::
   operator=(const This &other)
   {
-    delete backend;
-    backend = other.backend->clone();
+    if(this != &other)
+    {
+      release();
+      backend = other.backend->clone(storage);
+    }
+    return *this;
+  }
+
+  template<int dimension, class CoordType>
+  template<int codimension>
+  void
+  VirtualRefinement<dimension, CoordType>::Codim<codimension>::SubEntityIterator::
+  release()
+  {
+    if(static_cast<void *>(backend) == static_cast<void *>(&storage))
+      backend->~IteratorBack();
+    else
+      delete backend;
+    backend = nullptr;
   }
 
   template<int dimension, class CoordType>
@@ -218,6 +265,39 @@ namespace Dune
   { return backend->coords(); }
 #endif // DOXYGEN
 
+  //
+  // The default mesh() implementation
+  //
+
+  template<int dimension, class CoordType>
+  int
+  VirtualRefinement<dimension, CoordType>::
+  mesh(Dune::RefinementIntervals tag, std::vector<CoordVector> &coords,
+       IndexVector &connectivity) const
+  {
+    coords.resize(nVertices(tag));
+    for(VertexIterator it = vBegin(tag), end = vEnd(tag); it != end; ++it)
+      coords[it.index()] = it.coords();
+
+    connectivity.clear();
+    std::size_t corners = 0;
+    IndexVector indices;
+    for(ElementIterator it = eBegin(tag), end = eEnd(tag); it != end; ++it)
+    {
+      it.vertexIndices(indices);
+      if(connectivity.empty())
+      {
+        corners = indices.size();
+        connectivity.resize(corners * nElements(tag));
+      }
+      assert(indices.size() == corners);
+      std::copy(indices.begin(), indices.end(),
+                connectivity.begin() + corners * it.index());
+    }
+
+    return static_cast<int>(corners);
+  }
+
   //
   // The iterator backend
   //
@@ -245,6 +325,10 @@ namespace Dune
 
     virtual IndexVector vertexIndices() const = 0;
 
+    //! Get the vertex indices without allocating; the default forwards to vertexIndices()
+    virtual void vertexIndices(IndexVector &indices) const
+    { indices = vertexIndices(); }
+
     virtual ~VirtualRefinementSubEntityIteratorBackSpecial()
     {}
   };
@@ -259,11 +343,26 @@ namespace Dune
     typedef VirtualRefinement<dimension, CoordType> Refinement;
     typedef typename Refinement::template SubEntityIteratorBack<codimension> This;
     typedef typename Refinement::CoordVector CoordVector;
+    typedef typename Refinement::IteratorStorage IteratorStorage;
 
     virtual ~SubEntityIteratorBack() {}
 
     virtual This *clone() const = 0;
 
+    //! copy this backend into storage, or onto the heap if it does not fit; the default uses clone()
+    virtual This *clone(IteratorStorage &) const
+    { return clone(); }
+
+    //! construct a copy of back in storage, or on the heap if it does not fit
+    template<class Back>
+    static This *emplace(IteratorStorage &storage, const Back &back)
+    {
+      if((sizeof(Back) <= sizeof(IteratorStorage)) && (alignof(Back) <= alignof(IteratorStorage)))
+        return new (&storage) Back(back);
+      else
+        return new Back(back);
+    }
+
     virtual bool operator==(const This &other) const = 0;
     virtual This &operator++() = 0;
 
@@ -300,14 +399,25 @@ namespace Dune
     int nElements(int level) const;
     int nElements(Dune::RefinementIntervals tag) const;
 
+    int mesh(Dune::RefinementIntervals tag,
+             std::vector<typename VirtualRefinement::CoordVector> &coords,
+             typename VirtualRefinement::IndexVector &connectivity) const;
+
     static VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension> &instance();
   private:
     VirtualRefinementImp() {}
 
+    typedef typename VirtualRefinement::IteratorStorage IteratorStorage;
+
     typename VirtualRefinement::VertexIteratorBack *vBeginBack(Dune::RefinementIntervals tag) const;
     typename VirtualRefinement::VertexIteratorBack *vEndBack(Dune::RefinementIntervals tag) const;
     typename VirtualRefinement::ElementIteratorBack *eBeginBack(Dune::RefinementIntervals tag) const;
     typename VirtualRefinement::ElementIteratorBack *eEndBack(Dune::RefinementIntervals tag) const;
+
+    typename VirtualRefinement::VertexIteratorBack *vBeginBack(Dune::RefinementIntervals tag, IteratorStorage &storage) const;
+    typename VirtualRefinement::VertexIteratorBack *vEndBack(Dune::RefinementIntervals tag, IteratorStorage &storage) const;
+    typename VirtualRefinement::ElementIteratorBack *eBeginBack(Dune::RefinementIntervals tag, IteratorStorage &storage) const;
+    typename VirtualRefinement::ElementIteratorBack *eEndBack(Dune::RefinementIntervals tag, IteratorStorage &storage) const;
   };
 
   template<unsigned topologyId, class CoordType,
@@ -343,6 +453,15 @@ namespace Dune
     return new SubEntityIteratorBack<dimension>(StaticRefinement::vBegin(tag));
   }
 
+  template<unsigned topologyId, class CoordType,
+      unsigned coerceToId, int dimension>
+  typename VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::VirtualRefinement::VertexIteratorBack *
+  VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::
+  vBeginBack(Dune::RefinementIntervals tag, IteratorStorage &storage) const
+  {
+    return VirtualRefinement::VertexIteratorBack::emplace(storage, SubEntityIteratorBack<dimension>(StaticRefinement::vBegin(tag)));
+  }
+
   template<unsigned topologyId, class CoordType,
       unsigned coerceToId, int dimension>
   typename VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::VirtualRefinement::VertexIteratorBack *
@@ -352,6 +471,15 @@ namespace Dune
     return new SubEntityIteratorBack<dimension>(StaticRefinement::vEnd(tag));
   }
 
+  template<unsigned topologyId, class CoordType,
+      unsigned coerceToId, int dimension>
+  typename VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::VirtualRefinement::VertexIteratorBack *
+  VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::
+  vEndBack(Dune::RefinementIntervals tag, IteratorStorage &storage) const
+  {
+    return VirtualRefinement::VertexIteratorBack::emplace(storage, SubEntityIteratorBack<dimension>(StaticRefinement::vEnd(tag)));
+  }
+
   template<unsigned topologyId, class CoordType,
       unsigned coerceToId, int dimension>
   int VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::nElements(int level) const
@@ -365,6 +493,24 @@ namespace Dune
     return StaticRefinement::nElements(tag);
   }
 
+  template<unsigned topologyId, class CoordType,
+      unsigned coerceToId, int dimension>
+  int VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::
+  mesh(Dune::RefinementIntervals tag,
+       std::vector<typename VirtualRefinement::CoordVector> &coords,
+       typename VirtualRefinement::IndexVector &connectivity) const
+  {
+    const int corners = StaticRefinement::IndexVector::dimension;
+
+    coords.resize(StaticRefinement::nVertices(tag));
+    StaticRefinement::fillVertices(tag, coords.data());
+
+    connectivity.resize(StaticRefinement::nElements(tag) * corners);
+    StaticRefinement::fillConnectivity(tag, connectivity.data());
+
+    return corners;
+  }
+
   template<unsigned topologyId, class CoordType,
       unsigned coerceToId, int dimension>
   typename VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::VirtualRefinement::ElementIteratorBack *
@@ -374,6 +520,15 @@ namespace Dune
     return new SubEntityIteratorBack<0>(StaticRefinement::eBegin(tag));
   }
 
+  template<unsigned topologyId, class CoordType,
+      unsigned coerceToId, int dimension>
+  typename VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::VirtualRefinement::ElementIteratorBack *
+  VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::
+  eBeginBack(Dune::RefinementIntervals tag, IteratorStorage &storage) const
+  {
+    return VirtualRefinement::ElementIteratorBack::emplace(storage, SubEntityIteratorBack<0>(StaticRefinement::eBegin(tag)));
+  }
+
   template<unsigned topologyId, class CoordType,
       unsigned coerceToId, int dimension>
   typename VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::VirtualRefinement::ElementIteratorBack *
@@ -383,6 +538,15 @@ namespace Dune
     return new SubEntityIteratorBack<0>(StaticRefinement::eEnd(tag));
   }
 
+  template<unsigned topologyId, class CoordType,
+      unsigned coerceToId, int dimension>
+  typename VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::VirtualRefinement::ElementIteratorBack *
+  VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::
+  eEndBack(Dune::RefinementIntervals tag, IteratorStorage &storage) const
+  {
+    return VirtualRefinement::ElementIteratorBack::emplace(storage, SubEntityIteratorBack<0>(StaticRefinement::eEnd(tag)));
+  }
+
   //
   // The iterator backend implementation
   //
@@ -414,6 +578,7 @@ namespace Dune
     typedef typename RefinementBase::IndexVector IndexVector;
 
     IndexVector vertexIndices() const;
+    void vertexIndices(IndexVector &indices) const;
   };
 
   template<unsigned topologyId, class CoordType,
@@ -422,13 +587,21 @@ namespace Dune
   VirtualRefinementImpSubEntityIteratorBackSpecial<topologyId, CoordType, coerceToId, dimension, 0>::
   vertexIndices() const
   {
-    IndexVector vIndices;
-    vIndices.reserve(StaticRefinement::IndexVector::dimension);
+    IndexVector indices;
+    vertexIndices(indices);
+    return indices;
+  }
 
+  template<unsigned topologyId, class CoordType,
+      unsigned coerceToId, int dimension>
+  void
+  VirtualRefinementImpSubEntityIteratorBackSpecial<topologyId, CoordType, coerceToId, dimension, 0>::
+  vertexIndices(IndexVector &indices) const
+  {
     typename StaticRefinement::IndexVector sIndices = static_cast<const Common *>(this)->backend.vertexIndices();
+    indices.resize(StaticRefinement::IndexVector::dimension);
     for(int i = 0; i < StaticRefinement::IndexVector::dimension; ++i)
-      vIndices.push_back(sIndices[i]);
-    return vIndices;
+      indices[i] = sIndices[i];
   }
 
   // The shared iterator backend implementation
@@ -443,11 +616,13 @@ namespace Dune
     typedef typename VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::template SubEntityIteratorBack<codimension> This;
     typedef typename VirtualRefinement::template SubEntityIteratorBack<codimension> Base;
     typedef typename VirtualRefinement::CoordVector CoordVector;
+    typedef typename VirtualRefinement::IteratorStorage IteratorStorage;
 
     SubEntityIteratorBack(const BackendIterator &backend);
     SubEntityIteratorBack(const This &other);
 
     Base *clone() const;
+    Base *clone(IteratorStorage &storage) const;
 
     bool operator==(const Base &other) const;
     Base &operator++();
@@ -484,6 +659,13 @@ namespace Dune
   clone() const
   { return new This(*this); }
 
+  template<unsigned topologyId, class CoordType, unsigned coerceToId, int dimension>
+  template<int codimension>
+  typename VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::template SubEntityIteratorBack<codimension>::Base *
+  VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::SubEntityIteratorBack<codimension>::
+  clone(IteratorStorage &storage) const
+  { return Base::emplace(storage, *this); }
+
   template<unsigned topologyId, class CoordType, unsigned coerceToId, int dimension>
   template<int codimension>
   bool
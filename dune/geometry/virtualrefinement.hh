@@ -263,6 +263,8 @@
  * long as buildRefinement() is enough for the job.
  */
 
+#include <cstddef>
+#include <type_traits>
 #include <vector>
 
 #include <dune/common/fvector.hh>
@@ -372,15 +374,62 @@ namespace Dune
      */
     ElementIterator eEnd(Dune::RefinementIntervals tag) const;
 
+    /*!
+     * \brief Get the complete refined mesh in one call
+     *
+     * \param tag          RefinementIntervals object returned by either
+     *                     refinementIntervals() or refinementLevels()
+     * \param coords       Resized to nVertices(tag); coords[i] receives the
+     *                     coordinates of the vertex with index i
+     * \param connectivity Resized to nElements(tag) times the number of
+     *                     corners per element; the vertex indices of the
+     *                     element with index i are stored contiguously
+     *                     starting at connectivity[i*corners]
+     *
+     * \returns the number of corners per element
+     *
+     * This avoids a virtual call per vertex and element, so it should be
+     * preferred over the iterators when the whole refinement is needed.
+     * The default implementation walks the vertex and element iterators;
+     * derived classes should override it with something faster.
+     */
+    virtual int mesh(Dune::RefinementIntervals tag,
+                     std::vector<CoordVector> &coords,
+                     IndexVector &connectivity) const;
+
+    /*!
+     * \brief Capacity of the in-place storage for iterator backends
+     *
+     * Backends of up to this size are stored inside the iterators, so
+     * creating and copying iterators does not allocate.  Larger backends
+     * are allocated on the heap.
+     */
+    static const std::size_t iteratorStorageSize = 16*sizeof(void *);
+
     //! Destructor
     virtual ~VirtualRefinement()
     {}
 
+    //! Storage the iterators provide for their backend
+    typedef typename std::aligned_storage<iteratorStorageSize, alignof(std::max_align_t)>::type IteratorStorage;
+
   protected:
     virtual VertexIteratorBack *vBeginBack(Dune::RefinementIntervals tag) const = 0;
     virtual VertexIteratorBack *vEndBack(Dune::RefinementIntervals tag) const = 0;
     virtual ElementIteratorBack *eBeginBack(Dune::RefinementIntervals tag) const = 0;
     virtual ElementIteratorBack *eEndBack(Dune::RefinementIntervals tag) const = 0;
+
+    // These may construct the backend in the storage provided by the
+    // iterator, see SubEntityIteratorBack::emplace().  The defaults fall
+    // back to the heap allocated backends from above.
+    virtual VertexIteratorBack *vBeginBack(Dune::RefinementIntervals tag, IteratorStorage &) const
+    { return vBeginBack(tag); }
+    virtual VertexIteratorBack *vEndBack(Dune::RefinementIntervals tag, IteratorStorage &) const
+    { return vEndBack(tag); }
+    virtual ElementIteratorBack *eBeginBack(Dune::RefinementIntervals tag, IteratorStorage &) const
+    { return eBeginBack(tag); }
+    virtual ElementIteratorBack *eEndBack(Dune::RefinementIntervals tag, IteratorStorage &) const
+    { return eEndBack(tag); }
   };
 
   //! codim database of VirtualRefinement
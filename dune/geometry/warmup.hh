@@ -0,0 +1,247 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#ifndef DUNE_GEOMETRY_WARMUP_HH
+#define DUNE_GEOMETRY_WARMUP_HH
+
+/** \file
+ *  \brief Eager, parallel creation of quadrature rules and reference elements
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <dune/common/fvector.hh>
+#include <dune/common/hybridutilities.hh>
+#include <dune/common/timer.hh>
+
+#include <dune/geometry/quadraturerules.hh>
+#include <dune/geometry/referenceelements.hh>
+#include <dune/geometry/type.hh>
+#include <dune/geometry/typeindex.hh>
+
+namespace Dune
+{
+
+  // WarmupStatistics
+  // ----------------
+
+  //! \brief summary of the work done by warmup()
+  struct WarmupStatistics
+  {
+    //! wall clock time spent in warmup(), in seconds
+    double seconds = 0.0;
+    //! number of threads used
+    unsigned int threads = 0;
+    //! number of quadrature rules requested
+    std::size_t quadratureRules = 0;
+    //! number of reference elements requested
+    std::size_t referenceElements = 0;
+    //! approximate number of bytes held by the quadrature rules (including their structure-of-arrays views)
+    std::size_t quadratureBytes = 0;
+    //! approximate number of bytes held by the reference elements (barycenters, subentity
+    //! geometries, integration outer normals and subentity numberings)
+    std::size_t referenceElementBytes = 0;
+  };
+
+  inline std::ostream &operator<< ( std::ostream &out, const WarmupStatistics &stats )
+  {
+    return out << "warmup: " << stats.quadratureRules << " quadrature rules ("
+               << stats.quadratureBytes << " bytes) and " << stats.referenceElements
+               << " reference elements (" << stats.referenceElementBytes << " bytes) in "
+               << stats.seconds << "s using " << stats.threads << " threads";
+  }
+
+
+
+  namespace Impl
+  {
+
+    // WarmupTask
+    // ----------
+
+    typedef std::function< std::size_t () > WarmupTask;
+
+    template< class ctype, int dim >
+    inline std::size_t warmupQuadratureRule ( const GeometryType &type, int p, QuadratureType::Enum qt )
+    {
+      const auto &rule = QuadratureRules< ctype, dim >::rule( type, p, qt );
+      const auto &soa = QuadratureRules< ctype, dim >::soa( type, p, qt );
+      return rule.capacity()*sizeof( typename std::decay< decltype( rule ) >::type::value_type )
+             + soa.paddedSize()*(dim+1)*sizeof( ctype );
+    }
+
+    template< class ctype, int dim >
+    inline std::size_t referenceElementBytes ( const GeometryType &type )
+    {
+      const auto refElement = ReferenceElements< ctype, dim >::general( type );
+
+      // integration outer normals
+      std::size_t bytes = (dim > 0 ? refElement.size( 1 ) : 0)*sizeof( FieldVector< ctype, dim > );
+      Hybrid::forEach( std::make_index_sequence< dim+1 >{}, [ & ] ( auto c ) {
+        typedef typename std::decay< decltype( refElement.template geometry< decltype( c )::value >( 0 ) ) >::type Geometry;
+        for( int i = 0; i < refElement.size( c ); ++i )
+        {
+          // barycenter, embedding geometry and numbering of the sub-subentities
+          bytes += sizeof( FieldVector< ctype, dim > ) + sizeof( Geometry );
+          for( int cc = c; cc <= dim; ++cc )
+            bytes += refElement.size( i, c, cc )*sizeof( unsigned int );
+        }
+      } );
+      return bytes;
+    }
+
+    // ReferenceElements< ctype, dim > creates all reference elements of a
+    // dimension at once, so there is no point in splitting this by type
+    template< class ctype, int dim >
+    inline std::size_t warmupReferenceElements ()
+    {
+      std::size_t bytes = 0;
+      for( std::size_t i = 0; i < LocalGeometryTypeIndex::size( dim ); ++i )
+      {
+        const GeometryType type = LocalGeometryTypeIndex::type( dim, i );
+        if( !type.isNone() )
+          bytes += referenceElementBytes< ctype, dim >( type );
+      }
+      return bytes;
+    }
+
+    template< class ctype >
+    inline void addWarmupTasks ( std::integral_constant< int, -1 >, int maxOrder,
+                                 const std::vector< QuadratureType::Enum > &types,
+                                 std::vector< WarmupTask > &ruleTasks,
+                                 std::vector< WarmupTask > &refElementTasks,
+                                 std::size_t &referenceElements )
+    {}
+
+    template< class ctype, int dim >
+    inline void addWarmupTasks ( std::integral_constant< int, dim >, int maxOrder,
+                                 const std::vector< QuadratureType::Enum > &types,
+                                 std::vector< WarmupTask > &ruleTasks,
+                                 std::vector< WarmupTask > &refElementTasks,
+                                 std::size_t &referenceElements )
+    {
+      addWarmupTasks< ctype >( std::integral_constant< int, dim-1 >(), maxOrder, types, ruleTasks, refElementTasks, referenceElements );
+
+      refElementTasks.emplace_back( [] () { return warmupReferenceElements< ctype, dim >(); } );
+
+      for( std::size_t i = 0; i < LocalGeometryTypeIndex::size( dim ); ++i )
+      {
+        const GeometryType type = LocalGeometryTypeIndex::type( dim, i );
+        if( type.isNone() )
+          continue;
+        ++referenceElements;
+        for( QuadratureType::Enum qt : types )
+        {
+          // there is only one quadrature rule for points
+          const int order = (dim == 0 ? 0 : std::min( maxOrder, int( QuadratureRules< ctype, dim >::maxOrder( type, qt ) ) ));
+          for( int p = 0; p <= order; ++p )
+            ruleTasks.emplace_back( [ type, p, qt ] () { return warmupQuadratureRule< ctype, dim >( type, p, qt ); } );
+        }
+      }
+    }
+
+    //! run all tasks on numThreads threads and return the sum of their results
+    inline std::size_t runWarmupTasks ( const std::vector< WarmupTask > &tasks, unsigned int numThreads )
+    {
+      std::atomic< std::size_t > next( 0 );
+      std::vector< std::size_t > results( tasks.size(), 0 );
+      std::exception_ptr error;
+      std::once_flag errorFlag;
+
+      auto worker = [ & ] () {
+        for( std::size_t k = next++; k < tasks.size(); k = next++ )
+        {
+          try
+          {
+            results[ k ] = tasks[ k ]();
+          }
+          catch( ... )
+          {
+            std::call_once( errorFlag, [ & ] () { error = std::current_exception(); } );
+          }
+        }
+      };
+
+      std::vector< std::thread > threads;
+      for( unsigned int t = 1; t < numThreads; ++t )
+        threads.emplace_back( worker );
+      worker();
+      for( std::thread &thread : threads )
+        thread.join();
+
+      if( error )
+        std::rethrow_exception( error );
+
+      std::size_t sum = 0;
+      for( std::size_t result : results )
+        sum += result;
+      return sum;
+    }
+
+  } // namespace Impl
+
+
+
+  // warmup
+  // ------
+
+  /** \brief create quadrature rules and reference elements in advance
+   *
+   *  QuadratureRules and ReferenceElements create their contents lazily on
+   *  first use. In large (threaded) runs, this moves a serialized
+   *  initialization into the first time step. Calling this method at
+   *  startup creates
+   *  - the reference elements of all dimensions up to maxDim and
+   *  - the quadrature rules (of the given quadrature types) of all
+   *    dimensions up to maxDim and all orders up to maxOrder,
+   *  distributing the work over numThreads threads.
+   *
+   *  The reference elements of one dimension are created together on first
+   *  use, so they are warmed up by one task per dimension and only the
+   *  different dimensions are created in parallel.
+   *
+   *  Orders not supported for some geometry type are skipped for that type.
+   *
+   *  \tparam     ctype       coordinate type
+   *  \tparam     maxDim      maximal dimension to create objects for
+   *  \param[in]  maxOrder    maximal quadrature order to create rules for
+   *  \param[in]  types       quadrature types to create rules for
+   *  \param[in]  numThreads  number of threads to use (0 means
+   *                          std::thread::hardware_concurrency())
+   *
+   *  \returns the elapsed time and the approximate memory held by the
+   *           requested objects
+   */
+  template< class ctype, int maxDim >
+  inline WarmupStatistics warmup ( int maxOrder,
+                                   const std::vector< QuadratureType::Enum > &types = { QuadratureType::GaussLegendre },
+                                   unsigned int numThreads = 0 )
+  {
+    Timer timer;
+
+    WarmupStatistics stats;
+    stats.threads = (numThreads > 0 ? numThreads : std::max( std::thread::hardware_concurrency(), 1u ));
+
+    std::vector< Impl::WarmupTask > ruleTasks, refElementTasks;
+    Impl::addWarmupTasks< ctype >( std::integral_constant< int, maxDim >(), maxOrder, types, ruleTasks, refElementTasks, stats.referenceElements );
+    stats.quadratureRules = ruleTasks.size();
+
+    stats.referenceElementBytes = Impl::runWarmupTasks( refElementTasks, stats.threads );
+    stats.quadratureBytes = Impl::runWarmupTasks( ruleTasks, stats.threads );
+
+    stats.seconds = timer.elapsed();
+    return stats;
+  }
+
+} // namespace Dune
+
+#endif // #ifndef DUNE_GEOMETRY_WARMUP_HH